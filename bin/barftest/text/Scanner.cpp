@@ -96,12 +96,16 @@ FiRange Scanner::UpdateCursorAndGetFiRange (std::string const &accepted_string)
 
 Scanner::Scanner ()
     :
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_(
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_(
         ms_state_table_,
         ms_state_count_,
         ms_transition_table_,
         ms_transition_count_,
-        ms_accept_handler_count_)
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_,
+        1024)
 {
     SetDebugSpewStream(NULL);
 
@@ -109,7 +113,7 @@ Scanner::Scanner ()
 #line 146 "../bin/barftest/text/Scanner.reflex"
 
 
-#line 113 "../bin/barftest/text/Scanner.cpp"
+#line 117 "../bin/barftest/text/Scanner.cpp"
 
     ResetForNewInput();
 }
@@ -120,7 +124,7 @@ Scanner::~Scanner ()
 #line 148 "../bin/barftest/text/Scanner.reflex"
 
 
-#line 124 "../bin/barftest/text/Scanner.cpp"
+#line 128 "../bin/barftest/text/Scanner.cpp"
 }
 
 Scanner::StateMachine::Name Scanner::CurrentStateMachine () const
@@ -132,10 +136,10 @@ Scanner::StateMachine::Name Scanner::CurrentStateMachine () const
     {
         default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
         case 0: return StateMachine::BLOCK_COMMENT;
-        case 10: return StateMachine::CHAR_LITERAL_END;
-        case 17: return StateMachine::CHAR_LITERAL_GUTS;
-        case 30: return StateMachine::MAIN;
-        case 330: return StateMachine::STRING_LITERAL_GUTS;
+        case 9: return StateMachine::CHAR_LITERAL_END;
+        case 16: return StateMachine::CHAR_LITERAL_GUTS;
+        case 28: return StateMachine::MAIN;
+        case 222: return StateMachine::STRING_LITERAL_GUTS;
     }
 }
 
@@ -152,14 +156,14 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
         *DebugSpewStream() << 
 #line 179 "../bin/barftest/text/Scanner.reflex"
 "Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
-#line 156 "../bin/barftest/text/Scanner.cpp"
+#line 160 "../bin/barftest/text/Scanner.cpp"
  << " switching to state machine "
                            << ms_state_machine_name_[state_machine];
         if (ms_state_machine_mode_flags_[state_machine] != 0)
         {
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_CASE_INSENSITIVE_) != 0)
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
                 *DebugSpewStream() << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_UNGREEDY_) != 0)
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_UNGREEDY_) != 0)
                 *DebugSpewStream() << " %ungreedy";
         }
         *DebugSpewStream() << std::endl)
@@ -168,31 +172,60 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
     assert(CurrentStateMachine() == state_machine);
 }
 
+Scanner::ScannerCheckpoint Scanner::Checkpoint ()
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 179 "../bin/barftest/text/Scanner.reflex"
+"Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
+#line 181 "../bin/barftest/text/Scanner.cpp"
+ << " taking checkpoint" << std::endl)
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_Noninteractive_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void Scanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 179 "../bin/barftest/text/Scanner.reflex"
+"Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
+#line 194 "../bin/barftest/text/Scanner.cpp"
+ << " restoring checkpoint" << std::endl)
+    ReflexCpp_::InputApparatus_Noninteractive_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void Scanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_Noninteractive_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
 void Scanner::ResetForNewInput ()
 {
     REFLEX_CPP_DEBUG_CODE_(
         *DebugSpewStream() << 
 #line 179 "../bin/barftest/text/Scanner.reflex"
 "Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
-#line 178 "../bin/barftest/text/Scanner.cpp"
+#line 211 "../bin/barftest/text/Scanner.cpp"
  << " executing reset-for-new-input actions and switching to state machine "
                            << ms_state_machine_name_[StateMachine::START_];
         if (ms_state_machine_mode_flags_[StateMachine::START_] != 0)
         {
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_CASE_INSENSITIVE_) != 0)
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
                 *DebugSpewStream() << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_UNGREEDY_) != 0)
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_UNGREEDY_) != 0)
                 *DebugSpewStream() << " %ungreedy";
         }
         *DebugSpewStream() << std::endl)
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
     assert(CurrentStateMachine() == StateMachine::START_);
 
 
 #line 170 "../bin/barftest/text/Scanner.reflex"
 
 
-#line 196 "../bin/barftest/text/Scanner.cpp"
+#line 229 "../bin/barftest/text/Scanner.cpp"
 }
 
 Parser::Token Scanner::Scan () throw()
@@ -204,17 +237,17 @@ Parser::Token Scanner::Scan () throw()
     // exist (see comments below).
     while (true)
     {
-        // clear the previous accepted/rejected string.
-        work_string.clear();
         // reset the char buffer and other stuff
         PrepareToScan_();
 
         bool was_at_end_of_input_ = IsAtEndOfInput();
 
-        std::uint32_t accept_handler_index_ = RunDfa_(work_string);
-        // if no valid accept_handler_index_ was returned, then work_string
-        // was filled with everything up to the char after the keep_string
-        // cursor (i.e. the rejected atom).
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        work_string.assign(AcceptedStringBegin_(), AcceptedStringEnd_());
         if (accept_handler_index_ >= ms_accept_handler_count_)
         {
             // if we were already at the end of input and no
@@ -229,7 +262,7 @@ Parser::Token Scanner::Scan () throw()
                 *DebugSpewStream() << 
 #line 179 "../bin/barftest/text/Scanner.reflex"
 "Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
-#line 233 "../bin/barftest/text/Scanner.cpp"
+#line 266 "../bin/barftest/text/Scanner.cpp"
  << " rejecting string ";
                 PrintString_(*DebugSpewStream(), rejected_string);
                 *DebugSpewStream() << " (rejected_atom is \'";
@@ -249,7 +282,7 @@ Parser::Token Scanner::Scan () throw()
         "unrecognized character " + char_literal_of(rejected_atom)
     );
 
-#line 253 "../bin/barftest/text/Scanner.cpp"
+#line 286 "../bin/barftest/text/Scanner.cpp"
 
             }
             while (false);
@@ -263,7 +296,7 @@ Parser::Token Scanner::Scan () throw()
                 *DebugSpewStream() << 
 #line 179 "../bin/barftest/text/Scanner.reflex"
 "Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
-#line 267 "../bin/barftest/text/Scanner.cpp"
+#line 300 "../bin/barftest/text/Scanner.cpp"
  << " accepting string ";
                 PrintString_(*DebugSpewStream(), accepted_string);
                 *DebugSpewStream() << " in state machine " << ms_state_machine_name_[CurrentStateMachine()]
@@ -281,7 +314,7 @@ Parser::Token Scanner::Scan () throw()
         UpdateCursorAndGetFiRange(accepted_string);
         SwitchToStateMachine(StateMachine::MAIN);
     
-#line 285 "../bin/barftest/text/Scanner.cpp"
+#line 318 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -298,7 +331,7 @@ Parser::Token Scanner::Scan () throw()
         // is what we want here.
         return Parser::Token(Parser::Terminal::END_, sem::make_dummy(firange));
     
-#line 302 "../bin/barftest/text/Scanner.cpp"
+#line 335 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -315,7 +348,7 @@ Parser::Token Scanner::Scan () throw()
         assert(m_char_literal == nullptr);
         return Parser::Token(Parser::Terminal::VALUE_LITERAL, std::move(return_token));
     
-#line 319 "../bin/barftest/text/Scanner.cpp"
+#line 352 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -333,7 +366,7 @@ Parser::Token Scanner::Scan () throw()
         SwitchToStateMachine(StateMachine::MAIN);
         return Parser::Token(Parser::Terminal::END_, sem::make_dummy(firange));
     
-#line 337 "../bin/barftest/text/Scanner.cpp"
+#line 370 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -351,7 +384,7 @@ Parser::Token Scanner::Scan () throw()
         SwitchToStateMachine(StateMachine::MAIN);
         return Parser::Token(Parser::Terminal::BAD_TOKEN, sem::make_dummy(firange));
     
-#line 355 "../bin/barftest/text/Scanner.cpp"
+#line 388 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -374,7 +407,7 @@ Parser::Token Scanner::Scan () throw()
         m_char_literal->set_value(uint8_t(value));
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 378 "../bin/barftest/text/Scanner.cpp"
+#line 411 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -398,7 +431,7 @@ Parser::Token Scanner::Scan () throw()
         m_char_literal->set_value(uint8_t(value));
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 402 "../bin/barftest/text/Scanner.cpp"
+#line 435 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -416,7 +449,7 @@ Parser::Token Scanner::Scan () throw()
         m_char_literal->set_value(uint8_t(escaped_char(uint8_t(accepted_string[1]))));
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 420 "../bin/barftest/text/Scanner.cpp"
+#line 453 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -433,7 +466,7 @@ Parser::Token Scanner::Scan () throw()
         m_char_literal->set_value(uint8_t(accepted_string[0]));
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 437 "../bin/barftest/text/Scanner.cpp"
+#line 470 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -452,7 +485,7 @@ Parser::Token Scanner::Scan () throw()
         // {END_OF_FILE} condition will still be true.
         return Parser::Token(Parser::Terminal::BAD_TOKEN, sem::make_dummy(firange));
     
-#line 456 "../bin/barftest/text/Scanner.cpp"
+#line 489 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -469,7 +502,7 @@ Parser::Token Scanner::Scan () throw()
         m_char_literal->set_value(uint8_t(accepted_string[0]));
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 473 "../bin/barftest/text/Scanner.cpp"
+#line 506 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -482,7 +515,7 @@ Parser::Token Scanner::Scan () throw()
         UpdateCursorAndGetFiRange(accepted_string);
         SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
     
-#line 486 "../bin/barftest/text/Scanner.cpp"
+#line 519 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -494,7 +527,7 @@ Parser::Token Scanner::Scan () throw()
 
         UpdateCursorAndGetFiRange(accepted_string);
     
-#line 498 "../bin/barftest/text/Scanner.cpp"
+#line 531 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -509,7 +542,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_boolean_value(UpdateCursorAndGetFiRange(accepted_string), true)
         );
     
-#line 513 "../bin/barftest/text/Scanner.cpp"
+#line 546 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -524,7 +557,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_boolean_value(UpdateCursorAndGetFiRange(accepted_string), false)
         );
     
-#line 528 "../bin/barftest/text/Scanner.cpp"
+#line 561 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -539,7 +572,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_null_value(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 543 "../bin/barftest/text/Scanner.cpp"
+#line 576 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -554,7 +587,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_void_type(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 558 "../bin/barftest/text/Scanner.cpp"
+#line 591 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -569,7 +602,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_void_value(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 573 "../bin/barftest/text/Scanner.cpp"
+#line 606 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -584,7 +617,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_void_type(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 588 "../bin/barftest/text/Scanner.cpp"
+#line 621 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -607,7 +640,7 @@ Parser::Token Scanner::Scan () throw()
             return Parser::Token(Parser::Terminal::BAD_TOKEN, sem::make_error_dummy(firange));
         }
     
-#line 611 "../bin/barftest/text/Scanner.cpp"
+#line 644 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -630,7 +663,7 @@ Parser::Token Scanner::Scan () throw()
             return Parser::Token(Parser::Terminal::BAD_TOKEN, sem::make_error_dummy(firange));
         }
     
-#line 634 "../bin/barftest/text/Scanner.cpp"
+#line 667 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -644,7 +677,7 @@ Parser::Token Scanner::Scan () throw()
             Parser::Terminal::BOOLEAN,
             sem::make_boolean(UpdateCursorAndGetFiRange(accepted_string)));
     
-#line 648 "../bin/barftest/text/Scanner.cpp"
+#line 681 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -659,7 +692,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_sint8(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 663 "../bin/barftest/text/Scanner.cpp"
+#line 696 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -674,7 +707,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_sint16(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 678 "../bin/barftest/text/Scanner.cpp"
+#line 711 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -689,7 +722,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_sint32(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 693 "../bin/barftest/text/Scanner.cpp"
+#line 726 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -704,7 +737,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_sint64(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 708 "../bin/barftest/text/Scanner.cpp"
+#line 741 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -719,7 +752,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_uint8(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 723 "../bin/barftest/text/Scanner.cpp"
+#line 756 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -734,7 +767,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_uint16(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 738 "../bin/barftest/text/Scanner.cpp"
+#line 771 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -749,7 +782,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_uint32(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 753 "../bin/barftest/text/Scanner.cpp"
+#line 786 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -764,7 +797,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_uint64(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 768 "../bin/barftest/text/Scanner.cpp"
+#line 801 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -779,7 +812,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_float32(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 783 "../bin/barftest/text/Scanner.cpp"
+#line 816 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -794,7 +827,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_float64(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 798 "../bin/barftest/text/Scanner.cpp"
+#line 831 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -809,7 +842,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_type_keyword(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 813 "../bin/barftest/text/Scanner.cpp"
+#line 846 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -824,7 +857,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_break(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 828 "../bin/barftest/text/Scanner.cpp"
+#line 861 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -839,7 +872,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_return(UpdateCursorAndGetFiRange(accepted_string))
         );
     
-#line 843 "../bin/barftest/text/Scanner.cpp"
+#line 876 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -853,7 +886,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+8);
         return Parser::Token(Parser::Terminal::EXTERNAL, sem::make_dummy(firange));
     
-#line 857 "../bin/barftest/text/Scanner.cpp"
+#line 890 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -867,7 +900,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+8);
         return Parser::Token(Parser::Terminal::INTERNAL, sem::make_dummy(firange));
     
-#line 871 "../bin/barftest/text/Scanner.cpp"
+#line 904 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -881,7 +914,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+7);
         return Parser::Token(Parser::Terminal::PRIVATE, sem::make_dummy(firange));
     
-#line 885 "../bin/barftest/text/Scanner.cpp"
+#line 918 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -895,7 +928,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+5);
         return Parser::Token(Parser::Terminal::LOCAL, sem::make_dummy(firange));
     
-#line 899 "../bin/barftest/text/Scanner.cpp"
+#line 932 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -909,7 +942,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+6);
         return Parser::Token(Parser::Terminal::GLOBAL, sem::make_dummy(firange));
     
-#line 913 "../bin/barftest/text/Scanner.cpp"
+#line 946 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -923,7 +956,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::CT, sem::make_dummy(firange));
     
-#line 927 "../bin/barftest/text/Scanner.cpp"
+#line 960 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -937,7 +970,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::RT, sem::make_dummy(firange));
     
-#line 941 "../bin/barftest/text/Scanner.cpp"
+#line 974 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -951,7 +984,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::IF, sem::make_dummy(firange));
     
-#line 955 "../bin/barftest/text/Scanner.cpp"
+#line 988 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -965,7 +998,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+4);
         return Parser::Token(Parser::Terminal::THEN, sem::make_dummy(firange));
     
-#line 969 "../bin/barftest/text/Scanner.cpp"
+#line 1002 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -980,7 +1013,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+9);
         return Parser::Token(Parser::Terminal::OTHERWISE, sem::make_dummy(firange));
     
-#line 984 "../bin/barftest/text/Scanner.cpp"
+#line 1017 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -994,7 +1027,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+5);
         return Parser::Token(Parser::Terminal::WHILE, sem::make_dummy(firange));
     
-#line 998 "../bin/barftest/text/Scanner.cpp"
+#line 1031 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1008,7 +1041,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::DO, sem::make_dummy(firange));
     
-#line 1012 "../bin/barftest/text/Scanner.cpp"
+#line 1045 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1022,7 +1055,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+3);
         return Parser::Token(Parser::Terminal::NOT, sem::make_dummy(firange));
     
-#line 1026 "../bin/barftest/text/Scanner.cpp"
+#line 1059 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1036,7 +1069,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+3);
         return Parser::Token(Parser::Terminal::AND, sem::make_dummy(firange));
     
-#line 1040 "../bin/barftest/text/Scanner.cpp"
+#line 1073 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1050,7 +1083,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::OR, sem::make_dummy(firange));
     
-#line 1054 "../bin/barftest/text/Scanner.cpp"
+#line 1087 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1064,7 +1097,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+3);
         return Parser::Token(Parser::Terminal::XOR, sem::make_dummy(firange));
     
-#line 1068 "../bin/barftest/text/Scanner.cpp"
+#line 1101 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1085,7 +1118,7 @@ Parser::Token Scanner::Scan () throw()
             )
         );
     
-#line 1089 "../bin/barftest/text/Scanner.cpp"
+#line 1122 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1097,7 +1130,7 @@ Parser::Token Scanner::Scan () throw()
 
         return Parser::Token(Parser::Terminal::NULLPTR, sem::make_dummy(UpdateCursorAndGetFiRange(accepted_string)));
     
-#line 1101 "../bin/barftest/text/Scanner.cpp"
+#line 1134 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1111,7 +1144,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::FANCYOP, sem::make_dummy(firange));
     
-#line 1115 "../bin/barftest/text/Scanner.cpp"
+#line 1148 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1125,7 +1158,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::EQUALS, sem::make_dummy(firange));
     
-#line 1129 "../bin/barftest/text/Scanner.cpp"
+#line 1162 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1139,7 +1172,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::NOT_EQUALS, sem::make_dummy(firange));
     
-#line 1143 "../bin/barftest/text/Scanner.cpp"
+#line 1176 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1153,7 +1186,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::MAPS_TO, sem::make_dummy(firange));
     
-#line 1157 "../bin/barftest/text/Scanner.cpp"
+#line 1190 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1167,7 +1200,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::INITIALIZE, sem::make_dummy(firange));
     
-#line 1171 "../bin/barftest/text/Scanner.cpp"
+#line 1204 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1181,7 +1214,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+3);
         return Parser::Token(Parser::Terminal::DEFINE, sem::make_dummy(firange));
     
-#line 1185 "../bin/barftest/text/Scanner.cpp"
+#line 1218 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1195,7 +1228,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::ASSIGN, sem::make_dummy(firange));
     
-#line 1199 "../bin/barftest/text/Scanner.cpp"
+#line 1232 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1209,7 +1242,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::LESS_THAN, sem::make_dummy(firange));
     
-#line 1213 "../bin/barftest/text/Scanner.cpp"
+#line 1246 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1223,7 +1256,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::GREATER_THAN, sem::make_dummy(firange));
     
-#line 1227 "../bin/barftest/text/Scanner.cpp"
+#line 1260 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1237,7 +1270,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::LESS_OR_EQUAL, sem::make_dummy(firange));
     
-#line 1241 "../bin/barftest/text/Scanner.cpp"
+#line 1274 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1251,7 +1284,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+2);
         return Parser::Token(Parser::Terminal::GREATER_OR_EQUAL, sem::make_dummy(firange));
     
-#line 1255 "../bin/barftest/text/Scanner.cpp"
+#line 1288 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1265,7 +1298,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::Name(accepted_string[0]), sem::make_dummy(firange));
     
-#line 1269 "../bin/barftest/text/Scanner.cpp"
+#line 1302 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1279,7 +1312,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::Name(accepted_string[0]), sem::make_dummy(firange));
     
-#line 1283 "../bin/barftest/text/Scanner.cpp"
+#line 1316 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1294,7 +1327,7 @@ Parser::Token Scanner::Scan () throw()
         m_char_literal = sem::make_uint8_value(firange, 0); // 0 is a dummy value, and will be overwritten later.
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_GUTS);
     
-#line 1298 "../bin/barftest/text/Scanner.cpp"
+#line 1331 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1309,7 +1342,7 @@ Parser::Token Scanner::Scan () throw()
         m_string_literal = sem::make_string_literal(firange);
         SwitchToStateMachine(StateMachine::STRING_LITERAL_GUTS);
     
-#line 1313 "../bin/barftest/text/Scanner.cpp"
+#line 1346 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1324,7 +1357,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_identifier(UpdateCursorAndGetFiRange(accepted_string), accepted_string)
         );
     
-#line 1328 "../bin/barftest/text/Scanner.cpp"
+#line 1361 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1339,7 +1372,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_identifier(UpdateCursorAndGetFiRange(accepted_string), accepted_string)
         );
     
-#line 1343 "../bin/barftest/text/Scanner.cpp"
+#line 1376 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1354,7 +1387,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_identifier(UpdateCursorAndGetFiRange(accepted_string), accepted_string)
         );
     
-#line 1358 "../bin/barftest/text/Scanner.cpp"
+#line 1391 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1369,7 +1402,7 @@ Parser::Token Scanner::Scan () throw()
             sem::make_identifier(UpdateCursorAndGetFiRange(accepted_string), accepted_string)
         );
     
-#line 1373 "../bin/barftest/text/Scanner.cpp"
+#line 1406 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1383,7 +1416,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::Name(accepted_string.front()), sem::make_dummy(firange));
     
-#line 1387 "../bin/barftest/text/Scanner.cpp"
+#line 1420 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1397,7 +1430,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).end_as_firange()-1);
         return Parser::Token(Parser::Terminal::Name(accepted_string.back()), sem::make_dummy(firange));
     
-#line 1401 "../bin/barftest/text/Scanner.cpp"
+#line 1434 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1411,7 +1444,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::Name(accepted_string.front()), sem::make_dummy(firange));
     
-#line 1415 "../bin/barftest/text/Scanner.cpp"
+#line 1448 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1425,7 +1458,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).end_as_firange()-1);
         return Parser::Token(Parser::Terminal::Name(accepted_string.back()), sem::make_dummy(firange));
     
-#line 1429 "../bin/barftest/text/Scanner.cpp"
+#line 1462 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1439,7 +1472,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::Name(accepted_string.front()), sem::make_dummy(firange));
     
-#line 1443 "../bin/barftest/text/Scanner.cpp"
+#line 1476 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1453,7 +1486,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).end_as_firange()-1);
         return Parser::Token(Parser::Terminal::Name(accepted_string.back()), sem::make_dummy(firange));
     
-#line 1457 "../bin/barftest/text/Scanner.cpp"
+#line 1490 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1467,7 +1500,7 @@ Parser::Token Scanner::Scan () throw()
         FiRange firange(UpdateCursorAndGetFiRange(accepted_string).start_as_firange()+1);
         return Parser::Token(Parser::Terminal::Name(','), sem::make_dummy(firange));
     
-#line 1471 "../bin/barftest/text/Scanner.cpp"
+#line 1504 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1479,7 +1512,7 @@ Parser::Token Scanner::Scan () throw()
 
         UpdateCursorAndGetFiRange(accepted_string);
     
-#line 1483 "../bin/barftest/text/Scanner.cpp"
+#line 1516 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1491,7 +1524,7 @@ Parser::Token Scanner::Scan () throw()
 
         return Parser::Token(Parser::Terminal::STATEMENT_DELIMITER, sem::make_dummy(UpdateCursorAndGetFiRange(accepted_string)));
     
-#line 1495 "../bin/barftest/text/Scanner.cpp"
+#line 1528 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1503,7 +1536,7 @@ Parser::Token Scanner::Scan () throw()
 
         return Parser::Token(Parser::Terminal::END_, sem::make_dummy(UpdateCursorAndGetFiRange(accepted_string)));
     
-#line 1507 "../bin/barftest/text/Scanner.cpp"
+#line 1540 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1518,7 +1551,7 @@ Parser::Token Scanner::Scan () throw()
         m_record_recoverable_error(firange, "unexpected character " + char_literal_of(accepted_string[0]));
         return Parser::Token(Parser::Terminal::BAD_TOKEN, sem::make_dummy(firange));
     
-#line 1522 "../bin/barftest/text/Scanner.cpp"
+#line 1555 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1573,7 +1606,7 @@ Parser::Token Scanner::Scan () throw()
         assert(m_string_literal == nullptr);
         return Parser::Token(Parser::Terminal::STRING_LITERAL, std::move(return_token));
     
-#line 1577 "../bin/barftest/text/Scanner.cpp"
+#line 1610 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1590,7 +1623,7 @@ Parser::Token Scanner::Scan () throw()
         m_string_literal.reset();
         return Parser::Token(Parser::Terminal::END_, sem::make_dummy(firange));
     
-#line 1594 "../bin/barftest/text/Scanner.cpp"
+#line 1627 "../bin/barftest/text/Scanner.cpp"
 
                 }
                 break;
@@ -1606,7 +1639,38 @@ Parser::Token Scanner::Scan () throw()
     assert(false && "you didn't handle EOF properly");
     return Parser::Token(Parser::Terminal::END_, sem::make_dummy(UpdateCursorAndGetFiRange(work_string)));
 
-#line 1610 "../bin/barftest/text/Scanner.cpp"
+#line 1643 "../bin/barftest/text/Scanner.cpp"
+}
+
+std::uint32_t Scanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 4 || length > 11)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 31];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
 }
 
 void Scanner::KeepString ()
@@ -1614,9 +1678,9 @@ void Scanner::KeepString ()
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
 #line 179 "../bin/barftest/text/Scanner.reflex"
 "Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
-#line 1618 "../bin/barftest/text/Scanner.cpp"
+#line 1682 "../bin/barftest/text/Scanner.cpp"
  << " keeping string" << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::KeepString();
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::KeepString();
 }
 
 void Scanner::Unaccept (std::uint32_t unaccept_char_count)
@@ -1624,9 +1688,9 @@ void Scanner::Unaccept (std::uint32_t unaccept_char_count)
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
 #line 179 "../bin/barftest/text/Scanner.reflex"
 "Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
-#line 1628 "../bin/barftest/text/Scanner.cpp"
+#line 1692 "../bin/barftest/text/Scanner.cpp"
  << " unaccepting " << unaccept_char_count << " char" << (unaccept_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::Unaccept(unaccept_char_count);
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::Unaccept(unaccept_char_count);
 }
 
 void Scanner::Unreject (std::uint32_t unreject_char_count)
@@ -1634,9 +1698,9 @@ void Scanner::Unreject (std::uint32_t unreject_char_count)
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
 #line 179 "../bin/barftest/text/Scanner.reflex"
 "Scanner" << (firange().is_valid() ? " ("+firange().as_string()+")" : std::string()) << ":"
-#line 1638 "../bin/barftest/text/Scanner.cpp"
+#line 1702 "../bin/barftest/text/Scanner.cpp"
  << " unrejecting " << unreject_char_count << " char" << (unreject_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::Unreject(unreject_char_count);
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::Unreject(unreject_char_count);
 }
 
 // ///////////////////////////////////////////////////////////////////////
@@ -1660,6 +1724,11 @@ void Scanner::PrintAtom_ (std::ostream &out, std::uint8_t atom)
 }
 
 void Scanner::PrintString_ (std::ostream &out, std::string const &s)
+{
+    PrintString_(out, s.data(), s.length());
+}
+
+void Scanner::PrintString_ (std::ostream &out, char const *s, std::size_t length)
 {
     // save the existing ostream properties for later restoration
     std::ios_base::fmtflags saved_stream_flags = out.flags();
@@ -1679,7 +1748,7 @@ void Scanner::PrintString_ (std::ostream &out, std::string const &s)
     out.fill('0');
 
     out << '"';
-    for (std::string::size_type i = 0; i < s.size(); ++i)
+    for (std::size_t i = 0; i < length; ++i)
         PrintAtom_(out, s[i]);
     out << '"';
 
@@ -1693,10 +1762,10 @@ void Scanner::PrintString_ (std::ostream &out, std::string const &s)
 std::uint32_t const Scanner::ms_state_machine_start_state_index_[] =
 {
     0,
-    10,
-    17,
-    30,
-    330,
+    9,
+    16,
+    28,
+    222,
 };
 std::uint8_t const Scanner::ms_state_machine_mode_flags_[] =
 {
@@ -1718,352 +1787,243 @@ std::uint32_t const Scanner::ms_state_machine_count_ = sizeof(Scanner::ms_state_
 
 // the order of the states indicates priority (only for accept states).
 // the lower the state's index in this array, the higher its priority.
-ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaState_ const Scanner::ms_state_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaState_ const Scanner::ms_state_table_[] =
 {
-    { 85, 32, 0, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 85, 255, 32, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 85, 32, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 1, 255, 319, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 85, 32, 574, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 85, 255, 606, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 0, 32, 861, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 0, 255, 893, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 0, 255, 1148, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 1, 255, 1403, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 85, 32, 1658, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 85, 255, 1690, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 4, 0, 1945, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 2, 0, 1945, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 4, 32, 1945, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 3, 0, 1977, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 3, 255, 1977, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 85, 32, 2232, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 85, 255, 2264, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 10, 0, 2519, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 8, 0, 2519, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 10, 32, 2519, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 10, 95, 2551, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 32 },
-    { 7, 0, 2646, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 5, 8, 2646, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 5, 8, 2654, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 7, 55, 2662, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 6, 55, 2717, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 9, 95, 2772, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 32 },
-    { 9, 255, 2867, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 85, 32, 3122, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 85, 255, 3154, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 82, 0, 3409, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 79, 117, 3409, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 79, 117, 3526, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 80, 85, 3643, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 75, 0, 3728, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 80, 84, 3728, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 3812, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 85, 1, 3813, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 77, 0, 3814, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 85, 1, 3814, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 73, 0, 3815, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 82, 1, 3815, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 61 },
-    { 55, 84, 3816, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 3900, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 67, 0, 3901, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 64, 84, 3901, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 64, 84, 3985, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 4069, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 82, 1, 4070, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 36 },
-    { 85, 58, 4071, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 65 },
-    { 69, 75, 4129, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 85, 1, 4204, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 58 },
-    { 70, 87, 4205, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 36 },
-    { 85, 1, 4292, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 36 },
-    { 85, 58, 4293, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 65 },
-    { 69, 75, 4351, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 85, 1, 4426, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 58 },
-    { 65, 84, 4427, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 65, 84, 4511, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 4595, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 66, 0, 4596, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 74, 84, 4596, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 74, 84, 4680, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 4764, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 75, 0, 4765, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 78, 84, 4765, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 78, 84, 4849, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 4933, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 65, 84, 4934, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 56, 84, 5018, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 5102, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 65, 84, 5103, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 11, 0, 5187, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 12, 255, 5187, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 19, 56, 5442, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 20, 54, 5498, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 85, 15, 5552, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 43 },
-    { 85, 10, 5567, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 20, 0, 5577, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 20, 10, 5577, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 85, 15, 5587, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 43 },
-    { 85, 10, 5602, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 20, 10, 5612, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 19, 56, 5622, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 19, 56, 5678, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 65, 84, 5734, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 68, 87, 5818, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 36 },
-    { 85, 1, 5905, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 36 },
-    { 85, 58, 5906, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 65 },
-    { 71, 75, 5964, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 85, 1, 6039, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 58 },
-    { 70, 87, 6040, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 36 },
-    { 85, 1, 6127, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 36 },
-    { 85, 58, 6128, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 65 },
-    { 71, 75, 6186, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 85, 1, 6261, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 58 },
-    { 58, 84, 6262, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 6346, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 57, 84, 6347, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 6431, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 80, 84, 6432, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 60, 84, 6516, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 60, 84, 6600, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 6684, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 62, 84, 6685, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 6769, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 53, 84, 6770, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 6854, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 59, 84, 6855, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 59, 84, 6939, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 7023, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 54, 84, 7024, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 7108, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 61, 84, 7109, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 61, 84, 7193, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 7277, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 63, 84, 7278, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 7362, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 7363, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 7438, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 7513, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 7588, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 7663, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 7738, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 7813, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 21, 75, 7888, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 7963, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8038, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8113, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8188, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 14, 75, 8263, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8338, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8413, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8488, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8563, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8638, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 30, 75, 8713, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8788, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 31, 75, 8863, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 8938, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9013, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9088, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 16, 75, 9163, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9238, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9313, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9388, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9463, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9538, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 23, 75, 9613, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9688, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 24, 75, 9763, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 9838, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 25, 75, 9913, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 22, 75, 9988, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10063, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10138, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10213, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 13, 75, 10288, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10363, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10438, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 32, 75, 10513, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10588, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10663, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10738, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10813, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 10888, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 27, 75, 10963, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 11038, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 28, 75, 11113, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 11188, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 29, 75, 11263, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 26, 75, 11338, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 11413, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 11488, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 11563, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 18, 75, 11638, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 76, 84, 11713, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 76, 84, 11797, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 11881, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 82, 1, 11882, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 77, 0, 11883, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 69, 75, 11883, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 11958, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12033, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12108, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12183, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12258, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12333, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12408, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12483, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12558, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12633, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12708, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12783, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 12858, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 51, 75, 12933, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13008, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13083, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13158, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13233, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13308, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13383, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13458, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13533, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 52, 75, 13608, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13683, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 13758, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 48, 114, 13833, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 48, 84, 13947, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 14031, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 14032, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 14107, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 14182, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 14257, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 33, 75, 14332, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 14407, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 40, 114, 14482, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 40, 84, 14596, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 14680, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 14681, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 46, 114, 14756, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 46, 84, 14870, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 14954, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 14955, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15030, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15105, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15180, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15255, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15330, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15405, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 35, 114, 15480, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 35, 84, 15594, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 15678, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 15679, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15754, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15829, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15904, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 15979, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 39, 114, 16054, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 39, 84, 16168, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 16252, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 16253, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 42, 114, 16328, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 42, 84, 16442, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 16526, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 16527, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 16602, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 16677, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 16752, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 16827, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 16902, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 36, 114, 16977, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 36, 84, 17091, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 17175, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 17176, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 17251, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 17326, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 17401, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 38, 114, 17476, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 38, 84, 17590, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 17674, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 17675, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 17750, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 47, 114, 17825, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 47, 84, 17939, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 18023, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 18024, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 18099, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 15, 75, 18174, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 18249, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 49, 114, 18324, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 49, 84, 18438, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 18522, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 18523, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 18598, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 18673, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 18748, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 18823, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 18898, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 18973, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 44, 114, 19048, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 44, 84, 19162, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 19246, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 19247, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 19322, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 19397, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 19472, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 19547, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 19622, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 37, 114, 19697, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 37, 84, 19811, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 19895, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 19896, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 19971, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 20046, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 20121, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 20196, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 34, 75, 20271, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 41, 114, 20346, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 41, 84, 20460, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 20544, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 20545, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 20620, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 20695, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 43, 114, 20770, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 43, 84, 20884, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 20968, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 20969, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 21044, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 21119, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 17, 75, 21194, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 21269, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 21344, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 21419, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 21494, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 45, 114, 21569, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 45, 84, 21683, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 21767, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 69, 75, 21768, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 69, 75, 21843, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 50, 114, 21918, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 50, 84, 22032, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 22116, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 72, 84, 22117, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 72, 84, 22201, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 9 },
-    { 85, 1, 22285, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 10 },
-    { 73, 0, 22286, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 81, 255, 22286, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 85, 32, 22541, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 85, 255, 22573, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 85, 32, 22828, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 84, 255, 22860, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 83, 32, 23115, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 83, 255, 23147, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 85, 32, 23402, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 85, 255, 23434, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 84, 255, 23689, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 83, 255, 23944, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 }
+    { 0, 85, 32, 2, 0 },
+    { 32, 85, 58, 0, 0 },
+    { 90, 85, 32, 2, 0 },
+    { 122, 1, 58, 0, 0 },
+    { 180, 85, 32, 2, 0 },
+    { 212, 85, 58, 0, 0 },
+    { 270, 0, 32, 2, 0 },
+    { 302, 0, 58, 0, 0 },
+    { 360, 1, 58, 0, 0 },
+    { 418, 85, 32, 2, 0 },
+    { 450, 85, 58, 0, 0 },
+    { 508, 4, 0, 0, 0 },
+    { 508, 2, 0, 0, 0 },
+    { 508, 4, 32, 2, 0 },
+    { 540, 3, 0, 0, 0 },
+    { 540, 3, 58, 0, 0 },
+    { 598, 85, 32, 2, 0 },
+    { 630, 85, 58, 0, 0 },
+    { 688, 10, 0, 0, 0 },
+    { 688, 8, 0, 0, 0 },
+    { 688, 10, 32, 2, 0 },
+    { 720, 10, 58, 0, 0 },
+    { 778, 7, 0, 0, 0 },
+    { 778, 5, 58, 0, 1 },
+    { 836, 7, 58, 0, 0 },
+    { 894, 6, 58, 0, 2 },
+    { 952, 9, 58, 0, 0 },
+    { 1010, 9, 58, 0, 0 },
+    { 1068, 85, 32, 2, 0 },
+    { 1100, 85, 58, 0, 0 },
+    { 1158, 82, 0, 0, 0 },
+    { 1158, 79, 58, 0, 3 },
+    { 1216, 80, 58, 0, 4 },
+    { 1274, 75, 0, 0, 0 },
+    { 1274, 80, 58, 0, 5 },
+    { 1332, 85, 58, 0, 0 },
+    { 1390, 85, 58, 0, 0 },
+    { 1448, 77, 0, 0, 0 },
+    { 1448, 85, 58, 0, 0 },
+    { 1506, 73, 0, 0, 0 },
+    { 1506, 82, 58, 0, 0 },
+    { 1564, 55, 58, 0, 4 },
+    { 1622, 85, 58, 0, 0 },
+    { 1680, 67, 0, 0, 0 },
+    { 1680, 64, 58, 0, 3 },
+    { 1738, 85, 58, 0, 0 },
+    { 1796, 82, 58, 0, 0 },
+    { 1854, 85, 58, 0, 0 },
+    { 1912, 69, 58, 0, 6 },
+    { 1970, 85, 58, 0, 0 },
+    { 2028, 70, 58, 0, 0 },
+    { 2086, 85, 58, 0, 0 },
+    { 2144, 65, 58, 0, 4 },
+    { 2202, 85, 58, 0, 0 },
+    { 2260, 66, 0, 0, 0 },
+    { 2260, 74, 58, 0, 4 },
+    { 2318, 85, 58, 0, 0 },
+    { 2376, 78, 58, 0, 4 },
+    { 2434, 85, 58, 0, 0 },
+    { 2492, 65, 58, 0, 0 },
+    { 2550, 56, 58, 0, 4 },
+    { 2608, 85, 58, 0, 0 },
+    { 2666, 65, 58, 0, 0 },
+    { 2724, 11, 0, 0, 0 },
+    { 2724, 12, 58, 0, 7 },
+    { 2782, 19, 58, 0, 0 },
+    { 2840, 20, 58, 0, 8 },
+    { 2898, 85, 58, 0, 0 },
+    { 2956, 85, 58, 0, 0 },
+    { 3014, 20, 0, 0, 0 },
+    { 3014, 20, 58, 0, 8 },
+    { 3072, 19, 58, 0, 8 },
+    { 3130, 65, 58, 0, 0 },
+    { 3188, 68, 58, 0, 0 },
+    { 3246, 85, 58, 0, 0 },
+    { 3304, 85, 58, 0, 0 },
+    { 3362, 71, 58, 0, 6 },
+    { 3420, 85, 58, 0, 0 },
+    { 3478, 70, 58, 0, 0 },
+    { 3536, 58, 58, 0, 4 },
+    { 3594, 85, 58, 0, 0 },
+    { 3652, 57, 58, 0, 4 },
+    { 3710, 85, 58, 0, 0 },
+    { 3768, 60, 58, 0, 0 },
+    { 3826, 60, 58, 0, 4 },
+    { 3884, 85, 58, 0, 0 },
+    { 3942, 62, 58, 0, 4 },
+    { 4000, 85, 58, 0, 0 },
+    { 4058, 53, 58, 0, 4 },
+    { 4116, 85, 58, 0, 0 },
+    { 4174, 59, 58, 0, 0 },
+    { 4232, 59, 58, 0, 4 },
+    { 4290, 85, 58, 0, 0 },
+    { 4348, 54, 58, 0, 4 },
+    { 4406, 85, 58, 0, 0 },
+    { 4464, 61, 58, 0, 0 },
+    { 4522, 61, 58, 0, 4 },
+    { 4580, 85, 58, 0, 0 },
+    { 4638, 63, 58, 0, 4 },
+    { 4696, 85, 58, 0, 0 },
+    { 4754, 76, 58, 0, 4 },
+    { 4812, 85, 58, 0, 0 },
+    { 4870, 82, 58, 0, 0 },
+    { 4928, 69, 58, 0, 0 },
+    { 4986, 69, 58, 0, 0 },
+    { 5044, 69, 58, 0, 0 },
+    { 5102, 69, 58, 0, 0 },
+    { 5160, 69, 58, 0, 0 },
+    { 5218, 69, 58, 0, 0 },
+    { 5276, 69, 58, 0, 0 },
+    { 5334, 69, 58, 0, 0 },
+    { 5392, 69, 58, 0, 0 },
+    { 5450, 69, 58, 0, 0 },
+    { 5508, 69, 58, 0, 0 },
+    { 5566, 69, 58, 0, 0 },
+    { 5624, 69, 58, 0, 9 },
+    { 5682, 69, 58, 0, 0 },
+    { 5740, 51, 58, 0, 0 },
+    { 5798, 69, 58, 0, 0 },
+    { 5856, 69, 58, 0, 0 },
+    { 5914, 48, 58, 0, 0 },
+    { 5972, 48, 58, 0, 4 },
+    { 6030, 85, 58, 0, 0 },
+    { 6088, 69, 58, 0, 0 },
+    { 6146, 40, 58, 0, 0 },
+    { 6204, 40, 58, 0, 4 },
+    { 6262, 85, 58, 0, 0 },
+    { 6320, 69, 58, 0, 0 },
+    { 6378, 46, 58, 0, 0 },
+    { 6436, 46, 58, 0, 4 },
+    { 6494, 85, 58, 0, 0 },
+    { 6552, 69, 58, 0, 0 },
+    { 6610, 69, 58, 0, 0 },
+    { 6668, 69, 58, 0, 0 },
+    { 6726, 69, 58, 0, 0 },
+    { 6784, 69, 58, 0, 0 },
+    { 6842, 69, 58, 0, 0 },
+    { 6900, 69, 58, 0, 0 },
+    { 6958, 35, 58, 0, 0 },
+    { 7016, 35, 58, 0, 4 },
+    { 7074, 85, 58, 0, 0 },
+    { 7132, 69, 58, 0, 0 },
+    { 7190, 69, 58, 0, 0 },
+    { 7248, 69, 58, 0, 0 },
+    { 7306, 69, 58, 0, 0 },
+    { 7364, 69, 58, 0, 0 },
+    { 7422, 39, 58, 0, 0 },
+    { 7480, 39, 58, 0, 4 },
+    { 7538, 85, 58, 0, 0 },
+    { 7596, 69, 58, 0, 0 },
+    { 7654, 42, 58, 0, 0 },
+    { 7712, 42, 58, 0, 4 },
+    { 7770, 85, 58, 0, 0 },
+    { 7828, 69, 58, 0, 0 },
+    { 7886, 69, 58, 0, 0 },
+    { 7944, 69, 58, 0, 0 },
+    { 8002, 69, 58, 0, 0 },
+    { 8060, 69, 58, 0, 0 },
+    { 8118, 69, 58, 0, 0 },
+    { 8176, 36, 58, 0, 0 },
+    { 8234, 36, 58, 0, 4 },
+    { 8292, 85, 58, 0, 0 },
+    { 8350, 69, 58, 0, 0 },
+    { 8408, 69, 58, 0, 0 },
+    { 8466, 69, 58, 0, 0 },
+    { 8524, 69, 58, 0, 0 },
+    { 8582, 38, 58, 0, 0 },
+    { 8640, 38, 58, 0, 4 },
+    { 8698, 85, 58, 0, 0 },
+    { 8756, 69, 58, 0, 0 },
+    { 8814, 69, 58, 0, 0 },
+    { 8872, 47, 58, 0, 0 },
+    { 8930, 47, 58, 0, 4 },
+    { 8988, 85, 58, 0, 0 },
+    { 9046, 69, 58, 0, 0 },
+    { 9104, 49, 58, 0, 0 },
+    { 9162, 49, 58, 0, 4 },
+    { 9220, 85, 58, 0, 0 },
+    { 9278, 69, 58, 0, 0 },
+    { 9336, 69, 58, 0, 0 },
+    { 9394, 69, 58, 0, 0 },
+    { 9452, 69, 58, 0, 0 },
+    { 9510, 69, 58, 0, 0 },
+    { 9568, 69, 58, 0, 0 },
+    { 9626, 69, 58, 0, 0 },
+    { 9684, 44, 58, 0, 0 },
+    { 9742, 44, 58, 0, 4 },
+    { 9800, 85, 58, 0, 0 },
+    { 9858, 69, 58, 0, 0 },
+    { 9916, 69, 58, 0, 0 },
+    { 9974, 69, 58, 0, 0 },
+    { 10032, 69, 58, 0, 0 },
+    { 10090, 69, 58, 0, 0 },
+    { 10148, 69, 58, 0, 0 },
+    { 10206, 37, 58, 0, 0 },
+    { 10264, 37, 58, 0, 4 },
+    { 10322, 85, 58, 0, 0 },
+    { 10380, 69, 58, 0, 0 },
+    { 10438, 41, 58, 0, 0 },
+    { 10496, 41, 58, 0, 4 },
+    { 10554, 85, 58, 0, 0 },
+    { 10612, 69, 58, 0, 0 },
+    { 10670, 69, 58, 0, 0 },
+    { 10728, 69, 58, 0, 0 },
+    { 10786, 43, 58, 0, 0 },
+    { 10844, 43, 58, 0, 4 },
+    { 10902, 85, 58, 0, 0 },
+    { 10960, 69, 58, 0, 0 },
+    { 11018, 69, 58, 0, 0 },
+    { 11076, 69, 58, 0, 0 },
+    { 11134, 69, 58, 0, 0 },
+    { 11192, 45, 58, 0, 0 },
+    { 11250, 45, 58, 0, 4 },
+    { 11308, 85, 58, 0, 0 },
+    { 11366, 69, 58, 0, 0 },
+    { 11424, 69, 58, 0, 0 },
+    { 11482, 50, 58, 0, 0 },
+    { 11540, 50, 58, 0, 4 },
+    { 11598, 85, 58, 0, 0 },
+    { 11656, 72, 58, 0, 4 },
+    { 11714, 85, 58, 0, 0 },
+    { 11772, 81, 58, 0, 0 },
+    { 11830, 85, 32, 2, 0 },
+    { 11862, 85, 58, 0, 0 },
+    { 11920, 85, 32, 2, 0 },
+    { 11952, 84, 58, 0, 0 },
+    { 12010, 83, 32, 2, 0 },
+    { 12042, 83, 58, 0, 0 },
+    { 12100, 85, 32, 2, 0 },
+    { 12132, 85, 58, 0, 0 },
+    { 12190, 84, 58, 0, 0 }
 };
 std::size_t const Scanner::ms_state_count_ = sizeof(Scanner::ms_state_table_) / sizeof(*Scanner::ms_state_table_);
 
-ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const Scanner::ms_transition_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaTransition_ const Scanner::ms_transition_table_[] =
 {
     { 1 },
     { 1 },
@@ -2097,35 +2057,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 1 },
     { 3 },
     { 3 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
+    { 231 },
     { 2 },
     { 2 },
     { 2 },
@@ -2183,6 +2115,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 231 },
     { 2 },
     { 2 },
     { 2 },
@@ -2195,6 +2160,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
     { 2 },
@@ -2239,6 +2205,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 231 },
     { 2 },
     { 2 },
     { 2 },
@@ -2251,10 +2250,12 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
     { 2 },
     { 2 },
+    { 6 },
     { 2 },
     { 2 },
     { 2 },
@@ -2294,6 +2295,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 231 },
     { 2 },
     { 2 },
     { 2 },
@@ -2306,6 +2340,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
     { 2 },
@@ -2350,69 +2385,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
-    { 2 },
-    { 2 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
+    { 231 },
     { 2 },
     { 2 },
     { 2 },
@@ -2430,6 +2403,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 6 },
     { 2 },
     { 2 },
     { 2 },
@@ -2469,23804 +2443,11960 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 6 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 6 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 13 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 14 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 13 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 14 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 21 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 26 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 26 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 21 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 31 },
-    { 31 },
-    { 329 },
-    { 329 },
-    { 31 },
-    { 31 },
-    { 329 },
-    { 329 },
-    { 31 },
-    { 31 },
-    { 329 },
-    { 329 },
-    { 31 },
-    { 31 },
-    { 329 },
-    { 329 },
-    { 31 },
-    { 31 },
-    { 329 },
-    { 329 },
-    { 31 },
-    { 31 },
-    { 329 },
-    { 329 },
-    { 31 },
-    { 31 },
-    { 329 },
-    { 329 },
-    { 31 },
-    { 31 },
-    { 329 },
-    { 329 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 33 },
-    { 35 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 33 },
-    { 43 },
-    { 46 },
-    { 47 },
-    { 50 },
-    { 59 },
-    { 59 },
-    { 62 },
-    { 63 },
-    { 66 },
-    { 59 },
-    { 59 },
-    { 67 },
-    { 70 },
-    { 32 },
-    { 73 },
-    { 76 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 87 },
-    { 102 },
-    { 103 },
-    { 110 },
-    { 115 },
-    { 32 },
-    { 47 },
-    { 120 },
-    { 121 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 128 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 141 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 145 },
-    { 156 },
-    { 163 },
-    { 174 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 178 },
-    { 181 },
-    { 182 },
-    { 59 },
-    { 183 },
-    { 32 },
-    { 207 },
-    { 212 },
-    { 217 },
-    { 221 },
-    { 225 },
-    { 120 },
-    { 235 },
-    { 120 },
-    { 243 },
-    { 120 },
-    { 120 },
-    { 256 },
-    { 120 },
-    { 263 },
-    { 271 },
-    { 285 },
-    { 120 },
-    { 294 },
-    { 120 },
-    { 303 },
-    { 120 },
-    { 309 },
-    { 313 },
-    { 320 },
-    { 120 },
-    { 120 },
-    { 325 },
-    { 32 },
-    { 328 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 34 },
-    { 35 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 34 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 36 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 41 },
-    { 40 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 42 },
-    { 34 },
-    { 35 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 34 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 36 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 41 },
-    { 40 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 42 },
-    { 35 },
-    { 35 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 35 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 36 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 39 },
-    { 40 },
-    { 37 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 38 },
-    { 37 },
-    { 35 },
-    { 34 },
-    { 44 },
-    { 44 },
-    { 44 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 44 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 45 },
-    { 44 },
-    { 48 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 48 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 49 },
-    { 48 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 48 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 49 },
-    { 48 },
-    { 51 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 54 },
-    { 55 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 57 },
-    { 340 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 56 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 57 },
-    { 340 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 58 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 57 },
-    { 340 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 54 },
-    { 60 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 61 },
-    { 60 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 61 },
-    { 60 },
-    { 64 },
-    { 64 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 64 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 65 },
-    { 64 },
-    { 64 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 64 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 65 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 68 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 69 },
-    { 68 },
-    { 68 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 68 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 69 },
-    { 68 },
-    { 60 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 71 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 61 },
-    { 71 },
-    { 71 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 71 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 72 },
-    { 71 },
-    { 60 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 74 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 75 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 61 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 340 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 75 },
-    { 77 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 82 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 82 },
-    { 77 },
-    { 77 },
-    { 77 },
-    { 77 },
-    { 77 },
-    { 77 },
-    { 77 },
-    { 77 },
-    { 77 },
-    { 77 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 78 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 78 },
-    { 79 },
-    { 340 },
-    { 79 },
-    { 340 },
-    { 340 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 81 },
-    { 83 },
-    { 340 },
-    { 83 },
-    { 340 },
-    { 340 },
-    { 80 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 80 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 84 },
-    { 77 },
-    { 340 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 82 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 82 },
-    { 77 },
-    { 340 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 86 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 82 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 82 },
-    { 60 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 60 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 88 },
-    { 340 },
-    { 340 },
-    { 100 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 61 },
-    { 89 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 98 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 91 },
-    { 340 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 90 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 91 },
-    { 340 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 92 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 91 },
-    { 340 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 91 },
-    { 93 },
-    { 94 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 96 },
-    { 340 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 95 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 96 },
-    { 340 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 97 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 96 },
-    { 340 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 96 },
-    { 93 },
-    { 98 },
-    { 98 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 98 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 99 },
-    { 98 },
-    { 100 },
-    { 100 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 100 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 101 },
-    { 100 },
-    { 37 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 37 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 38 },
-    { 104 },
-    { 104 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 104 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 106 },
-    { 108 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 105 },
-    { 104 },
-    { 104 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 104 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 105 },
-    { 104 },
-    { 106 },
-    { 106 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 106 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 107 },
-    { 106 },
-    { 108 },
-    { 108 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 108 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 109 },
-    { 108 },
-    { 111 },
-    { 111 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 111 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 113 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 112 },
-    { 111 },
-    { 111 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 111 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 112 },
-    { 111 },
-    { 113 },
-    { 113 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 113 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 114 },
-    { 113 },
-    { 116 },
-    { 116 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 116 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 118 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 117 },
-    { 116 },
-    { 116 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 116 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 117 },
-    { 116 },
-    { 118 },
-    { 118 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 118 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 119 },
-    { 118 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 122 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 123 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 124 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 125 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 126 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 127 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 129 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 133 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 130 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 131 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 132 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 134 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 135 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 136 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 137 },
-    { 52 },
-    { 52 },
-    { 139 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 138 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 140 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 142 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 143 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 144 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 146 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 147 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 148 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 149 },
-    { 52 },
-    { 151 },
-    { 52 },
-    { 52 },
-    { 153 },
-    { 52 },
-    { 155 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 150 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 152 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 154 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 157 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 160 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 158 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 159 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 161 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 162 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 164 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 165 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 166 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 167 },
-    { 52 },
-    { 169 },
-    { 52 },
-    { 52 },
-    { 171 },
-    { 52 },
-    { 173 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 168 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 170 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 172 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 175 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 176 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 177 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 179 },
-    { 179 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 179 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 180 },
-    { 179 },
-    { 179 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 179 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 180 },
-    { 179 },
-    { 34 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 184 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 185 },
-    { 52 },
-    { 198 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 186 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 187 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 188 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 189 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 190 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 191 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 192 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 193 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 194 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 196 },
-    { 340 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 195 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 197 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 199 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 200 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 201 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 202 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 203 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 204 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 205 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 206 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 208 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 209 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 210 },
-    { 210 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 210 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 211 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 210 },
-    { 210 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 210 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 211 },
-    { 210 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 213 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 214 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 215 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 216 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 218 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 219 },
-    { 219 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 219 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 220 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 219 },
-    { 219 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 219 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 220 },
-    { 219 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 222 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 223 },
-    { 223 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 223 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 224 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 223 },
-    { 223 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 223 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 224 },
-    { 223 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 226 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 227 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 228 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 229 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 230 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 231 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 232 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 233 },
-    { 233 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 233 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 234 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 233 },
-    { 233 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 233 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 234 },
-    { 233 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 236 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 237 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 238 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 239 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 240 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 241 },
-    { 241 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 241 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 242 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 241 },
-    { 241 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 241 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 242 },
-    { 241 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 244 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 247 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 245 },
-    { 245 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 245 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 246 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 245 },
-    { 245 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 245 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 246 },
-    { 245 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 248 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 249 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 250 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 251 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 252 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 253 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 254 },
-    { 254 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 254 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 255 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 254 },
-    { 254 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 254 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 255 },
-    { 254 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 257 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 258 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 259 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 260 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 261 },
-    { 261 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 261 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 262 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 261 },
-    { 261 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 261 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 262 },
-    { 261 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 264 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 268 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 265 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 266 },
-    { 266 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 266 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 267 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 266 },
-    { 266 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 266 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 267 },
-    { 266 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 269 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 270 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 272 },
-    { 52 },
-    { 275 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 273 },
-    { 273 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 273 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 274 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 273 },
-    { 273 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 273 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 274 },
-    { 273 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 276 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 277 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 278 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 279 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 280 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 281 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 282 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 283 },
-    { 283 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 283 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 284 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 283 },
-    { 283 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 283 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 284 },
-    { 283 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 286 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 287 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 288 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 289 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 290 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 291 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 292 },
-    { 292 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 292 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 293 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 292 },
-    { 292 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 292 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 293 },
-    { 292 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 295 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 300 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 296 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 297 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 298 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 299 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 301 },
-    { 301 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 301 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 302 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 301 },
-    { 301 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 301 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 302 },
-    { 301 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 304 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 305 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 306 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 307 },
-    { 307 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 307 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 308 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 307 },
-    { 307 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 307 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 308 },
-    { 307 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 310 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 311 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 312 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 314 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 315 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 316 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 317 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 318 },
-    { 318 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 318 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 319 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 318 },
-    { 318 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 318 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 319 },
-    { 318 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 321 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 322 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 323 },
-    { 323 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 323 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 231 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 12 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 13 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 231 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 12 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 13 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 231 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 20 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 23 },
+    { 23 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 24 },
+    { 22 },
+    { 22 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 23 },
+    { 23 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 25 },
+    { 25 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 25 },
+    { 25 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 23 },
+    { 23 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 24 },
+    { 22 },
+    { 22 },
+    { 231 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 20 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 29 },
+    { 29 },
+    { 221 },
+    { 221 },
+    { 29 },
+    { 29 },
+    { 221 },
+    { 221 },
+    { 29 },
+    { 29 },
+    { 221 },
+    { 221 },
+    { 29 },
+    { 29 },
+    { 221 },
+    { 221 },
+    { 29 },
+    { 29 },
+    { 221 },
+    { 221 },
+    { 29 },
+    { 29 },
+    { 221 },
+    { 221 },
+    { 29 },
+    { 29 },
+    { 221 },
+    { 221 },
+    { 29 },
+    { 29 },
+    { 221 },
+    { 221 },
+    { 231 },
+    { 30 },
+    { 31 },
+    { 32 },
+    { 31 },
+    { 40 },
+    { 43 },
+    { 44 },
+    { 46 },
     { 52 },
+    { 54 },
+    { 55 },
+    { 33 },
     { 52 },
     { 52 },
+    { 57 },
+    { 59 },
+    { 30 },
+    { 62 },
+    { 65 },
+    { 71 },
+    { 71 },
+    { 72 },
+    { 34 },
+    { 83 },
+    { 90 },
+    { 95 },
+    { 30 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 100 },
+    { 102 },
+    { 37 },
+    { 103 },
+    { 118 },
+    { 48 },
+    { 123 },
+    { 127 },
+    { 131 },
+    { 48 },
+    { 141 },
+    { 48 },
+    { 149 },
+    { 48 },
+    { 162 },
+    { 48 },
+    { 169 },
+    { 174 },
+    { 188 },
+    { 197 },
+    { 48 },
+    { 201 },
+    { 48 },
+    { 207 },
+    { 214 },
+    { 219 },
+    { 39 },
+    { 231 },
+    { 231 },
+    { 31 },
+    { 32 },
+    { 31 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 33 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 34 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 38 },
+    { 37 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 39 },
+    { 231 },
+    { 231 },
+    { 32 },
+    { 32 },
+    { 32 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 33 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 34 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 36 },
+    { 37 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 34 },
+    { 34 },
+    { 34 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 34 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 35 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 34 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 32 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 31 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 41 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 41 },
+    { 41 },
+    { 41 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 42 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 41 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 44 },
+    { 231 },
+    { 44 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 45 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 44 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 47 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 50 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 51 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 47 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 52 },
     { 52 },
     { 52 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 53 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 340 },
-    { 324 },
-    { 340 },
-    { 340 },
-    { 52 },
-    { 340 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 52 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 55 },
+    { 55 },
+    { 55 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 56 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 55 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 57 },
+    { 57 },
+    { 57 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 58 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 57 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 52 },
     { 52 },
     { 52 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 60 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 53 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 60 },
+    { 60 },
+    { 60 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 61 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 60 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 52 },
     { 52 },
     { 52 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 63 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 64 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 53 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 64 },
+    { 64 },
+    { 231 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 64 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 66 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 67 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 67 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 66 },
+    { 66 },
+    { 66 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 67 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 67 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 68 },
+    { 231 },
+    { 68 },
+    { 231 },
+    { 231 },
+    { 69 },
+    { 70 },
+    { 70 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 69 },
+    { 70 },
+    { 70 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 70 },
+    { 70 },
+    { 70 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 66 },
+    { 231 },
+    { 71 },
+    { 71 },
+    { 71 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 67 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 67 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 52 },
     { 52 },
     { 52 },
-    { 323 },
-    { 323 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 323 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 324 },
-    { 323 },
-    { 326 },
-    { 326 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 326 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 327 },
-    { 326 },
-    { 326 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 326 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 340 },
-    { 327 },
-    { 326 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 33 },
-    { 35 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 33 },
-    { 43 },
-    { 46 },
-    { 47 },
-    { 50 },
-    { 59 },
-    { 59 },
-    { 62 },
-    { 63 },
-    { 66 },
-    { 59 },
-    { 59 },
-    { 67 },
-    { 70 },
-    { 32 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 73 },
+    { 231 },
+    { 231 },
+    { 81 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 53 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 74 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 79 },
+    { 231 },
+    { 231 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 75 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 77 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 78 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 74 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 76 },
+    { 76 },
+    { 76 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 76 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 80 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 79 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 81 },
+    { 81 },
+    { 81 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 82 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 81 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 84 },
+    { 84 },
+    { 84 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 86 },
+    { 88 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 85 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 84 },
+    { 84 },
+    { 84 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 84 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 86 },
+    { 86 },
+    { 86 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 87 },
-    { 102 },
-    { 103 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 86 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 89 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 88 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 93 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 92 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 92 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 91 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 94 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 93 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 96 },
+    { 96 },
+    { 96 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 98 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 97 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 96 },
+    { 96 },
+    { 96 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 97 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 96 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 98 },
+    { 98 },
+    { 98 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 99 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 98 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 100 },
+    { 100 },
+    { 100 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 101 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 100 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 31 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 104 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 105 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 106 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 107 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 108 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 109 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
     { 110 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 111 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 112 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 113 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 114 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
     { 115 },
-    { 32 },
-    { 47 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 116 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 117 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 119 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
     { 120 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 121 },
-    { 120 },
-    { 120 },
-    { 120 },
+    { 121 },
+    { 121 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 122 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 121 },
+    { 121 },
+    { 121 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 122 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 121 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 124 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 125 },
+    { 125 },
+    { 125 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 126 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 125 },
+    { 125 },
+    { 125 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 126 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 125 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
     { 128 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 141 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 129 },
+    { 129 },
+    { 129 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 130 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 129 },
+    { 129 },
+    { 129 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 130 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 129 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 132 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 133 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 134 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 135 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 136 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 137 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 138 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 139 },
+    { 139 },
+    { 139 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 140 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 139 },
+    { 139 },
+    { 139 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 140 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 139 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 142 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 143 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 144 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
     { 145 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 146 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 147 },
+    { 147 },
+    { 147 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 148 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 147 },
+    { 147 },
+    { 147 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 148 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 147 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 150 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 153 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 151 },
+    { 151 },
+    { 151 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 152 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 151 },
+    { 151 },
+    { 151 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 152 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 151 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 154 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 155 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
     { 156 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 157 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 158 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 159 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 160 },
+    { 160 },
+    { 160 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 161 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 160 },
+    { 160 },
+    { 160 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 161 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 160 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
     { 163 },
-    { 174 },
-    { 120 },
-    { 120 },
-    { 120 },
-    { 120 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 164 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 165 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 166 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 167 },
+    { 167 },
+    { 167 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 168 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 167 },
+    { 167 },
+    { 167 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 168 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 167 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 170 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 171 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 172 },
+    { 172 },
+    { 172 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 173 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 172 },
+    { 172 },
+    { 172 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 173 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 172 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 175 },
+    { 48 },
     { 178 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 176 },
+    { 176 },
+    { 176 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 177 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 176 },
+    { 176 },
+    { 176 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 177 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 176 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 179 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 180 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
     { 181 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
     { 182 },
-    { 59 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
     { 183 },
-    { 32 },
-    { 207 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 184 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 185 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 186 },
+    { 186 },
+    { 186 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 187 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 186 },
+    { 186 },
+    { 186 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 187 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 186 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 189 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 190 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 191 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 192 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 193 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 194 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 195 },
+    { 195 },
+    { 195 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 196 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 195 },
+    { 195 },
+    { 195 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 196 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 195 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 198 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 199 },
+    { 199 },
+    { 199 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 200 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 199 },
+    { 199 },
+    { 199 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 200 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 199 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 202 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 203 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 204 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 205 },
+    { 205 },
+    { 205 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 206 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 205 },
+    { 205 },
+    { 205 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 206 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 205 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 208 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 209 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 210 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 211 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 212 },
+    { 212 },
+    { 212 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 213 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 212 },
+    { 212 },
+    { 212 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 213 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 212 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 215 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 216 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
     { 217 },
-    { 221 },
-    { 225 },
-    { 120 },
-    { 235 },
-    { 120 },
-    { 243 },
-    { 120 },
-    { 120 },
-    { 256 },
-    { 120 },
-    { 263 },
-    { 271 },
-    { 285 },
-    { 120 },
-    { 294 },
-    { 120 },
-    { 303 },
-    { 120 },
-    { 309 },
-    { 313 },
-    { 320 },
-    { 120 },
-    { 120 },
-    { 325 },
-    { 32 },
-    { 328 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
+    { 217 },
+    { 217 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 49 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 218 },
+    { 231 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 217 },
+    { 217 },
+    { 217 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 218 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 217 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 219 },
+    { 219 },
+    { 219 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 220 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 219 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 231 },
+    { 30 },
+    { 31 },
     { 32 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 334 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 336 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 331 },
-    { 331 },
-    { 333 },
-    { 333 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 334 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 336 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 335 },
-    { 335 },
-    { 339 },
-    { 339 },
-    { 335 },
-    { 335 },
-    { 339 },
-    { 339 },
-    { 335 },
-    { 335 },
-    { 339 },
-    { 339 },
-    { 335 },
-    { 335 },
-    { 339 },
-    { 339 },
-    { 335 },
-    { 335 },
-    { 339 },
-    { 339 },
-    { 335 },
-    { 335 },
-    { 339 },
-    { 339 },
-    { 335 },
-    { 335 },
-    { 339 },
-    { 339 },
-    { 335 },
-    { 335 },
-    { 339 },
-    { 339 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 334 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 336 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 337 },
-    { 337 },
-    { 338 },
-    { 338 },
-    { 337 },
-    { 337 },
-    { 338 },
-    { 338 },
-    { 337 },
-    { 337 },
-    { 338 },
-    { 338 },
-    { 337 },
-    { 337 },
-    { 338 },
-    { 338 },
-    { 337 },
-    { 337 },
-    { 338 },
-    { 338 },
-    { 337 },
-    { 337 },
-    { 338 },
-    { 338 },
-    { 337 },
-    { 337 },
-    { 338 },
-    { 338 },
-    { 337 },
-    { 337 },
-    { 338 },
-    { 338 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 334 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 336 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 },
-    { 332 }
+    { 31 },
+    { 40 },
+    { 43 },
+    { 44 },
+    { 46 },
+    { 52 },
+    { 54 },
+    { 55 },
+    { 33 },
+    { 52 },
+    { 52 },
+    { 57 },
+    { 59 },
+    { 30 },
+    { 62 },
+    { 65 },
+    { 71 },
+    { 71 },
+    { 72 },
+    { 34 },
+    { 83 },
+    { 90 },
+    { 95 },
+    { 30 },
+    { 48 },
+    { 48 },
+    { 48 },
+    { 100 },
+    { 102 },
+    { 37 },
+    { 103 },
+    { 118 },
+    { 48 },
+    { 123 },
+    { 127 },
+    { 131 },
+    { 48 },
+    { 141 },
+    { 48 },
+    { 149 },
+    { 48 },
+    { 162 },
+    { 48 },
+    { 169 },
+    { 174 },
+    { 188 },
+    { 197 },
+    { 48 },
+    { 201 },
+    { 48 },
+    { 207 },
+    { 214 },
+    { 219 },
+    { 39 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 231 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 226 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 228 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 223 },
+    { 223 },
+    { 225 },
+    { 225 },
+    { 231 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 226 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 228 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 227 },
+    { 231 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 226 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 228 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 229 },
+    { 229 },
+    { 230 },
+    { 230 },
+    { 229 },
+    { 229 },
+    { 230 },
+    { 230 },
+    { 229 },
+    { 229 },
+    { 230 },
+    { 230 },
+    { 229 },
+    { 229 },
+    { 230 },
+    { 230 },
+    { 229 },
+    { 229 },
+    { 230 },
+    { 230 },
+    { 229 },
+    { 229 },
+    { 230 },
+    { 230 },
+    { 229 },
+    { 229 },
+    { 230 },
+    { 230 },
+    { 229 },
+    { 229 },
+    { 230 },
+    { 230 },
+    { 231 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 231 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 },
+    { 224 }
 };
 std::size_t const Scanner::ms_transition_count_ = sizeof(Scanner::ms_transition_table_) / sizeof(*Scanner::ms_transition_table_);
 
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 58 atom classes.
+std::uint8_t const Scanner::ms_atom_class_table_[256] =
+{
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 5, 6, 7, 8, 9, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 20, 20, 20, 20, 20, 20, 21, 21, 22, 23, 24, 25, 26, 27,
+    7, 28, 28, 28, 28, 29, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 32, 33, 9, 34,
+    27, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 44, 45, 46, 47, 48,
+    49, 44, 50, 51, 52, 44, 53, 54, 55, 44, 44, 56, 27, 57, 27, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const Scanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 55, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 126, 0, 0, 0, 126, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        3, false,
+        { 48, 65, 97, 0 },
+        { 57, 70, 102, 0 }
+    },
+    {
+        {
+            0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 9, 32, 0, 0 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        3, false,
+        { 9, 32, 59, 0 },
+        { 10, 32, 59, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    },
+    {
+        {
+            254, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 11, 0, 0 },
+        { 9, 255, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 97, 0, 0, 0 },
+        { 122, 0, 0, 0 }
+    }
+};
+std::size_t const Scanner::ms_skip_set_count_ = sizeof(Scanner::ms_skip_set_table_) / sizeof(*Scanner::ms_skip_set_table_);
+
 char const *const Scanner::ms_accept_handler_regex_[] =
 {
     "{ANY}*[*]/",
@@ -26357,6 +14487,147 @@ char const *const Scanner::ms_accept_handler_regex_[] =
 };
 std::uint32_t const Scanner::ms_accept_handler_count_ = sizeof(Scanner::ms_accept_handler_regex_) / sizeof(*Scanner::ms_accept_handler_regex_);
 
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const Scanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const Scanner::ms_keyword_slot_table_[] =
+{
+    { "break", 5, 3, 33 },
+    { "Type", 4, 3, 32 },
+    { "", 0, 0, 85 },
+    { "Void", 4, 3, 18 },
+    { "", 0, 0, 85 },
+    { "Uint8", 5, 3, 26 },
+    { "void", 4, 3, 17 },
+    { "", 0, 0, 85 },
+    { "", 0, 0, 85 },
+    { "", 0, 0, 85 },
+    { "Uint16", 6, 3, 27 },
+    { "", 0, 0, 85 },
+    { "return", 6, 3, 34 },
+    { "Sint32", 6, 3, 24 },
+    { "Sint16", 6, 3, 23 },
+    { "Float32", 7, 3, 30 },
+    { "Uint64", 6, 3, 29 },
+    { "Sint64", 6, 3, 25 },
+    { "Null", 4, 3, 16 },
+    { "FALSE", 5, 3, 14 },
+    { "", 0, 0, 85 },
+    { "__nullptr__", 11, 3, 52 },
+    { "", 0, 0, 85 },
+    { "Sint8", 5, 3, 22 },
+    { "Uint32", 6, 3, 28 },
+    { "null", 4, 3, 15 },
+    { "", 0, 0, 85 },
+    { "TRUE", 4, 3, 13 },
+    { "", 0, 0, 85 },
+    { "Float64", 7, 3, 31 },
+    { "", 0, 0, 85 },
+    { "Boolean", 7, 3, 21 }
+};
+std::uint16_t const Scanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    0,
+    1,
+    1,
+    4,
+    0,
+    10,
+    0
+};
+
 // ///////////////////////////////////////////////////////////////////////
 // end of internal reflex-generated parser guts
 // ///////////////////////////////////////////////////////////////////////
@@ -26367,4 +14638,4 @@ std::uint32_t const Scanner::ms_accept_handler_count_ = sizeof(Scanner::ms_accep
 } // end namespace text
 } // end namespace barftest
 
-#line 26371 "../bin/barftest/text/Scanner.cpp"
+#line 14642 "../bin/barftest/text/Scanner.cpp"
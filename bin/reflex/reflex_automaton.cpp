@@ -2,10 +2,16 @@
 
 #include "reflex_automaton.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
+#include <map>
+#include <set>
 
 #include "barf_graph.hpp"
+#include "barf_message.hpp"
 #include "barf_regex_dfa.hpp"
+#include "barf_regex_graph.hpp"
 #include "barf_regex_nfa.hpp"
 #include "reflex_ast.hpp"
 
@@ -17,8 +23,400 @@ void GenerateNfa (Rule const &rule, Graph &graph, Uint32 start_index, Uint32 end
     Regex::GenerateNfa(*rule.m_rule_regex, graph, start_index, end_index);
 }
 
+// the keyword table's hash function, which must be kept in sync with
+// ReflexCpp_::KeywordHash_ in reflex.cpp.header.codespec.
+std::uint64_t KeywordHash (Uint32 seed, Uint32 state_machine_index, string const &text)
+{
+    // FNV-1a over the state machine index and the text, followed by a
+    // finalizer which mixes the (well-mixed) high bits into the low bits.
+    std::uint64_t hash = 14695981039346656037ull ^ seed;
+    for (Uint32 i = 0; i < 4; ++i)
+        hash = (hash ^ ((state_machine_index >> (8*i)) & 0xFF)) * 1099511628211ull;
+    for (string::const_iterator it = text.begin(), it_end = text.end(); it != it_end; ++it)
+        hash = (hash ^ Uint8(*it)) * 1099511628211ull;
+    hash ^= hash >> 32;
+    hash *= 0xD6E8FEB86659FD93ull;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+// a keyword's bucket is given by the low bits of its hash, and its slot by
+// the high bits, offset by the bucket's displacement times a (nonzero) step
+// taken from bits which the bucket index doesn't use, so that the keywords in
+// a bucket can be moved apart by choosing the displacement.
+Uint32 KeywordBucketIndex (std::uint64_t hash, Uint32 bucket_count)
+{
+    assert(bucket_count <= 0x10000);
+    return Uint32(hash) & (bucket_count - 1);
+}
+Uint32 KeywordSlotIndex (std::uint64_t hash, Uint32 displacement, Uint32 slot_count)
+{
+    return (Uint32(hash >> 32) + displacement * ((Uint32(hash) >> 16) | 1)) & (slot_count - 1);
+}
+
+typedef set<Uint32> NfaStateSet;
+
+// adds to nfa_state_set the states reachable from it by epsilon transitions,
+// and also by conditional transitions if follow_conditionals is true.
+void CloseNfaStateSet (Graph const &nfa_graph, NfaStateSet &nfa_state_set, bool follow_conditionals)
+{
+    vector<Uint32> pending(nfa_state_set.begin(), nfa_state_set.end());
+    while (!pending.empty())
+    {
+        Graph::Node const &node = nfa_graph.GetNode(pending.back());
+        pending.pop_back();
+        for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                  it_end = node.TransitionSetEnd();
+             it != it_end;
+             ++it)
+        {
+            Graph::Transition const &transition = *it;
+            if (transition.Type() == Regex::TT_EPSILON ||
+                (follow_conditionals && transition.Type() == Regex::TT_CONDITIONAL))
+            {
+                if (nfa_state_set.insert(transition.TargetIndex()).second)
+                    pending.push_back(transition.TargetIndex());
+            }
+        }
+    }
+}
+
+// returns true iff the NFA fragment from start_index to end_index matches
+// text -- unconditionally if follow_conditionals is false, and otherwise in
+// at least some context.
+bool NfaFragmentMatches (Graph const &nfa_graph, Uint32 start_index, Uint32 end_index, string const &text, bool follow_conditionals)
+{
+    NfaStateSet nfa_state_set;
+    nfa_state_set.insert(start_index);
+    CloseNfaStateSet(nfa_graph, nfa_state_set, follow_conditionals);
+    for (string::const_iterator text_it = text.begin(), text_it_end = text.end(); text_it != text_it_end; ++text_it)
+    {
+        Uint8 atom = Uint8(*text_it);
+        NfaStateSet target_set;
+        for (NfaStateSet::const_iterator state_it = nfa_state_set.begin(), state_it_end = nfa_state_set.end(); state_it != state_it_end; ++state_it)
+        {
+            Graph::Node const &node = nfa_graph.GetNode(*state_it);
+            for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                      it_end = node.TransitionSetEnd();
+                 it != it_end;
+                 ++it)
+            {
+                Graph::Transition const &transition = *it;
+                if ((transition.Type() == Regex::TT_INPUT_ATOM && transition.Data(0) == atom) ||
+                    (transition.Type() == Regex::TT_INPUT_ATOM_RANGE && transition.Data(0) <= atom && atom <= transition.Data(1)))
+                {
+                    target_set.insert(transition.TargetIndex());
+                }
+            }
+        }
+        if (target_set.empty())
+            return false;
+        CloseNfaStateSet(nfa_graph, target_set, follow_conditionals);
+        nfa_state_set.swap(target_set);
+    }
+    return nfa_state_set.find(end_index) != nfa_state_set.end();
+}
+
+// single-atom strings aren't worth extracting (they take a single DFA
+// transition anyway), and neither are rules matching very long or very many
+// strings, which aren't keywords in any reasonable sense.
+Uint32 const MIN_KEYWORD_LENGTH = 2;
+Uint32 const MAX_KEYWORD_LENGTH = 64;
+Uint32 const MAX_RULE_KEYWORD_COUNT = 4096;
+Uint32 const MAX_KEYWORD_COUNT = 0x10000;
+
+// if the NFA fragment starting at the (closed) nfa_state_set and ending at
+// end_index unconditionally matches only finitely many literal strings
+// (and prefix followed by each of them is a possible keyword), appends those
+// to keyword_text and returns true.
+bool EnumerateLiteralStrings (Graph const &nfa_graph, NfaStateSet const &nfa_state_set, Uint32 end_index, string &prefix, vector<string> &keyword_text)
+{
+    map<Uint8, NfaStateSet> target_set;
+    for (NfaStateSet::const_iterator state_it = nfa_state_set.begin(), state_it_end = nfa_state_set.end(); state_it != state_it_end; ++state_it)
+    {
+        Graph::Node const &node = nfa_graph.GetNode(*state_it);
+        for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                  it_end = node.TransitionSetEnd();
+             it != it_end;
+             ++it)
+        {
+            Graph::Transition const &transition = *it;
+            switch (transition.Type())
+            {
+                case Regex::TT_INPUT_ATOM:
+                    target_set[Uint8(transition.Data(0))].insert(transition.TargetIndex());
+                    break;
+
+                case Regex::TT_INPUT_ATOM_RANGE:
+                    for (Uint32 atom = transition.Data(0); atom <= transition.Data(1); ++atom)
+                        target_set[Uint8(atom)].insert(transition.TargetIndex());
+                    break;
+
+                case Regex::TT_CONDITIONAL:
+                    return false;
+
+                default:
+                    // epsilon transitions have already been followed.
+                    break;
+            }
+        }
+    }
+
+    if (nfa_state_set.find(end_index) != nfa_state_set.end())
+    {
+        if (prefix.size() < MIN_KEYWORD_LENGTH || keyword_text.size() >= MAX_RULE_KEYWORD_COUNT)
+            return false;
+        keyword_text.push_back(prefix);
+    }
+    if (!target_set.empty() && prefix.size() >= MAX_KEYWORD_LENGTH)
+        return false;
+
+    for (map<Uint8, NfaStateSet>::iterator it = target_set.begin(), it_end = target_set.end(); it != it_end; ++it)
+    {
+        CloseNfaStateSet(nfa_graph, it->second, false);
+        prefix.push_back(char(it->first));
+        if (!EnumerateLiteralStrings(nfa_graph, it->second, end_index, prefix, keyword_text))
+            return false;
+        prefix.erase(prefix.size() - 1);
+    }
+    return true;
+}
+
+// for ordering bucket indices by decreasing bucket size
+struct BucketSizeOrder
+{
+    vector<vector<Uint32> > const &m_bucket;
+
+    BucketSizeOrder (vector<vector<Uint32> > const &bucket) : m_bucket(bucket) { }
+
+    bool operator () (Uint32 b0, Uint32 b1) const
+    {
+        return m_bucket[b0].size() > m_bucket[b1].size();
+    }
+};
+
+// makes keyword_table's perfect hash table of keyword_list, using the "hash,
+// displace" scheme -- the keywords are hashed into buckets, and in order of
+// decreasing bucket size, each bucket's displacement is the first which puts
+// its keywords into distinct, unused slots.  returns false if no hash seed
+// worked (which should only happen for pathological keyword sets).
+bool MakeKeywordHashTable (vector<Keyword> const &keyword_list, KeywordTable &keyword_table)
+{
+    assert(!keyword_list.empty());
+    assert(keyword_list.size() <= MAX_KEYWORD_COUNT);
+
+    // a load factor between 1/3 and 2/3, with at most 4 keywords per bucket
+    // on average, makes finding displacements quick.
+    Uint32 keyword_count = keyword_list.size();
+    Uint32 slot_count = 1;
+    while (slot_count < keyword_count + keyword_count/2)
+        slot_count <<= 1;
+    Uint32 bucket_count = 1;
+    while (bucket_count < (keyword_count + 3) / 4)
+        bucket_count <<= 1;
+
+    for (Uint32 seed = 0; seed < 32; ++seed)
+    {
+        vector<std::uint64_t> hash(keyword_count);
+        vector<vector<Uint32> > bucket(bucket_count);
+        for (Uint32 i = 0; i < keyword_count; ++i)
+        {
+            hash[i] = KeywordHash(seed, keyword_list[i].m_state_machine_index, keyword_list[i].m_text);
+            bucket[KeywordBucketIndex(hash[i], bucket_count)].push_back(i);
+        }
+        vector<Uint32> bucket_order(bucket_count);
+        for (Uint32 b = 0; b < bucket_count; ++b)
+            bucket_order[b] = b;
+        stable_sort(bucket_order.begin(), bucket_order.end(), BucketSizeOrder(bucket));
+
+        vector<Sint32> slot_keyword(slot_count, -1);
+        vector<Uint16> displacement(bucket_count, 0);
+        bool all_buckets_placed = true;
+        for (vector<Uint32>::const_iterator bucket_it = bucket_order.begin(), bucket_it_end = bucket_order.end();
+             bucket_it != bucket_it_end && !bucket[*bucket_it].empty();
+             ++bucket_it)
+        {
+            vector<Uint32> const &keywords_in_bucket = bucket[*bucket_it];
+            vector<Uint32> slot(keywords_in_bucket.size());
+            bool bucket_placed = false;
+            for (Uint32 d = 0; d <= UINT16_UPPER_BOUND && !bucket_placed; ++d)
+            {
+                bucket_placed = true;
+                for (Uint32 k = 0; k < keywords_in_bucket.size() && bucket_placed; ++k)
+                {
+                    slot[k] = KeywordSlotIndex(hash[keywords_in_bucket[k]], d, slot_count);
+                    bucket_placed = slot_keyword[slot[k]] < 0 && find(slot.begin(), slot.begin() + k, slot[k]) == slot.begin() + k;
+                }
+                if (bucket_placed)
+                {
+                    displacement[*bucket_it] = Uint16(d);
+                    for (Uint32 k = 0; k < keywords_in_bucket.size(); ++k)
+                        slot_keyword[slot[k]] = keywords_in_bucket[k];
+                }
+            }
+            if (!bucket_placed)
+            {
+                all_buckets_placed = false;
+                break;
+            }
+        }
+        if (!all_buckets_placed)
+            continue;
+
+        keyword_table.m_hash_seed = seed;
+        keyword_table.m_displacement.swap(displacement);
+        keyword_table.m_slot.resize(slot_count);
+        for (Uint32 slot = 0; slot < slot_count; ++slot)
+        {
+            if (slot_keyword[slot] >= 0)
+                keyword_table.m_slot[slot] = keyword_list[slot_keyword[slot]];
+            else
+            {
+                keyword_table.m_slot[slot].m_state_machine_index = 0;
+                keyword_table.m_slot[slot].m_accept_handler_index = UINT32_UPPER_BOUND;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+void ExtractKeywords (StateMachine const &state_machine, Uint32 state_machine_index, Uint32 first_accept_handler_index, KeywordTable &keyword_table, vector<Keyword> &keyword_list)
+{
+    // in case-insensitive state machines, letters are matched by the DFA
+    // (not the NFA) regardless of case, so their rules are left alone.
+    if ((state_machine.m_mode_flags & StateMachine::MF_CASE_INSENSITIVE) != 0)
+        return;
+
+    // the NFA of each rule on its own, laid out like the NFA of the state
+    // machine, with the accept states first.
+    Uint32 rule_count = state_machine.RuleCount();
+    Graph nfa_graph;
+    for (Uint32 i = 0; i < rule_count; ++i)
+        nfa_graph.AddNode(new Regex::NodeData(Regex::NOT_START_NODE, Regex::IS_ACCEPT_NODE));
+    vector<Uint32> rule_start_index(rule_count);
+    for (Uint32 i = 0; i < rule_count; ++i)
+    {
+        Rule const *rule = state_machine.m_rule_list->Element(i);
+        assert(rule != NULL);
+        rule_start_index[i] = nfa_graph.AddNode(new Regex::NodeData(Regex::IS_START_NODE, Regex::NOT_ACCEPT_NODE));
+        GenerateNfa(*rule, nfa_graph, rule_start_index[i], i);
+    }
+
+    // a rule's strings can be extracted if each is matched by a later rule
+    // which isn't extracted, since then the DFA of the other rules accepts
+    // exactly the same strings (though some by a lower-priority rule), so
+    // looking up each of the rule's strings after it's accepted gives the
+    // same result as the full DFA.  whether a rule is extracted only depends
+    // on the later rules, so the rules are considered last to first.
+    vector<vector<string> > rule_keyword_text(rule_count);
+    for (Uint32 i = rule_count; i-- > 0; )
+    {
+        NfaStateSet nfa_state_set;
+        nfa_state_set.insert(rule_start_index[i]);
+        CloseNfaStateSet(nfa_graph, nfa_state_set, false);
+        string prefix;
+        vector<string> keyword_text;
+        if (!EnumerateLiteralStrings(nfa_graph, nfa_state_set, i, prefix, keyword_text) || keyword_text.empty())
+            continue;
+
+        bool is_covered = true;
+        for (vector<string>::const_iterator it = keyword_text.begin(), it_end = keyword_text.end(); it != it_end && is_covered; ++it)
+        {
+            is_covered = false;
+            for (Uint32 j = i+1; j < rule_count && !is_covered; ++j)
+                is_covered = !keyword_table.m_accept_handler_is_extracted[first_accept_handler_index+j] &&
+                             NfaFragmentMatches(nfa_graph, rule_start_index[j], j, *it, false);
+        }
+        if (!is_covered)
+            continue;
+
+        keyword_table.m_accept_handler_is_extracted[first_accept_handler_index+i] = true;
+        rule_keyword_text[i].swap(keyword_text);
+    }
+
+    // if a string is extracted from more than one rule, only the first of
+    // them could ever accept it.
+    map<string, Uint32> keyword_rule;
+    for (Uint32 i = rule_count; i-- > 0; )
+        for (vector<string>::const_iterator it = rule_keyword_text[i].begin(), it_end = rule_keyword_text[i].end(); it != it_end; ++it)
+            keyword_rule[*it] = i;
+
+    // the strings accepted by a rule must be looked up if they may include a
+    // keyword of a higher-priority (earlier) rule.  this is conservative;
+    // conditionals are assumed to be met.
+    for (map<string, Uint32>::const_iterator it = keyword_rule.begin(), it_end = keyword_rule.end(); it != it_end; ++it)
+    {
+        Keyword keyword;
+        keyword.m_text = it->first;
+        keyword.m_state_machine_index = state_machine_index;
+        keyword.m_accept_handler_index = first_accept_handler_index + it->second;
+        keyword_list.push_back(keyword);
+
+        for (Uint32 j = it->second+1; j < rule_count; ++j)
+        {
+            Uint32 &keyword_state_machine_index = keyword_table.m_accept_handler_keyword_state_machine_index[first_accept_handler_index+j];
+            if (!keyword_table.m_accept_handler_is_extracted[first_accept_handler_index+j] &&
+                keyword_state_machine_index == KeywordTable::ms_no_state_machine &&
+                NfaFragmentMatches(nfa_graph, rule_start_index[j], j, it->first, true))
+            {
+                keyword_state_machine_index = state_machine_index;
+            }
+        }
+    }
+}
+
+// makes keyword_table empty, with no rules extracted.
+void ClearKeywordTable (Uint32 rule_count, KeywordTable &keyword_table)
+{
+    keyword_table = KeywordTable();
+    keyword_table.m_accept_handler_is_extracted.resize(rule_count, false);
+    keyword_table.m_accept_handler_keyword_state_machine_index.resize(rule_count, Uint32(KeywordTable::ms_no_state_machine));
+}
+
+void ExtractKeywords (PrimarySource const &primary_source, KeywordTable &keyword_table)
+{
+    ClearKeywordTable(primary_source.RuleCount(), keyword_table);
+
+    vector<Keyword> keyword_list;
+    Uint32 state_machine_index = 0;
+    Uint32 first_accept_handler_index = 0;
+    for (StateMachineMap::const_iterator it = primary_source.m_state_machine_map->begin(),
+                                        it_end = primary_source.m_state_machine_map->end();
+         it != it_end;
+         ++it)
+    {
+        StateMachine const *state_machine = it->second;
+        assert(state_machine != NULL);
+        ExtractKeywords(*state_machine, state_machine_index, first_accept_handler_index, keyword_table, keyword_list);
+        ++state_machine_index;
+        first_accept_handler_index += state_machine->RuleCount();
+    }
+    assert(first_accept_handler_index == primary_source.RuleCount());
+
+    if (keyword_list.empty())
+        return;
+    if (keyword_list.size() > MAX_KEYWORD_COUNT || !MakeKeywordHashTable(keyword_list, keyword_table))
+    {
+        EmitExecutionMessage("could not make a perfect hash table of the keywords; leaving them in the NFA");
+        ClearKeywordTable(primary_source.RuleCount(), keyword_table);
+        return;
+    }
+
+    keyword_table.m_keyword_count = keyword_list.size();
+    keyword_table.m_min_keyword_length = MAX_KEYWORD_LENGTH;
+    keyword_table.m_max_keyword_length = 0;
+    for (vector<Keyword>::const_iterator it = keyword_list.begin(), it_end = keyword_list.end(); it != it_end; ++it)
+    {
+        keyword_table.m_min_keyword_length = min(keyword_table.m_min_keyword_length, Uint32(it->m_text.size()));
+        keyword_table.m_max_keyword_length = max(keyword_table.m_max_keyword_length, Uint32(it->m_text.size()));
+    }
+    EmitExecutionMessage(FORMAT("extracted " << keyword_table.m_keyword_count << " keyword(s) from " << count(keyword_table.m_accept_handler_is_extracted.begin(), keyword_table.m_accept_handler_is_extracted.end(), true) << " rule(s) into a perfect hash table"));
+}
+
 void GenerateNfa (
     StateMachine const &state_machine,
+    KeywordTable const &keyword_table,
     Automaton &nfa,
 //     Graph &nfa_graph,
 //     vector<Uint32> &nfa_start_state_index,
@@ -33,7 +431,9 @@ void GenerateNfa (
     nfa.m_start_state_index.push_back(master_start_state_index);
 
     // each rule is effectively or'ed together (i.e. using regex operator '|')
-    // except that each rule ends alone at its own accept state.
+    // except that each rule ends alone at its own accept state.  the rules
+    // extracted into the keyword table are left out, leaving their accept
+    // states unreachable.
     for (RuleList::const_iterator it = state_machine.m_rule_list->begin(),
                                   it_end = state_machine.m_rule_list->end();
          it != it_end;
@@ -41,14 +441,17 @@ void GenerateNfa (
     {
         Rule const *rule = *it;
         assert(rule != NULL);
-        GenerateNfa(*rule, nfa.m_graph, master_start_state_index, next_accept_handler_index++);
+        if (!keyword_table.m_accept_handler_is_extracted[next_accept_handler_index])
+            GenerateNfa(*rule, nfa.m_graph, master_start_state_index, next_accept_handler_index);
+        ++next_accept_handler_index;
     }
 }
 
-void GenerateNfa (PrimarySource const &primary_source, Automaton &nfa)
+void GenerateNfa (PrimarySource const &primary_source, KeywordTable const &keyword_table, Automaton &nfa)
 {
     assert(nfa.m_graph.NodeCount() == 0);
     assert(nfa.m_start_state_index.empty());
+    assert(keyword_table.m_accept_handler_is_extracted.size() == primary_source.RuleCount());
 
     // pre-allocate all the accept handler state nodes, because the first
     // contiguous block of N nodes are reserved for accept states (where N
@@ -73,18 +476,22 @@ void GenerateNfa (PrimarySource const &primary_source, Automaton &nfa)
     {
         StateMachine const *state_machine = it->second;
         assert(state_machine != NULL);
-        GenerateNfa(*state_machine, nfa, next_accept_handler_index);
+        GenerateNfa(*state_machine, keyword_table, nfa, next_accept_handler_index);
     }
 
     assert(nfa.m_graph.NodeCount() >= primary_source.m_state_machine_map->size());
     assert(nfa.m_start_state_index.size() == primary_source.m_state_machine_map->size());
 }
 
-void GenerateDfa (PrimarySource const &primary_source, Automaton const &nfa, Uint32 nfa_accept_state_count, Automaton &dfa)
+void GenerateDfa (PrimarySource const &primary_source, Automaton const &nfa, Uint32 nfa_accept_state_count, Automaton &dfa, Uint32 thread_count)
 {
     assert(dfa.m_graph.NodeCount() == 0);
     assert(dfa.m_start_state_index.empty());
-    Regex::GenerateDfa(nfa, nfa_accept_state_count, dfa);
+    EmitExecutionMessage(FORMAT("generating DFA for " << nfa.m_start_state_index.size() << " state machine(s) using up to " << thread_count << " thread(s)"));
+    Automaton unminimized_dfa;
+    Regex::GenerateDfa(nfa, nfa_accept_state_count, unminimized_dfa, thread_count);
+    Regex::MinimizeDfa(unminimized_dfa, dfa);
+    EmitExecutionMessage(FORMAT("minimized DFA from " << unminimized_dfa.m_graph.NodeCount() << " to " << dfa.m_graph.NodeCount() << " states"));
     assert(dfa.m_graph.NodeCount() >= primary_source.m_state_machine_map->size());
     assert(dfa.m_start_state_index.size() == primary_source.m_state_machine_map->size());
 }
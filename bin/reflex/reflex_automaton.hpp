@@ -5,6 +5,7 @@
 
 #include "reflex.hpp"
 
+#include <string>
 #include <vector>
 
 namespace Barf {
@@ -18,8 +19,49 @@ namespace Reflex {
 
 struct PrimarySource;
 
-void GenerateNfa (PrimarySource const &primary_source, Automaton &nfa);
-void GenerateDfa (PrimarySource const &primary_source, Automaton const &nfa, Uint32 nfa_accept_state_count, Automaton &dfa);
+// a literal string matched by a rule whose regex only matches finitely many
+// literal strings (e.g. "while" or "if|else"), each of which is also matched
+// (unconditionally) by a later rule of the same state machine (e.g. an
+// identifier rule).  such rules are left out of the NFA, and instead the
+// strings accepted by the later rules are looked up in a perfect hash table
+// of the keywords, which yields the same accept handler as the full DFA would,
+// since the keyword's rule has the higher priority.
+struct Keyword
+{
+    string m_text;
+    Uint32 m_state_machine_index;
+    Uint32 m_accept_handler_index;
+};
+
+struct KeywordTable
+{
+    static Uint32 const ms_no_state_machine = UINT32_UPPER_BOUND;
+
+    // indexed by accept handler index -- true iff the rule was left out of
+    // the NFA.
+    vector<bool> m_accept_handler_is_extracted;
+    // indexed by accept handler index -- the index of the state machine
+    // whose keywords the strings accepted by the rule must be looked up in,
+    // or ms_no_state_machine if none of them can be keywords of higher priority.
+    vector<Uint32> m_accept_handler_keyword_state_machine_index;
+    // the slots of the perfect hash table -- a slot with empty text is
+    // unused.  the slot count is a power of 2.
+    vector<Keyword> m_slot;
+    // the displacement of each bucket of keywords (see KeywordSlotIndex).
+    // the bucket count is a power of 2.
+    vector<Uint16> m_displacement;
+    Uint32 m_hash_seed;
+    Uint32 m_keyword_count;
+    Uint32 m_min_keyword_length;
+    Uint32 m_max_keyword_length;
+
+    KeywordTable () : m_hash_seed(0), m_keyword_count(0), m_min_keyword_length(0), m_max_keyword_length(0) { }
+}; // end of struct KeywordTable
+
+void ClearKeywordTable (Uint32 rule_count, KeywordTable &keyword_table);
+void ExtractKeywords (PrimarySource const &primary_source, KeywordTable &keyword_table);
+void GenerateNfa (PrimarySource const &primary_source, KeywordTable const &keyword_table, Automaton &nfa);
+void GenerateDfa (PrimarySource const &primary_source, Automaton const &nfa, Uint32 nfa_accept_state_count, Automaton &dfa, Uint32 thread_count);
 
 } // end of namespace Reflex
 
@@ -2,12 +2,17 @@
 
 #include "reflex_codespecsymbols.hpp"
 
+#include <algorithm>
+#include <map>
+#include <sstream>
+
 #include "barf_graph.hpp"
 #include "barf_preprocessor_ast.hpp"
 #include "barf_preprocessor_symboltable.hpp"
 #include "barf_regex_graph.hpp"
 #include "barf_regex_nfa.hpp"
 #include "reflex_ast.hpp"
+#include "reflex_automaton.hpp"
 
 namespace Reflex {
 
@@ -212,8 +217,9 @@ void GenerateNfaSymbols (PrimarySource const &primary_source, Graph const &nfa_g
                     new Preprocessor::Body(Regex::TransitionTypeString(transition.Type())));
                 nfa_transition_data_0->AppendArrayElement(
                     new Preprocessor::Body(Sint32(transition.Data(0))));
+                // single-valued transitions only store data 0.
                 nfa_transition_data_1->AppendArrayElement(
-                    new Preprocessor::Body(Sint32(transition.Data(1))));
+                    new Preprocessor::Body(Sint32(transition.DataCount() == 1 ? transition.Data(0) : transition.Data(1))));
                 nfa_transition_target_node_index->AppendArrayElement(
                     new Preprocessor::Body(Sint32(transition.TargetIndex())));
 
@@ -234,6 +240,397 @@ void GenerateNfaSymbols (PrimarySource const &primary_source, Graph const &nfa_g
     }
 }
 
+// determines the mode flags and reachability of each DFA state by traversing
+// the DFA from each state machine's initial state (no DFA state is reachable
+// from the initial states of more than one state machine).  the traversal stops
+// at accept states in ungreedy state machines, so any state not visited has no
+// mode flags and is unreachable.
+void ComputeDfaNodeModeFlagsAndReachability (
+    PrimarySource const &primary_source,
+    Graph const &dfa_graph,
+    vector<Uint32> const &dfa_start_state_index,
+    vector<StateMachine::ModeFlags> &node_mode_flags,
+    vector<bool> &node_is_reachable)
+{
+    node_mode_flags.clear();
+    node_mode_flags.resize(dfa_graph.NodeCount(), StateMachine::MF_NONE);
+    node_is_reachable.clear();
+    node_is_reachable.resize(dfa_graph.NodeCount(), false);
+
+    Uint32 state_index = 0;
+    for (StateMachineMap::const_iterator it = primary_source.m_state_machine_map->begin(),
+                                        it_end = primary_source.m_state_machine_map->end();
+        it != it_end;
+        ++it)
+    {
+        StateMachine const *state_machine = it->second;
+        assert(state_machine != NULL);
+        assert(state_index < dfa_start_state_index.size());
+        vector<Uint32> node_stack(1, dfa_start_state_index[state_index]);
+        node_is_reachable[dfa_start_state_index[state_index]] = true;
+        while (!node_stack.empty())
+        {
+            Uint32 node_index = node_stack.back();
+            node_stack.pop_back();
+            node_mode_flags[node_index] = state_machine->m_mode_flags;
+            if ((state_machine->m_mode_flags & StateMachine::MF_UNGREEDY) != 0 &&
+                dfa_graph.GetNode(node_index).DataAs<Regex::NodeData>().m_is_accept_node)
+            {
+                continue;
+            }
+            Graph::Node const &node = dfa_graph.GetNode(node_index);
+            for (Graph::TransitionSet::const_iterator trans_it = node.TransitionSetBegin(),
+                                                      trans_it_end = node.TransitionSetEnd();
+                 trans_it != trans_it_end;
+                 ++trans_it)
+            {
+                if (!node_is_reachable[trans_it->TargetIndex()])
+                {
+                    node_is_reachable[trans_it->TargetIndex()] = true;
+                    node_stack.push_back(trans_it->TargetIndex());
+                }
+            }
+        }
+        ++state_index;
+    }
+}
+
+// fills in target_index with the index of the node transitioned to by each
+// input atom (or by each combination of conditional flags, in which case only
+// the first 1<<Regex::CT_FLAG_COUNT elements are used) from the given node.
+// values having no transition are given the sentinel value dfa_graph.NodeCount().
+// if the node's state machine is case-insensitive, atoms having no transition
+// use the transition of the switched-case atom, so that the scanner doesn't
+// have to check for this at runtime.  returns true iff the node's transitions
+// are conditional.
+bool ComputeDfaNodeTargetIndices (
+    Graph const &dfa_graph,
+    Uint32 node_index,
+    StateMachine::ModeFlags mode_flags,
+    Uint32 target_index[256])
+{
+    Graph::Node const &node = dfa_graph.GetNode(node_index);
+    bool is_conditional = node.TransitionCount() > 0 && node.TransitionSetBegin()->Type() == Regex::TT_CONDITIONAL;
+
+    for (Uint32 i = 0; i < 256; ++i)
+        target_index[i] = dfa_graph.NodeCount(); // sentinel value is the node count (= _dfa_state_count)
+    for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                              it_end = node.TransitionSetEnd();
+         it != it_end;
+         ++it)
+    {
+        Graph::Transition const &transition = *it;
+        switch (transition.Type())
+        {
+            case Regex::TT_INPUT_ATOM:
+                assert(!is_conditional);
+                assert(transition.Data(0) < 256);
+                target_index[transition.Data(0)] = transition.TargetIndex();
+                break;
+
+            case Regex::TT_INPUT_ATOM_RANGE:
+                assert(!is_conditional);
+                assert(transition.Data(0) < transition.Data(1));
+                assert(transition.Data(1) < 256);
+                for (Uint32 i = transition.Data(0); i <= transition.Data(1); ++i)
+                    target_index[i] = transition.TargetIndex();
+                break;
+
+            case Regex::TT_CONDITIONAL:
+                assert(is_conditional);
+                assert(transition.Data(0) < (1<<Regex::CT_FLAG_COUNT));
+                assert(transition.Data(1) < (1<<Regex::CT_FLAG_COUNT));
+                for (Uint32 flags = 0; flags < (1<<Regex::CT_FLAG_COUNT); ++flags)
+                {
+                    // data 0 is the bitmask, data 1 is the flag values
+                    if ((flags & transition.Data(0)) == transition.Data(1))
+                    {
+                        assert(target_index[flags] == dfa_graph.NodeCount());
+                        target_index[flags] = transition.TargetIndex();
+                    }
+                }
+                break;
+
+            case Regex::TT_EPSILON:
+            default:
+                assert(false && "should not happen in DFA");
+                break;
+        }
+    }
+
+    if (!is_conditional && (mode_flags & StateMachine::MF_CASE_INSENSITIVE) != 0)
+    {
+        for (Uint32 i = 'a'; i <= 'z'; ++i)
+        {
+            Uint32 switched_i = i - 'a' + 'A';
+            if (target_index[i] == dfa_graph.NodeCount())
+                target_index[i] = target_index[switched_i];
+            else if (target_index[switched_i] == dfa_graph.NodeCount())
+                target_index[switched_i] = target_index[i];
+        }
+    }
+
+    return is_conditional;
+}
+
+// fills in transitions with the list of transitions of the given node.  the
+// transitions of an INPUT_ATOM node are rebuilt from its lookup table (see
+// ComputeDfaNodeTargetIndices) as maximal ranges of atoms, so that the
+// case-insensitivity of its state machine is already incorporated into them,
+// and the scanner only has to check each transition against the input atom
+// itself.  the transitions of a CONDITIONAL node are used as-is.
+void ComputeDfaNodeTransitions (
+    Graph const &dfa_graph,
+    Uint32 node_index,
+    StateMachine::ModeFlags mode_flags,
+    vector<Graph::Transition> &transitions)
+{
+    transitions.clear();
+    Graph::Node const &node = dfa_graph.GetNode(node_index);
+    Uint32 target_index[256];
+    if (node.TransitionCount() > 0 &&
+        !ComputeDfaNodeTargetIndices(dfa_graph, node_index, mode_flags, target_index))
+    {
+        for (Uint32 i = 0; i < 256; )
+        {
+            Uint32 target = target_index[i];
+            Uint32 lower = i;
+            while (i < 256 && target_index[i] == target)
+                ++i;
+            if (target == dfa_graph.NodeCount())
+                continue;
+            if (lower == i - 1)
+                transitions.push_back(Regex::InputAtomTransition(Uint8(lower), target));
+            else
+                transitions.push_back(Regex::InputAtomRangeTransition(Uint8(lower), Uint8(i - 1), target));
+        }
+    }
+    else
+        transitions.insert(transitions.end(), node.TransitionSetBegin(), node.TransitionSetEnd());
+}
+
+// computes the atom classes of the DFA, where two input atoms are in the same
+// atom class iff every state transitions identically on them.  this starts with
+// a single class and then successively refines the partition using each state's
+// lookup table; two atoms stay in the same class only if they're in the same
+// class already and the state transitions identically on them.  assigning the
+// new class numbers in ascending atom order keeps the classes ordered by their
+// lowest atom.  fills in atom_class and returns the number of atom classes.
+Uint32 ComputeDfaAtomClasses (
+    Graph const &dfa_graph,
+    vector<StateMachine::ModeFlags> const &node_mode_flags,
+    Uint32 atom_class[256])
+{
+    Uint32 atom_class_count = 1;
+    for (Uint32 i = 0; i < 256; ++i)
+        atom_class[i] = 0;
+    for (Uint32 node_index = 0; node_index < dfa_graph.NodeCount(); ++node_index)
+    {
+        Uint32 target_index[256];
+        if (dfa_graph.GetNode(node_index).TransitionCount() == 0 ||
+            ComputeDfaNodeTargetIndices(dfa_graph, node_index, node_mode_flags[node_index], target_index))
+        {
+            continue;
+        }
+
+        map<pair<Uint32, Uint32>, Uint32> refined_class;
+        for (Uint32 i = 0; i < 256; ++i)
+        {
+            pair<Uint32, Uint32> key(atom_class[i], target_index[i]);
+            map<pair<Uint32, Uint32>, Uint32>::iterator it = refined_class.find(key);
+            if (it == refined_class.end())
+                it = refined_class.insert(make_pair(key, Uint32(refined_class.size()))).first;
+            atom_class[i] = it->second;
+        }
+        atom_class_count = Uint32(refined_class.size());
+    }
+    assert(atom_class_count >= 1 && atom_class_count <= 256);
+    return atom_class_count;
+}
+
+// fills in row with the 'fast' lookup table of the given node -- the index of
+// the node transitioned to for each atom class, or for each combination of
+// conditional flags if the node's transitions are conditional.  row is left
+// empty if the node has no transitions.  returns true iff the node's
+// transitions are conditional.
+bool ComputeDfaNodeFastTransitionRow (
+    Graph const &dfa_graph,
+    Uint32 node_index,
+    StateMachine::ModeFlags mode_flags,
+    Uint32 const atom_class[256],
+    Uint32 atom_class_count,
+    vector<Uint32> &row)
+{
+    row.clear();
+    if (dfa_graph.GetNode(node_index).TransitionCount() == 0)
+        return false;
+
+    Uint32 target_index[256];
+    bool is_conditional = ComputeDfaNodeTargetIndices(dfa_graph, node_index, mode_flags, target_index);
+    if (is_conditional)
+    {
+        row.insert(row.end(), target_index, target_index + (1<<Regex::CT_FLAG_COUNT));
+    }
+    else
+    {
+        // the atoms in each class have the same target, so the lowest
+        // atom in each class can be used as its representative.
+        for (Uint32 i = 0; i < 256; ++i)
+        {
+            if (atom_class[i] == row.size())
+                row.push_back(target_index[i]);
+            else
+                assert(atom_class[i] < row.size());
+        }
+        assert(row.size() == atom_class_count);
+    }
+    return is_conditional;
+}
+
+// returns the size in bytes of the narrowest unsigned integer type which can
+// hold every value in [0, max_value], as chosen by the cpp target for the
+// fields of its DFA tables.
+Uint32 IndexByteCount (Uint32 max_value)
+{
+    if (max_value < 0x100)
+        return 1;
+    if (max_value < 0x10000)
+        return 2;
+    return 4;
+}
+
+// returns the size in bytes of a struct having fields of the given sizes (in
+// the given order), where each field is aligned to its own size.
+Uint32 StructByteCount (vector<Uint32> const &field_sizes)
+{
+    Uint32 size = 0;
+    Uint32 alignment = 1;
+    for (vector<Uint32>::const_iterator it = field_sizes.begin(), it_end = field_sizes.end(); it != it_end; ++it)
+    {
+        size = (size + *it - 1) / *it * *it + *it;
+        alignment = max(alignment, *it);
+    }
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+void GenerateKeywordSymbols (PrimarySource const &primary_source, KeywordTable const &keyword_table, Preprocessor::SymbolTable &symbol_table)
+{
+    EmitExecutionMessage("generating keyword table codespec symbols");
+
+    // _keyword_count -- the number of keywords (literal strings of rules which
+    // were left out of the NFA, since later rules match them too; see
+    // Reflex::KeywordTable).  if this is 0, none of the other _keyword_
+    // symbols are defined (though _accept_handler_keyword_state_machine_index
+    // is).
+    {
+        Preprocessor::ScalarSymbol *keyword_count =
+            symbol_table.DefineScalarSymbol("_keyword_count", FiLoc::ms_invalid);
+        keyword_count->SetScalarBody(
+            new Preprocessor::Body(Sint32(keyword_table.m_keyword_count)));
+    }
+
+    // _accept_handler_keyword_state_machine_index[_accept_handler_count] -- the
+    // index of the state machine whose keywords the strings accepted by each
+    // accept handler must be looked up in (since they may be keywords of a
+    // higher-priority rule), or -1 if none of them can be.
+    {
+        Preprocessor::ArraySymbol *accept_handler_keyword_state_machine_index =
+            symbol_table.DefineArraySymbol("_accept_handler_keyword_state_machine_index", FiLoc::ms_invalid);
+        assert(keyword_table.m_accept_handler_keyword_state_machine_index.size() == primary_source.RuleCount());
+        for (vector<Uint32>::const_iterator it = keyword_table.m_accept_handler_keyword_state_machine_index.begin(),
+                                            it_end = keyword_table.m_accept_handler_keyword_state_machine_index.end();
+             it != it_end;
+             ++it)
+        {
+            accept_handler_keyword_state_machine_index->AppendArrayElement(
+                new Preprocessor::Body(*it == Uint32(KeywordTable::ms_no_state_machine) ? Sint32(-1) : Sint32(*it)));
+        }
+    }
+
+    if (keyword_table.m_keyword_count == 0)
+        return;
+
+    // _keyword_hash_seed -- the seed of the keyword hash function (see
+    // ReflexCpp_::KeywordHash_ in reflex.cpp.header.codespec).
+    //
+    // _keyword_min_length and _keyword_max_length -- the lengths of the
+    // shortest and longest keywords.
+    {
+        Preprocessor::ScalarSymbol *keyword_hash_seed =
+            symbol_table.DefineScalarSymbol("_keyword_hash_seed", FiLoc::ms_invalid);
+        keyword_hash_seed->SetScalarBody(
+            new Preprocessor::Body(Sint32(keyword_table.m_hash_seed)));
+        Preprocessor::ScalarSymbol *keyword_min_length =
+            symbol_table.DefineScalarSymbol("_keyword_min_length", FiLoc::ms_invalid);
+        keyword_min_length->SetScalarBody(
+            new Preprocessor::Body(Sint32(keyword_table.m_min_keyword_length)));
+        Preprocessor::ScalarSymbol *keyword_max_length =
+            symbol_table.DefineScalarSymbol("_keyword_max_length", FiLoc::ms_invalid);
+        keyword_max_length->SetScalarBody(
+            new Preprocessor::Body(Sint32(keyword_table.m_max_keyword_length)));
+    }
+
+    // _keyword_bucket_count -- the number of buckets (a power of 2) the
+    // keywords are hashed into.
+    //
+    // _keyword_bucket_displacement[_keyword_bucket_count] -- the displacement
+    // which, along with a keyword's hash, gives its slot.
+    {
+        Preprocessor::ScalarSymbol *keyword_bucket_count =
+            symbol_table.DefineScalarSymbol("_keyword_bucket_count", FiLoc::ms_invalid);
+        keyword_bucket_count->SetScalarBody(
+            new Preprocessor::Body(Sint32(keyword_table.m_displacement.size())));
+        Preprocessor::ArraySymbol *keyword_bucket_displacement =
+            symbol_table.DefineArraySymbol("_keyword_bucket_displacement", FiLoc::ms_invalid);
+        for (vector<Uint16>::const_iterator it = keyword_table.m_displacement.begin(),
+                                            it_end = keyword_table.m_displacement.end();
+             it != it_end;
+             ++it)
+        {
+            keyword_bucket_displacement->AppendArrayElement(
+                new Preprocessor::Body(Sint32(*it)));
+        }
+    }
+
+    // _keyword_slot_count -- the number of slots (a power of 2) in the
+    // perfect hash table of keywords.
+    //
+    // _keyword_slot_text[_keyword_slot_count] -- the keyword in each slot,
+    // which is empty for an unused slot.
+    //
+    // _keyword_slot_state_machine_index[_keyword_slot_count] -- the index of
+    // the state machine of each slot's keyword (0 for an unused slot).
+    //
+    // _keyword_slot_accept_handler_index[_keyword_slot_count] -- the accept
+    // handler of each slot's keyword (_accept_handler_count for an unused
+    // slot).
+    {
+        Preprocessor::ScalarSymbol *keyword_slot_count =
+            symbol_table.DefineScalarSymbol("_keyword_slot_count", FiLoc::ms_invalid);
+        keyword_slot_count->SetScalarBody(
+            new Preprocessor::Body(Sint32(keyword_table.m_slot.size())));
+        Preprocessor::ArraySymbol *keyword_slot_text =
+            symbol_table.DefineArraySymbol("_keyword_slot_text", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *keyword_slot_state_machine_index =
+            symbol_table.DefineArraySymbol("_keyword_slot_state_machine_index", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *keyword_slot_accept_handler_index =
+            symbol_table.DefineArraySymbol("_keyword_slot_accept_handler_index", FiLoc::ms_invalid);
+        for (vector<Keyword>::const_iterator it = keyword_table.m_slot.begin(),
+                                             it_end = keyword_table.m_slot.end();
+             it != it_end;
+             ++it)
+        {
+            Keyword const &keyword = *it;
+            keyword_slot_text->AppendArrayElement(
+                new Preprocessor::Body(keyword.m_text));
+            keyword_slot_state_machine_index->AppendArrayElement(
+                new Preprocessor::Body(Sint32(keyword.m_state_machine_index)));
+            keyword_slot_accept_handler_index->AppendArrayElement(
+                new Preprocessor::Body(keyword.m_text.empty() ? Sint32(primary_source.RuleCount()) : Sint32(keyword.m_accept_handler_index)));
+        }
+    }
+}
+
 void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_graph, vector<Uint32> const &dfa_start_state_index, Preprocessor::SymbolTable &symbol_table)
 {
     assert(dfa_graph.NodeCount() > 0);
@@ -269,11 +666,35 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
             new Preprocessor::Body(Sint32(dfa_graph.NodeCount())));
     }
 
+    // the mode flags and reachability of each DFA state (see
+    // ComputeDfaNodeModeFlagsAndReachability).
+    vector<StateMachine::ModeFlags> node_mode_flags;
+    vector<bool> node_is_reachable;
+    ComputeDfaNodeModeFlagsAndReachability(primary_source, dfa_graph, dfa_start_state_index, node_mode_flags, node_is_reachable);
+
+    // the atom class of each input atom (see ComputeDfaAtomClasses).
+    Uint32 atom_class[256];
+    Uint32 atom_class_count = ComputeDfaAtomClasses(dfa_graph, node_mode_flags, atom_class);
+
+
     // DEFINITION: a 'fast' transition is one that uses a lookup table to determine
     // the next state.  this gives constant-time transitions (neglecting buffer-filling).
     // a non-fast transition is one that runs through a list of transitions to determine
     // the next state.  this gives linear time complexity.
     //
+    // DEFINITION: two input atoms are in the same 'atom class' if every state
+    // in the DFA transitions identically on them (after incorporating each
+    // state's case-insensitivity).  the lookup table of a state whose
+    // transitions are input atoms is indexed by atom class instead of by atom,
+    // which makes the tables much smaller, since most DFAs distinguish only a
+    // few dozen classes of atoms.
+    //
+    // _dfa_atom_class_count -- gives the number of atom classes (at least 1, at
+    // most 256).
+    //
+    // _dfa_atom_class[256] -- gives the atom class of each input atom.  the atom
+    // classes are numbered in order of their lowest atom.
+    //
     // _dfa_state_accept_handler_index[_dfa_state_count] -- gives the accept-handler-index
     // for this node, or _dfa_state_count if this is not an accept state
     //
@@ -282,6 +703,8 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
     //
     // _dfa_state_transition_count[_dfa_state_count] -- gives the number of transitions for
     // this node (the number of contiguous transitions which apply to this node).
+    // the case-insensitivity of the node's state machine is already incorporated
+    // into its INPUT_ATOM and INPUT_ATOM_RANGE transitions.
     //
     // _dfa_state_fast_transition_offset[_dfa_state_count] -- gives the offset into the
     // transition table for the transitions belonging to this state.
@@ -290,12 +713,9 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
     // belonging to this state; the state's lookup table consists of the transitions having
     // indices in the range [_dfa_state_fast_transition_offset[i],
     // _dfa_state_fast_transition_offset[i]+_dfa_state_fast_transition_count[i]), noting
-    // that the range is [ , ), i.e. the right endpoint is not included.
-    //
-    // _dfa_state_fast_transition_first_index[_dfa_state_count] -- if the state's transition
-    // type is INPUT_ATOM, then this gives the lowest input_atom value in the transition
-    // table.  it is byte-valued (i.e. the range is [0,255].  for any other transition type,
-    // this value is not used.
+    // that the range is [ , ), i.e. the right endpoint is not included.  this is
+    // _dfa_atom_class_count if the state's transition type is INPUT_ATOM,
+    // 1<<CT_FLAG_COUNT if it is CONDITIONAL, and 0 if the state has no transitions.
     //
     // _dfa_state_fast_transition_type_integer[_dfa_state_count] -- this gives the
     // integer-valued transition type of the state, which can only be 0=INPUT_ATOM or
@@ -305,6 +725,11 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
     // text name of the transition type of the state, which can only be "INPUT_ATOM"
     // or "CONDITIONAL".
     //
+    // _dfa_state_conditional_mask[_dfa_state_count] -- gives the mask of the
+    // conditional flags which this state's transitions test (which is the same
+    // for all of them), or 0 if this state's transitions are not CONDITIONAL.
+    // only the flags in the mask need to be calculated to choose a transition.
+    //
     // _dfa_state_description[_dfa_state_count] -- the description of this graph node
     // (e.g. "25:SCAN_TEXT, 5, 8").
     //
@@ -338,6 +763,11 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
     // the 'next state' for when the transition in question is exercised.  the values
     // in _dfa_state_fast_transition_offset give offsets into this lookup table.
     {
+        Preprocessor::ScalarSymbol *dfa_atom_class_count =
+            symbol_table.DefineScalarSymbol("_dfa_atom_class_count", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_atom_class =
+            symbol_table.DefineArraySymbol("_dfa_atom_class", FiLoc::ms_invalid);
+
         Preprocessor::ArraySymbol *dfa_state_accept_handler_index =
             symbol_table.DefineArraySymbol("_dfa_state_accept_handler_index", FiLoc::ms_invalid);
         Preprocessor::ArraySymbol *dfa_state_transition_offset =
@@ -348,12 +778,12 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
             symbol_table.DefineArraySymbol("_dfa_state_fast_transition_offset", FiLoc::ms_invalid);
         Preprocessor::ArraySymbol *dfa_state_fast_transition_count =
             symbol_table.DefineArraySymbol("_dfa_state_fast_transition_count", FiLoc::ms_invalid);
-        Preprocessor::ArraySymbol *dfa_state_fast_transition_first_index =
-            symbol_table.DefineArraySymbol("_dfa_state_fast_transition_first_index", FiLoc::ms_invalid);
         Preprocessor::ArraySymbol *dfa_state_fast_transition_type_integer =
             symbol_table.DefineArraySymbol("_dfa_state_fast_transition_type_integer", FiLoc::ms_invalid);
         Preprocessor::ArraySymbol *dfa_state_fast_transition_type_name =
             symbol_table.DefineArraySymbol("_dfa_state_fast_transition_type_name", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_state_conditional_mask =
+            symbol_table.DefineArraySymbol("_dfa_state_conditional_mask", FiLoc::ms_invalid);
         Preprocessor::ArraySymbol *dfa_state_description =
             symbol_table.DefineArraySymbol("_dfa_state_description", FiLoc::ms_invalid);
 
@@ -375,6 +805,12 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
         Preprocessor::ArraySymbol *dfa_fast_transition_target_node_index =
             symbol_table.DefineArraySymbol("_dfa_fast_transition_target_node_index", FiLoc::ms_invalid);
 
+        dfa_atom_class_count->SetScalarBody(
+            new Preprocessor::Body(Sint32(atom_class_count)));
+        for (Uint32 i = 0; i < 256; ++i)
+            dfa_atom_class->AppendArrayElement(
+                new Preprocessor::Body(Sint32(atom_class[i])));
+
         Sint32 total_transition_count = 0;
         Sint32 total_fast_transition_count = 0;
 
@@ -388,7 +824,6 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
             Sint32 node_transition_offset = total_transition_count;
             Sint32 node_fast_transition_offset = total_fast_transition_count;
             Sint32 node_transition_count = 0;
-            Sint32 node_fast_transition_count = 0;
 
             // ensure that the transition type is the same for all transitions at this node
             // TODO: is this checked somewhere earlier?
@@ -421,19 +856,12 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
                 }
             }
 
-            // construct lookup tables for the 'fast' transition symbols
-            Uint32 input_atom_target_index[256];
-            Uint32 input_atom_lowest = 256;
-            Uint32 input_atom_highest = 0;
-            Uint32 conditional_target_index[1<<Regex::CT_FLAG_COUNT];
-            for (Uint32 i = 0; i < 256; ++i)
-                input_atom_target_index[i] = dfa_graph.NodeCount(); // sentinel value is the node count (= _dfa_state_count)
-            for (Uint32 flags = 0; flags < (1<<Regex::CT_FLAG_COUNT); ++flags)
-                conditional_target_index[flags] = dfa_graph.NodeCount(); // sentinel value is the node count (= _dfa_state_count)
+            vector<Graph::Transition> node_transitions;
+            ComputeDfaNodeTransitions(dfa_graph, node_index, node_mode_flags[node_index], node_transitions);
 
             // iterate through all the transitions and fill the symbols
-            for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
-                                                      it_end = node.TransitionSetEnd();
+            for (vector<Graph::Transition>::const_iterator it = node_transitions.begin(),
+                                                           it_end = node_transitions.end();
                  it != it_end;
                  ++it)
             {
@@ -454,45 +882,6 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
                 ++node_transition_count;
                 assert(total_transition_count < SINT32_UPPER_BOUND);
                 ++total_transition_count;
-
-                switch (transition.Type())
-                {
-                    case Regex::TT_INPUT_ATOM:
-                        assert(transition.Data(0) < 256);
-                        input_atom_target_index[transition.Data(0)] = transition.TargetIndex();
-                        input_atom_lowest = min(input_atom_lowest, transition.Data(0));
-                        input_atom_highest = max(input_atom_highest, transition.Data(0));
-                        break;
-
-                    case Regex::TT_INPUT_ATOM_RANGE:
-                        assert(transition.Data(0) < transition.Data(1));
-                        assert(transition.Data(1) < 256);
-                        for (Uint32 i = transition.Data(0); i <= transition.Data(1); ++i)
-                            input_atom_target_index[i] = transition.TargetIndex();
-                        input_atom_lowest = min(input_atom_lowest, transition.Data(0));
-                        input_atom_highest = max(input_atom_highest, transition.Data(1));
-                        break;
-
-                    case Regex::TT_CONDITIONAL:
-                        assert(transition.Data(0) < (1<<Regex::CT_FLAG_COUNT));
-                        assert(transition.Data(1) < (1<<Regex::CT_FLAG_COUNT));
-                        for (Uint32 flags = 0; flags < (1<<Regex::CT_FLAG_COUNT); ++flags)
-                        {
-                            // data 0 is the bitmask, data 1 is the flag values
-                            if ((flags & transition.Data(0)) == transition.Data(1))
-                            {
-                                assert(conditional_target_index[flags] == dfa_graph.NodeCount());
-                                conditional_target_index[flags] = transition.TargetIndex();
-                                assert(conditional_target_index[flags] != dfa_graph.NodeCount());
-                            }
-                        }
-                        break;
-
-                    case Regex::TT_EPSILON:
-                    default:
-                        assert(false && "should not happen in DFA");
-                        break;
-                }
             }
 
             dfa_state_accept_handler_index->AppendArrayElement(
@@ -504,57 +893,40 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
 
             dfa_state_fast_transition_offset->AppendArrayElement(
                 new Preprocessor::Body(node_fast_transition_offset));
-            // determine and set the fast transition count and first-index,
-            // fill in dfa_fast_transition_target_node_index
+            // determine and set the fast transition count and fill in
+            // dfa_fast_transition_target_node_index
             if (node.TransitionCount() > 0)
             {
-                Graph::Transition const &first_transition = *node.TransitionSetBegin();
-
-                Sint32 count = 0;
-                Uint8 first_index = 0;
-                if (first_transition.Type() == Regex::TT_CONDITIONAL)
-                {
-                    count = (1<<Regex::CT_FLAG_COUNT);
-                    first_index = 0; // arbitrary, since it is unused
-                    for (Uint32 flags = 0; flags < (1<<Regex::CT_FLAG_COUNT); ++flags)
-                        dfa_fast_transition_target_node_index->AppendArrayElement(
-                            new Preprocessor::Body(Sint32(conditional_target_index[flags])));
-                }
-                else
-                {
-                    assert(input_atom_lowest <= input_atom_highest);
-                    assert(input_atom_highest < 256);
-                    count = input_atom_highest - input_atom_lowest + 1;
-                    first_index = input_atom_lowest;
-                    for (Uint32 i = input_atom_lowest; i <= input_atom_highest; ++i)
-                        dfa_fast_transition_target_node_index->AppendArrayElement(
-                            new Preprocessor::Body(Sint32(input_atom_target_index[i])));
-                }
+                vector<Uint32> row;
+                bool is_conditional = ComputeDfaNodeFastTransitionRow(dfa_graph, node_index, node_mode_flags[node_index], atom_class, atom_class_count, row);
+                Sint32 count = Sint32(row.size());
+                for (Uint32 i = 0; i < row.size(); ++i)
+                    dfa_fast_transition_target_node_index->AppendArrayElement(
+                        new Preprocessor::Body(Sint32(row[i])));
                 dfa_state_fast_transition_count->AppendArrayElement(
                     new Preprocessor::Body(count));
-                dfa_state_fast_transition_first_index->AppendArrayElement(
-                    new Preprocessor::Body(first_index));
-                assert(node_fast_transition_count < SINT32_UPPER_BOUND-count);
-                node_fast_transition_count += count;
                 assert(total_fast_transition_count < SINT32_UPPER_BOUND-count);
                 total_fast_transition_count += count;
 
-                TransitionType fast_transition_type = first_transition.Type() == Regex::TT_CONDITIONAL ? Regex::TT_CONDITIONAL : Regex::TT_INPUT_ATOM;
+                TransitionType fast_transition_type = is_conditional ? Regex::TT_CONDITIONAL : Regex::TT_INPUT_ATOM;
                 dfa_state_fast_transition_type_integer->AppendArrayElement(
                     new Preprocessor::Body(Sint32(fast_transition_type)));
                 dfa_state_fast_transition_type_name->AppendArrayElement(
                     new Preprocessor::Body(Regex::TransitionTypeString(fast_transition_type)));
+                // all of a CONDITIONAL node's transitions have the same mask.
+                dfa_state_conditional_mask->AppendArrayElement(
+                    new Preprocessor::Body(Sint32(is_conditional ? node.TransitionSetBegin()->Data(0) : 0)));
             }
             else
             {
                 dfa_state_fast_transition_count->AppendArrayElement(
                     new Preprocessor::Body(0));
-                dfa_state_fast_transition_first_index->AppendArrayElement(
-                    new Preprocessor::Body(0));
                 dfa_state_fast_transition_type_integer->AppendArrayElement(
                     new Preprocessor::Body(Sint32(Regex::TT_INPUT_ATOM))); // arbitrary
                 dfa_state_fast_transition_type_name->AppendArrayElement(
                     new Preprocessor::Body(Regex::TransitionTypeString(Regex::TT_INPUT_ATOM))); // same as above line
+                dfa_state_conditional_mask->AppendArrayElement(
+                    new Preprocessor::Body(0));
             }
 
             dfa_state_description->AppendArrayElement(
@@ -566,22 +938,509 @@ void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_g
         dfa_fast_transition_count->SetScalarBody(
             new Preprocessor::Body(total_fast_transition_count));
     }
+
+    // DEFINITION: a 'compressed' transition table packs the 'fast' lookup tables of
+    // all the states into a single 'comb vector' (also known as row displacement),
+    // as is done by flex and yacc.  each state has a base index into the comb vector
+    // and possibly a default state.  the transition for a value (the atom class of
+    // an input atom, or the conditional flags) from a state is given by the comb
+    // vector element at the state's base index plus the value, if that element is
+    // owned by the state.  otherwise the lookup is repeated using the state's
+    // default state, and if there is no default state, there is no transition.
+    // a state only owns the elements in which its lookup table differs from that
+    // of its default state (or, if it has no default state, the elements having a
+    // transition), so states with similar lookup tables share most of them.
+    //
+    // _dfa_state_compressed_transition_base[_dfa_state_count] -- gives the index in
+    // the comb vector corresponding to value 0 of this state's lookup table.
+    //
+    // _dfa_state_compressed_default_node_index[_dfa_state_count] -- gives the index
+    // of this state's default state, or _dfa_state_count if it has none.  a chain
+    // of default states is at most 2 long.
+    //
+    // _dfa_compressed_transition_count -- gives the number of elements in the comb
+    // vector.  any state's base index plus any of its values is a valid index.
+    //
+    // _dfa_compressed_transition_target_node_index[_dfa_compressed_transition_count]
+    // -- gives the index of the node which to transition to, or _dfa_state_count if
+    // the owner of this element has no transition for this value.
+    //
+    // _dfa_compressed_transition_owner_node_index[_dfa_compressed_transition_count]
+    // -- gives the index of the node which owns this element, or _dfa_state_count
+    // if this element is unused.
+    {
+        Preprocessor::ArraySymbol *dfa_state_compressed_transition_base =
+            symbol_table.DefineArraySymbol("_dfa_state_compressed_transition_base", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_state_compressed_default_node_index =
+            symbol_table.DefineArraySymbol("_dfa_state_compressed_default_node_index", FiLoc::ms_invalid);
+
+        Preprocessor::ScalarSymbol *dfa_compressed_transition_count =
+            symbol_table.DefineScalarSymbol("_dfa_compressed_transition_count", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_compressed_transition_target_node_index =
+            symbol_table.DefineArraySymbol("_dfa_compressed_transition_target_node_index", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_compressed_transition_owner_node_index =
+            symbol_table.DefineArraySymbol("_dfa_compressed_transition_owner_node_index", FiLoc::ms_invalid);
+
+        Uint32 const node_count = dfa_graph.NodeCount();
+        Uint32 const max_default_chain_length = 2;
+
+        // choose each node's default node from the preceding nodes whose lookup
+        // tables are of the same kind, so as to minimize the number of elements
+        // the node must own.  choosing only from preceding nodes guarantees that
+        // the chains of default nodes have no cycles.
+        vector<vector<Uint32> > row(node_count);
+        vector<bool> row_is_conditional(node_count, false);
+        vector<Uint32> default_node_index(node_count, node_count);
+        vector<Uint32> default_chain_length(node_count, 0);
+        vector<vector<Uint32> > owned_value(node_count);
+        Uint32 total_transition_count = 0;
+        Uint32 total_fast_transition_count = 0;
+        for (Uint32 node_index = 0; node_index < node_count; ++node_index)
+        {
+            vector<Uint32> const &node_row = row[node_index];
+            row_is_conditional[node_index] = ComputeDfaNodeFastTransitionRow(dfa_graph, node_index, node_mode_flags[node_index], atom_class, atom_class_count, row[node_index]);
+            vector<Graph::Transition> transitions;
+            ComputeDfaNodeTransitions(dfa_graph, node_index, node_mode_flags[node_index], transitions);
+            total_transition_count += Uint32(transitions.size());
+            total_fast_transition_count += node_row.size();
+
+            // the cost of having no default node is the number of transitions
+            Uint32 lowest_cost = 0;
+            for (Uint32 i = 0; i < node_row.size(); ++i)
+                if (node_row[i] != node_count)
+                    ++lowest_cost;
+            for (Uint32 candidate_index = 0; candidate_index < node_index && lowest_cost > 0; ++candidate_index)
+            {
+                vector<Uint32> const &candidate_row = row[candidate_index];
+                if (candidate_row.size() != node_row.size() ||
+                    row_is_conditional[candidate_index] != row_is_conditional[node_index] ||
+                    default_chain_length[candidate_index] >= max_default_chain_length)
+                {
+                    continue;
+                }
+                Uint32 cost = 0;
+                for (Uint32 i = 0; i < node_row.size() && cost < lowest_cost; ++i)
+                    if (node_row[i] != candidate_row[i])
+                        ++cost;
+                if (cost < lowest_cost)
+                {
+                    lowest_cost = cost;
+                    default_node_index[node_index] = candidate_index;
+                }
+            }
+
+            Uint32 default_index = default_node_index[node_index];
+            if (default_index != node_count)
+                default_chain_length[node_index] = default_chain_length[default_index] + 1;
+            for (Uint32 i = 0; i < node_row.size(); ++i)
+                if (default_index == node_count ? node_row[i] != node_count : node_row[i] != row[default_index][i])
+                    owned_value[node_index].push_back(i);
+            assert(owned_value[node_index].size() == lowest_cost);
+        }
+
+        // pack the owned elements into the comb vector, the nodes owning the most
+        // elements first, each at the lowest base index at which its elements don't
+        // collide with any already-packed elements.
+        vector<pair<Uint32, Uint32> > packing_order;
+        for (Uint32 node_index = 0; node_index < node_count; ++node_index)
+            if (!owned_value[node_index].empty())
+                packing_order.push_back(make_pair(node_count - Uint32(owned_value[node_index].size()), node_index));
+        sort(packing_order.begin(), packing_order.end());
+        vector<Uint32> base(node_count, 0);
+        vector<Uint32> owner_node_index;
+        vector<Uint32> target_node_index;
+        Uint32 lowest_unused_index = 0;
+        for (Uint32 p = 0; p < packing_order.size(); ++p)
+        {
+            Uint32 node_index = packing_order[p].second;
+            vector<Uint32> const &values = owned_value[node_index];
+            assert(!values.empty());
+            Uint32 node_base = lowest_unused_index > values[0] ? lowest_unused_index - values[0] : 0;
+            for (bool collides = true; collides; )
+            {
+                collides = false;
+                for (Uint32 i = 0; i < values.size() && !collides; ++i)
+                    collides = node_base + values[i] < owner_node_index.size() && owner_node_index[node_base + values[i]] != node_count;
+                if (collides)
+                    ++node_base;
+            }
+            base[node_index] = node_base;
+            if (owner_node_index.size() < node_base + values.back() + 1)
+            {
+                owner_node_index.resize(node_base + values.back() + 1, node_count);
+                target_node_index.resize(node_base + values.back() + 1, node_count);
+            }
+            for (Uint32 i = 0; i < values.size(); ++i)
+            {
+                owner_node_index[node_base + values[i]] = node_index;
+                target_node_index[node_base + values[i]] = row[node_index][values[i]];
+            }
+            while (lowest_unused_index < owner_node_index.size() && owner_node_index[lowest_unused_index] != node_count)
+                ++lowest_unused_index;
+        }
+        // pad the comb vector so that any lookup is within it.  note that nodes
+        // without transitions are treated as having atom class lookup tables.
+        Uint32 comb_vector_size = atom_class_count;
+        for (Uint32 node_index = 0; node_index < node_count; ++node_index)
+            comb_vector_size = max(comb_vector_size, base[node_index] + Uint32(row[node_index].size()));
+        owner_node_index.resize(max(comb_vector_size, Uint32(owner_node_index.size())), node_count);
+        target_node_index.resize(owner_node_index.size(), node_count);
+        assert(owner_node_index.size() <= SINT32_UPPER_BOUND);
+
+        for (Uint32 node_index = 0; node_index < node_count; ++node_index)
+        {
+            dfa_state_compressed_transition_base->AppendArrayElement(
+                new Preprocessor::Body(Sint32(base[node_index])));
+            dfa_state_compressed_default_node_index->AppendArrayElement(
+                new Preprocessor::Body(Sint32(default_node_index[node_index])));
+        }
+        dfa_compressed_transition_count->SetScalarBody(
+            new Preprocessor::Body(Sint32(owner_node_index.size())));
+        for (Uint32 i = 0; i < owner_node_index.size(); ++i)
+        {
+            dfa_compressed_transition_target_node_index->AppendArrayElement(
+                new Preprocessor::Body(Sint32(target_node_index[i])));
+            dfa_compressed_transition_owner_node_index->AppendArrayElement(
+                new Preprocessor::Body(Sint32(owner_node_index[i])));
+        }
+
+        // report the size of the tables of each table format (as laid out by the
+        // cpp target, see DfaState_ and DfaTransition_), so that the appropriate
+        // one can be chosen for each scanner.
+        Uint32 state_index_size = IndexByteCount(node_count);
+        Uint32 accept_handler_index_size = IndexByteCount(primary_source.RuleCount());
+        vector<Uint32> small_and_slow_state_fields, compressed_state_fields, fast_state_fields;
+        small_and_slow_state_fields.push_back(IndexByteCount(total_transition_count));
+        small_and_slow_state_fields.push_back(accept_handler_index_size);
+        small_and_slow_state_fields.push_back(2);
+        small_and_slow_state_fields.push_back(1);
+        compressed_state_fields.push_back(IndexByteCount(Uint32(owner_node_index.size())));
+        compressed_state_fields.push_back(state_index_size);
+        compressed_state_fields.push_back(accept_handler_index_size);
+        compressed_state_fields.push_back(1);
+        compressed_state_fields.push_back(1);
+        fast_state_fields.push_back(IndexByteCount(total_fast_transition_count));
+        fast_state_fields.push_back(accept_handler_index_size);
+        fast_state_fields.push_back(2);
+        fast_state_fields.push_back(1);
+        fast_state_fields.push_back(1);
+        vector<Uint32> small_and_slow_transition_fields(1, state_index_size);
+        small_and_slow_transition_fields.resize(4, 1);
+        vector<Uint32> compressed_transition_fields(2, state_index_size);
+        vector<Uint32> fast_transition_fields(1, state_index_size);
+        EmitExecutionMessage(FORMAT(
+            "DFA has " << node_count << " states and " << atom_class_count << " atom classes; table sizes: " <<
+            "small_and_slow " << node_count*StructByteCount(small_and_slow_state_fields) + total_transition_count*StructByteCount(small_and_slow_transition_fields) << " bytes, " <<
+            "compressed_tables " << node_count*StructByteCount(compressed_state_fields) + owner_node_index.size()*StructByteCount(compressed_transition_fields) + 256 << " bytes, " <<
+            "default " << node_count*StructByteCount(fast_state_fields) + total_fast_transition_count*StructByteCount(fast_transition_fields) + 256 << " bytes"));
+    }
+
+    // DEFINITION: a 'direct-coded' DFA is one in which each state is emitted as a
+    // block of code which switches on the input atom (or the conditional flags) and
+    // jumps directly to the code for the target state.  the case values of a state
+    // are partitioned into 'case groups', each being the set of values which
+    // transition to a particular target state, and each case group is stored as a
+    // list of inclusive ranges of values.  values which aren't in any of a state's
+    // case groups have no transition.  the case-insensitivity of the state's state
+    // machine is already incorporated into the case groups.
+    //
+    // _dfa_state_mode_flags[_dfa_state_count] -- gives the mode flags (see
+    // _state_machine_mode_flags) of the state machine that this state belongs to.
+    //
+    // _dfa_state_is_reachable[_dfa_state_count] -- is 1 if this state can be reached
+    // by the scanner, or 0 otherwise.  in an ungreedy state machine, the scanner
+    // never transitions out of an accept state, so the states which can only be
+    // reached via such transitions are unreachable.
+    //
+    // _dfa_state_direct_case_group_offset[_dfa_state_count] -- gives the index of
+    // the first case group belonging to this state.
+    //
+    // _dfa_state_direct_case_group_count[_dfa_state_count] -- gives the number of
+    // contiguous case groups belonging to this state.  if this is 0, then there
+    // are no transitions from this state.  the case values are input atoms if
+    // _dfa_state_fast_transition_type_name is "INPUT_ATOM" and conditional flags
+    // if it is "CONDITIONAL".
+    //
+    // _dfa_direct_case_group_count -- gives the number of case groups in this DFA
+    //
+    // _dfa_direct_case_group_target_node_index[_dfa_direct_case_group_count] -- gives
+    // the index of the node which to transition to for the values in this case group.
+    //
+    // _dfa_direct_case_group_range_offset[_dfa_direct_case_group_count] -- gives the
+    // index of the first case range belonging to this case group.
+    //
+    // _dfa_direct_case_group_range_count[_dfa_direct_case_group_count] -- gives the
+    // number of contiguous case ranges belonging to this case group.
+    //
+    // _dfa_direct_case_range_count -- gives the number of case ranges in this DFA
+    //
+    // _dfa_direct_case_range_lower[_dfa_direct_case_range_count] and
+    // _dfa_direct_case_range_upper[_dfa_direct_case_range_count] -- give the lowest
+    // and highest values (inclusive) of this case range.
+    {
+        Preprocessor::ArraySymbol *dfa_state_mode_flags =
+            symbol_table.DefineArraySymbol("_dfa_state_mode_flags", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_state_is_reachable =
+            symbol_table.DefineArraySymbol("_dfa_state_is_reachable", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_state_direct_case_group_offset =
+            symbol_table.DefineArraySymbol("_dfa_state_direct_case_group_offset", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_state_direct_case_group_count =
+            symbol_table.DefineArraySymbol("_dfa_state_direct_case_group_count", FiLoc::ms_invalid);
+
+        Preprocessor::ScalarSymbol *dfa_direct_case_group_count =
+            symbol_table.DefineScalarSymbol("_dfa_direct_case_group_count", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_direct_case_group_target_node_index =
+            symbol_table.DefineArraySymbol("_dfa_direct_case_group_target_node_index", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_direct_case_group_range_offset =
+            symbol_table.DefineArraySymbol("_dfa_direct_case_group_range_offset", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_direct_case_group_range_count =
+            symbol_table.DefineArraySymbol("_dfa_direct_case_group_range_count", FiLoc::ms_invalid);
+
+        Preprocessor::ScalarSymbol *dfa_direct_case_range_count =
+            symbol_table.DefineScalarSymbol("_dfa_direct_case_range_count", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_direct_case_range_lower =
+            symbol_table.DefineArraySymbol("_dfa_direct_case_range_lower", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_direct_case_range_upper =
+            symbol_table.DefineArraySymbol("_dfa_direct_case_range_upper", FiLoc::ms_invalid);
+
+        Sint32 total_case_group_count = 0;
+        Sint32 total_case_range_count = 0;
+
+        for (Uint32 node_index = 0; node_index < dfa_graph.NodeCount(); ++node_index)
+        {
+            Uint32 target_index[256];
+            bool is_conditional = ComputeDfaNodeTargetIndices(dfa_graph, node_index, node_mode_flags[node_index], target_index);
+            Uint32 const value_count = is_conditional ? (1<<Regex::CT_FLAG_COUNT) : 256;
+
+            // partition the values into case groups by target, ordered by the
+            // lowest value in each case group, and collect each group's ranges.
+            vector<Uint32> case_group_target;
+            vector<vector<pair<Uint32, Uint32> > > case_group_ranges;
+            map<Uint32, Uint32> target_case_group;
+            for (Uint32 i = 0; i < value_count; )
+            {
+                Uint32 target = target_index[i];
+                Uint32 lower = i;
+                while (i < value_count && target_index[i] == target)
+                    ++i;
+                if (target == dfa_graph.NodeCount())
+                    continue;
+
+                map<Uint32, Uint32>::iterator it = target_case_group.find(target);
+                if (it == target_case_group.end())
+                {
+                    it = target_case_group.insert(make_pair(target, Uint32(case_group_target.size()))).first;
+                    case_group_target.push_back(target);
+                    case_group_ranges.push_back(vector<pair<Uint32, Uint32> >());
+                }
+                case_group_ranges[it->second].push_back(make_pair(lower, i - 1));
+            }
+
+            dfa_state_mode_flags->AppendArrayElement(
+                new Preprocessor::Body(Sint32(node_mode_flags[node_index])));
+            dfa_state_is_reachable->AppendArrayElement(
+                new Preprocessor::Body(Sint32(node_is_reachable[node_index] ? 1 : 0)));
+            dfa_state_direct_case_group_offset->AppendArrayElement(
+                new Preprocessor::Body(total_case_group_count));
+            dfa_state_direct_case_group_count->AppendArrayElement(
+                new Preprocessor::Body(Sint32(case_group_target.size())));
+            for (Uint32 g = 0; g < case_group_target.size(); ++g)
+            {
+                dfa_direct_case_group_target_node_index->AppendArrayElement(
+                    new Preprocessor::Body(Sint32(case_group_target[g])));
+                dfa_direct_case_group_range_offset->AppendArrayElement(
+                    new Preprocessor::Body(total_case_range_count));
+                dfa_direct_case_group_range_count->AppendArrayElement(
+                    new Preprocessor::Body(Sint32(case_group_ranges[g].size())));
+                for (Uint32 r = 0; r < case_group_ranges[g].size(); ++r)
+                {
+                    dfa_direct_case_range_lower->AppendArrayElement(
+                        new Preprocessor::Body(Sint32(case_group_ranges[g][r].first)));
+                    dfa_direct_case_range_upper->AppendArrayElement(
+                        new Preprocessor::Body(Sint32(case_group_ranges[g][r].second)));
+                    assert(total_case_range_count < SINT32_UPPER_BOUND);
+                    ++total_case_range_count;
+                }
+                assert(total_case_group_count < SINT32_UPPER_BOUND);
+                ++total_case_group_count;
+            }
+        }
+
+        dfa_direct_case_group_count->SetScalarBody(
+            new Preprocessor::Body(total_case_group_count));
+        dfa_direct_case_range_count->SetScalarBody(
+            new Preprocessor::Body(total_case_range_count));
+    }
+
+    // DEFINITION: a state's 'skip set' is the set of input atoms on which it
+    // transitions to itself (e.g. the body of a comment or the tail of an
+    // identifier).  because a run of such atoms leaves the DFA in the same
+    // state, the scanner can advance past the whole run at once (using SIMD
+    // instructions where available) instead of transitioning on each atom.
+    // '\0' is never in a skip set, since there are no transitions on it.
+    // accept states of ungreedy state machines have no skip set, since the
+    // scanner doesn't transition out of them.  identical skip sets are shared.
+    //
+    // _dfa_state_skip_set_index[_dfa_state_count] -- gives the index of the
+    // state's skip set, or 0 if the state has no skip set.
+    //
+    // _dfa_skip_set_count -- gives the number of skip sets in this DFA, plus 1
+    // for the unused element 0.  there are at most 256, so that the index fits
+    // in a byte; any states beyond that limit just don't have a skip set.
+    //
+    // _dfa_skip_set_bitmap[32*_dfa_skip_set_count] -- gives the 32-byte bitmap
+    // of each skip set; bit a%8 of byte a/8 is set iff atom a is in the set.
+    //
+    // _dfa_skip_set_range_count[_dfa_skip_set_count] -- gives the number (at
+    // most 4) of inclusive atom ranges which describe each skip set for the
+    // SIMD implementation, or 0 if it takes more than 4 ranges to describe it.
+    //
+    // _dfa_skip_set_ranges_are_complement[_dfa_skip_set_count] -- is 1 if each
+    // skip set's ranges give the atoms not in the set, or 0 if they give the atoms
+    // in the set, whichever takes fewer ranges.
+    //
+    // _dfa_skip_set_range_lower[4*_dfa_skip_set_count] and
+    // _dfa_skip_set_range_upper[4*_dfa_skip_set_count] -- give the lowest and
+    // highest atoms (inclusive) of each skip set's ranges.  unused ranges are 0.
+    {
+        Preprocessor::ArraySymbol *dfa_state_skip_set_index =
+            symbol_table.DefineArraySymbol("_dfa_state_skip_set_index", FiLoc::ms_invalid);
+
+        Preprocessor::ScalarSymbol *dfa_skip_set_count =
+            symbol_table.DefineScalarSymbol("_dfa_skip_set_count", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_skip_set_bitmap =
+            symbol_table.DefineArraySymbol("_dfa_skip_set_bitmap", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_skip_set_range_count =
+            symbol_table.DefineArraySymbol("_dfa_skip_set_range_count", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_skip_set_ranges_are_complement =
+            symbol_table.DefineArraySymbol("_dfa_skip_set_ranges_are_complement", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_skip_set_range_lower =
+            symbol_table.DefineArraySymbol("_dfa_skip_set_range_lower", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *dfa_skip_set_range_upper =
+            symbol_table.DefineArraySymbol("_dfa_skip_set_range_upper", FiLoc::ms_invalid);
+
+        // each skip set is keyed by its bitmap; element 0 is the empty set.
+        map<vector<Uint8>, Uint32> skip_set_index;
+        vector<vector<Uint8> > skip_set_bitmap(1, vector<Uint8>(32, 0));
+
+        for (Uint32 node_index = 0; node_index < dfa_graph.NodeCount(); ++node_index)
+        {
+            Uint32 node_skip_set_index = 0;
+            Uint32 target_index[256];
+            if (dfa_graph.GetNode(node_index).TransitionCount() > 0 &&
+                !ComputeDfaNodeTargetIndices(dfa_graph, node_index, node_mode_flags[node_index], target_index) &&
+                !((node_mode_flags[node_index] & StateMachine::MF_UNGREEDY) != 0 &&
+                  dfa_graph.GetNode(node_index).DataAs<Regex::NodeData>().m_is_accept_node))
+            {
+                assert(target_index[0] != node_index);
+                vector<Uint8> bitmap(32, 0);
+                bool is_empty = true;
+                for (Uint32 i = 0; i < 256; ++i)
+                {
+                    if (target_index[i] == node_index)
+                    {
+                        bitmap[i/8] |= Uint8(1 << (i%8));
+                        is_empty = false;
+                    }
+                }
+                if (!is_empty)
+                {
+                    map<vector<Uint8>, Uint32>::iterator it = skip_set_index.find(bitmap);
+                    if (it != skip_set_index.end())
+                        node_skip_set_index = it->second;
+                    else if (skip_set_bitmap.size() < 256)
+                    {
+                        node_skip_set_index = Uint32(skip_set_bitmap.size());
+                        skip_set_index[bitmap] = node_skip_set_index;
+                        skip_set_bitmap.push_back(bitmap);
+                    }
+                }
+            }
+            dfa_state_skip_set_index->AppendArrayElement(
+                new Preprocessor::Body(Sint32(node_skip_set_index)));
+        }
+
+        dfa_skip_set_count->SetScalarBody(
+            new Preprocessor::Body(Sint32(skip_set_bitmap.size())));
+        for (Uint32 s = 0; s < skip_set_bitmap.size(); ++s)
+        {
+            vector<Uint8> const &bitmap = skip_set_bitmap[s];
+            for (Uint32 i = 0; i < 32; ++i)
+                dfa_skip_set_bitmap->AppendArrayElement(
+                    new Preprocessor::Body(Sint32(bitmap[i])));
+
+            // collect the ranges of atoms in and not in the set.
+            vector<pair<Uint32, Uint32> > ranges[2];
+            for (Uint32 i = 0; i < 256; )
+            {
+                bool is_in_set = (bitmap[i/8] & (1 << (i%8))) != 0;
+                Uint32 lower = i;
+                while (i < 256 && ((bitmap[i/8] & (1 << (i%8))) != 0) == is_in_set)
+                    ++i;
+                ranges[is_in_set ? 0 : 1].push_back(make_pair(lower, i - 1));
+            }
+            Uint32 ranges_are_complement = ranges[1].size() < ranges[0].size() ? 1 : 0;
+            vector<pair<Uint32, Uint32> > const &used_ranges = ranges[ranges_are_complement];
+            // element 0 has no ranges, since it's never used.
+            bool use_ranges = s > 0 && used_ranges.size() <= 4;
+            dfa_skip_set_range_count->AppendArrayElement(
+                new Preprocessor::Body(Sint32(use_ranges ? used_ranges.size() : 0)));
+            dfa_skip_set_ranges_are_complement->AppendArrayElement(
+                new Preprocessor::Body(Sint32(ranges_are_complement)));
+            for (Uint32 r = 0; r < 4; ++r)
+            {
+                bool is_used = use_ranges && r < used_ranges.size();
+                dfa_skip_set_range_lower->AppendArrayElement(
+                    new Preprocessor::Body(Sint32(is_used ? used_ranges[r].first : 0)));
+                dfa_skip_set_range_upper->AppendArrayElement(
+                    new Preprocessor::Body(Sint32(is_used ? used_ranges[r].second : 0)));
+            }
+        }
+    }
 }
 
-void PopulateAcceptHandlerCodeArraySymbol (Rule const &rule, string const &target_id, Preprocessor::ArraySymbol *accept_handler_code)
+void PopulateAcceptHandlerCodeArraySymbols (
+    Rule const &rule,
+    string const &target_id,
+    Preprocessor::ArraySymbol *accept_handler_code,
+    Preprocessor::ArraySymbol *accept_handler_is_token_only,
+    Preprocessor::ArraySymbol *accept_handler_token_id,
+    Sint32 &token_only_accept_handler_count)
 {
     assert(accept_handler_code != NULL);
+    assert(accept_handler_is_token_only != NULL);
+    assert(accept_handler_token_id != NULL);
     CommonLang::RuleHandler const *rule_handler = rule.m_rule_handler_map->Element(target_id);
     assert(rule_handler != NULL);
-    Ast::CodeBlock const *rule_handler_code_block = rule_handler->m_rule_handler_code_block;
-    assert(rule_handler_code_block != NULL);
-    accept_handler_code->AppendArrayElement(
-        new Preprocessor::Body(
-            rule_handler_code_block->GetText(),
-            rule_handler_code_block->GetFiLoc()));
+    if (rule_handler->m_token_id != NULL)
+    {
+        // a token-only rule has no code; the target produces the token id.
+        accept_handler_code->AppendArrayElement(new Preprocessor::Body(""));
+        accept_handler_is_token_only->AppendArrayElement(new Preprocessor::Body(1));
+        accept_handler_token_id->AppendArrayElement(
+            new Preprocessor::Body(rule_handler->m_token_id->GetText()));
+        ++token_only_accept_handler_count;
+    }
+    else
+    {
+        Ast::CodeBlock const *rule_handler_code_block = rule_handler->m_rule_handler_code_block;
+        assert(rule_handler_code_block != NULL);
+        accept_handler_code->AppendArrayElement(
+            new Preprocessor::Body(
+                rule_handler_code_block->GetText(),
+                rule_handler_code_block->GetFiLoc()));
+        accept_handler_is_token_only->AppendArrayElement(new Preprocessor::Body(0));
+        accept_handler_token_id->AppendArrayElement(new Preprocessor::Body(""));
+    }
 }
 
-void PopulateAcceptHandlerCodeArraySymbol (StateMachine const &state_machine, string const &target_id, Preprocessor::ArraySymbol *accept_handler_code)
+void PopulateAcceptHandlerCodeArraySymbols (
+    StateMachine const &state_machine,
+    string const &target_id,
+    Preprocessor::ArraySymbol *accept_handler_code,
+    Preprocessor::ArraySymbol *accept_handler_is_token_only,
+    Preprocessor::ArraySymbol *accept_handler_token_id,
+    Sint32 &token_only_accept_handler_count)
 {
     assert(accept_handler_code != NULL);
 
@@ -592,7 +1451,13 @@ void PopulateAcceptHandlerCodeArraySymbol (StateMachine const &state_machine, st
     {
         Rule const *rule = *it;
         assert(rule != NULL);
-        PopulateAcceptHandlerCodeArraySymbol(*rule, target_id, accept_handler_code);
+        PopulateAcceptHandlerCodeArraySymbols(
+            *rule,
+            target_id,
+            accept_handler_code,
+            accept_handler_is_token_only,
+            accept_handler_token_id,
+            token_only_accept_handler_count);
     }
 }
 
@@ -601,10 +1466,24 @@ void GenerateTargetDependentSymbols (PrimarySource const &primary_source, string
     EmitExecutionMessage("generating codespec symbols for target \"" + target_id + "\"");
 
     // _accept_handler_code[_accept_handler_count] -- specifies code
-    // for all accept handlers.
+    // for all accept handlers (empty for token-only rules).
+    //
+    // _accept_handler_is_token_only[_accept_handler_count] -- 1 if the rule's
+    // handler is a token id (given by the %target.XXX.token_id rule handler
+    // directive) instead of code, otherwise 0.
+    //
+    // _accept_handler_token_id[_accept_handler_count] -- the token id of each
+    // token-only rule, or empty for rules with handler code.
+    //
+    // _token_only_accept_handler_count -- the number of token-only rules.
     {
         Preprocessor::ArraySymbol *accept_handler_code =
             symbol_table.DefineArraySymbol("_accept_handler_code", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *accept_handler_is_token_only =
+            symbol_table.DefineArraySymbol("_accept_handler_is_token_only", FiLoc::ms_invalid);
+        Preprocessor::ArraySymbol *accept_handler_token_id =
+            symbol_table.DefineArraySymbol("_accept_handler_token_id", FiLoc::ms_invalid);
+        Sint32 token_only_accept_handler_count = 0;
 
         for (StateMachineMap::const_iterator it = primary_source.m_state_machine_map->begin(),
                                             it_end = primary_source.m_state_machine_map->end();
@@ -613,8 +1492,19 @@ void GenerateTargetDependentSymbols (PrimarySource const &primary_source, string
         {
             StateMachine const *state_machine = it->second;
             assert(state_machine != NULL);
-            PopulateAcceptHandlerCodeArraySymbol(*state_machine, target_id, accept_handler_code);
+            PopulateAcceptHandlerCodeArraySymbols(
+                *state_machine,
+                target_id,
+                accept_handler_code,
+                accept_handler_is_token_only,
+                accept_handler_token_id,
+                token_only_accept_handler_count);
         }
+
+        Preprocessor::ScalarSymbol *token_only_accept_handler_count_symbol =
+            symbol_table.DefineScalarSymbol("_token_only_accept_handler_count", FiLoc::ms_invalid);
+        token_only_accept_handler_count_symbol->SetScalarBody(
+            new Preprocessor::Body(token_only_accept_handler_count));
     }
 }
 
@@ -20,10 +20,12 @@ class SymbolTable;
 
 namespace Reflex {
 
+struct KeywordTable;
 struct PrimarySource;
 
 void GenerateGeneralAutomatonSymbols (PrimarySource const &primary_source, Preprocessor::SymbolTable &symbol_table);
 void GenerateNfaSymbols (PrimarySource const &primary_source, Graph const &nfa_graph, vector<Uint32> const &nfa_start_state_index, Preprocessor::SymbolTable &symbol_table);
+void GenerateKeywordSymbols (PrimarySource const &primary_source, KeywordTable const &keyword_table, Preprocessor::SymbolTable &symbol_table);
 void GenerateDfaSymbols (PrimarySource const &primary_source, Graph const &dfa_graph, vector<Uint32> const &dfa_start_state_index, Preprocessor::SymbolTable &symbol_table);
 void GenerateTargetDependentSymbols (PrimarySource const &primary_source, string const &target_id, Preprocessor::SymbolTable &symbol_table);
 
@@ -178,17 +178,68 @@ void PrintDotGraph (Graph const &graph, string const &filename, string const &gr
     }
 }
 
-void GenerateAndPrintNfaDotGraph (Reflex::PrimarySource const &primary_source, Automaton &nfa)
+bool KeywordsAreExtracted (Reflex::PrimarySource const &primary_source)
 {
-    // generate the NFA and print it (if the filename is even specified).
+    // the NFA (and so the DFA) is shared by all the targets, so the keywords
+    // are left in it if any target asks for that.
+
+    for (CommonLang::TargetMap::const_iterator it = primary_source.GetTargetMap().begin(),
+                                               it_end = primary_source.GetTargetMap().end();
+         it != it_end;
+         ++it)
+    {
+        CommonLang::Target const *target = it->second;
+        assert(target != NULL);
+        if (target->Element("dont_extract_keywords") != NULL)
+            return false;
+    }
+    return true;
+}
+
+void GenerateAndPrintNfaDotGraph (Reflex::PrimarySource const &primary_source, Reflex::KeywordTable &keyword_table, Automaton &nfa)
+{
+    // extract the keywords (unless a target says not to), generate the NFA of
+    // the remaining rules and print it (if the filename is even specified).
     // no error is possible in this section.
 
+    if (KeywordsAreExtracted(primary_source))
+    {
+        EmitExecutionMessage("extracting keywords");
+        Reflex::ExtractKeywords(primary_source, keyword_table);
+    }
+    else
+    {
+        EmitExecutionMessage("not extracting keywords, since a target uses dont_extract_keywords");
+        Reflex::ClearKeywordTable(primary_source.RuleCount(), keyword_table);
+    }
     EmitExecutionMessage("generating NFA graph");
-    Reflex::GenerateNfa(primary_source, nfa);
+    Reflex::GenerateNfa(primary_source, keyword_table, nfa);
     EmitExecutionMessage("done generating NFA graph");
     PrintDotGraph(nfa.m_graph, ReflexOptions().NaDotGraphPath(), "NFA");
 }
 
+bool DfaIsNeeded (Reflex::PrimarySource const &primary_source)
+{
+    // the DFA isn't needed if every target makes its DFA lazily (at runtime,
+    // from the NFA), since subset construction can take exponential time and
+    // space, unless the DFA graph is requested anyway.
+
+    if (!ReflexOptions().DaDotGraphPath().empty())
+        return true;
+
+    for (CommonLang::TargetMap::const_iterator it = primary_source.GetTargetMap().begin(),
+                                               it_end = primary_source.GetTargetMap().end();
+         it != it_end;
+         ++it)
+    {
+        CommonLang::Target const *target = it->second;
+        assert(target != NULL);
+        if (target->Element("lazy_dfa") == NULL)
+            return true;
+    }
+    return false;
+}
+
 void GenerateAndPrintDfaDotGraph (Reflex::PrimarySource const &primary_source, Automaton const &nfa, Automaton &dfa)
 {
     // generate the DFA and print it (if the filename is even specified).
@@ -198,7 +249,7 @@ void GenerateAndPrintDfaDotGraph (Reflex::PrimarySource const &primary_source, A
 
     try {
         EmitExecutionMessage("attempting to generate DFA graph");
-        Reflex::GenerateDfa(primary_source, nfa, primary_source.RuleCount(), dfa);
+        Reflex::GenerateDfa(primary_source, nfa, primary_source.RuleCount(), dfa, ReflexOptions().JobCount());
         EmitExecutionMessage("generated DFA graph successfully");
         PrintDotGraph(dfa.m_graph, ReflexOptions().DaDotGraphPath(), "DFA");
     } catch (string const &exception) {
@@ -265,7 +316,7 @@ void ParseCodespecs (Reflex::PrimarySource const &primary_source)
         exit(RS_CODESPEC_ERROR);
 }
 
-void WriteTargets (Reflex::PrimarySource const &primary_source, Automaton const &nfa, Automaton const &dfa)
+void WriteTargets (Reflex::PrimarySource const &primary_source, Reflex::KeywordTable const &keyword_table, Automaton const &nfa, Automaton const &dfa, bool dfa_was_generated)
 {
     // for each target, fill in an empty Preprocessor::SymbolTable with the
     // macros to be used by the codespecs, and execute each codespec, each
@@ -276,7 +327,9 @@ void WriteTargets (Reflex::PrimarySource const &primary_source, Automaton const
 
     Reflex::GenerateGeneralAutomatonSymbols(primary_source, global_symbol_table);
     Reflex::GenerateNfaSymbols(primary_source, nfa.m_graph, nfa.m_start_state_index, global_symbol_table);
-    Reflex::GenerateDfaSymbols(primary_source, dfa.m_graph, dfa.m_start_state_index, global_symbol_table);
+    Reflex::GenerateKeywordSymbols(primary_source, keyword_table, global_symbol_table);
+    if (dfa_was_generated)
+        Reflex::GenerateDfaSymbols(primary_source, dfa.m_graph, dfa.m_start_state_index, global_symbol_table);
 
     for (CommonLang::TargetMap::const_iterator it = primary_source.GetTargetMap().begin(),
                                                it_end = primary_source.GetTargetMap().end();
@@ -304,16 +357,21 @@ int main (int argc, char **argv)
 {
     try {
         Reflex::PrimarySource const *primary_source = NULL;
+        Reflex::KeywordTable keyword_table;
         Automaton nfa, dfa;
 
         ParseAndHandleOptions(argc, argv);
         primary_source = ParsePrimarySource();
         assert(primary_source != NULL);
-        GenerateAndPrintNfaDotGraph(*primary_source, nfa);
-        GenerateAndPrintDfaDotGraph(*primary_source, nfa, dfa);
+        GenerateAndPrintNfaDotGraph(*primary_source, keyword_table, nfa);
+        bool dfa_is_needed = DfaIsNeeded(*primary_source);
+        if (dfa_is_needed)
+            GenerateAndPrintDfaDotGraph(*primary_source, nfa, dfa);
+        else
+            EmitExecutionMessage("not generating DFA graph, since every target makes its DFA lazily");
         ParseTargetspecs(*primary_source);
         ParseCodespecs(*primary_source);
-        WriteTargets(*primary_source, nfa, dfa);
+        WriteTargets(*primary_source, keyword_table, nfa, dfa, dfa_is_needed);
 
         delete primary_source;
         EmitExecutionMessage("ending execution successfully");
@@ -2,6 +2,12 @@
 
 #include "reflex_options.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+#include "barf_util.hpp"
+
 namespace Reflex {
 
 CommandLineOption const Options::ms_option[] =
@@ -135,6 +141,16 @@ CommandLineOption const Options::ms_option[] =
         "    behavior.  See also option --generate-dfa-dot-graph."),
 
 
+    CommandLineOption("Generation options"),
+    CommandLineOption(
+        'j',
+        "jobs",
+        &Options::SetJobCount,
+        "    Specifies the number of threads to use to generate the DFAs of separate\n"
+        "    state machines concurrently.  The generated code doesn't depend on this\n"
+        "    value.  0 indicates the number of hardware threads.  The default is 1."),
+
+
     CommandLineOption("Target-related options"),
     CommandLineOption(
         'D',
@@ -207,9 +223,25 @@ Options::Options (string const &executable_filename)
         executable_filename,
         "Reflex - a lexical scanner generator - version " PACKAGE_VERSION "\n"
         "Part of the BARF compiler tool suite - written by Victor Dods",
-        "[options] <input_filename>")
+        "[options] <input_filename>"),
+    m_job_count(1)
 { }
 
+void Options::SetJobCount (string const &job_count)
+{
+    char *end = NULL;
+    unsigned long value = strtoul(job_count.c_str(), &end, 10);
+    if (job_count.empty() || *end != '\0' || value > UINT32_UPPER_BOUND)
+    {
+        ReportErrorAndSetAbortFlag("invalid job count " + StringLiteral(job_count));
+        return;
+    }
+
+    m_job_count = Uint32(value);
+    if (m_job_count == 0)
+        m_job_count = max(thread::hardware_concurrency(), 1u);
+}
+
 void Options::Parse (int const argc, char const *const *const argv)
 {
     OptionsBase::Parse(argc, argv);
@@ -15,10 +15,19 @@ public:
 
     Options (string const &executable_filename);
 
+    // generation options
+    Uint32 JobCount () const { return m_job_count; }
+
+    // generation options
+    void SetJobCount (string const &job_count);
+
     virtual void Parse (int argc, char const *const *argv);
 
 private:
 
+    // generation option values
+    Uint32 m_job_count;
+
     static CommandLineOption const ms_option[];
     static Uint32 const ms_option_count;
 }; // end of class Options
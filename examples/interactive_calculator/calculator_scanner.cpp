@@ -10,23 +10,26 @@
 #define REFLEX_CPP_DEBUG_CODE_(spew_code) if (DebugSpewIsEnabled()) { spew_code; }
 
 
-#line 47 "../calculator_scanner.reflex"
+#line 39 "../calculator_scanner.reflex"
 
 namespace Calculator {
 
 #line 18 "../calculator_scanner.cpp"
 
 Scanner::Scanner (
-#line 32 "../calculator_scanner.reflex"
+#line 24 "../calculator_scanner.reflex"
  string const &input_string 
 #line 23 "../calculator_scanner.cpp"
 )
     :
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_(
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_(
         ms_state_table_,
         ms_state_count_,
         ms_transition_table_,
         ms_transition_count_,
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
         ms_accept_handler_count_,
         static_cast<ReflexCpp_::InputApparatus_Interactive_::IsInputAtEndMethod_>(&Scanner::IsInputAtEnd_),
         static_cast<ReflexCpp_::InputApparatus_Interactive_::ReadNextAtomMethod_>(&Scanner::ReadNextAtom_))
@@ -34,11 +37,11 @@ Scanner::Scanner (
     SetDebugSpewStream(NULL);
 
 
-#line 50 "../calculator_scanner.reflex"
+#line 42 "../calculator_scanner.reflex"
 
     m_input.str(input_string);
 
-#line 42 "../calculator_scanner.cpp"
+#line 45 "../calculator_scanner.cpp"
 
     ResetForNewInput();
 }
@@ -69,9 +72,9 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
                            << ms_state_machine_name_[state_machine];
         if (ms_state_machine_mode_flags_[state_machine] != 0)
         {
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Interactive_::MF_CASE_INSENSITIVE_) != 0)
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
                 *DebugSpewStream() << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Interactive_::MF_UNGREEDY_) != 0)
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::MF_UNGREEDY_) != 0)
                 *DebugSpewStream() << " %ungreedy";
         }
         *DebugSpewStream() << std::endl)
@@ -80,6 +83,27 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
     assert(CurrentStateMachine() == state_machine);
 }
 
+Scanner::ScannerCheckpoint Scanner::Checkpoint ()
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << "Scanner:" << " taking checkpoint" << std::endl)
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_Interactive_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void Scanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << "Scanner:" << " restoring checkpoint" << std::endl)
+    ReflexCpp_::InputApparatus_Interactive_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void Scanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_Interactive_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
 void Scanner::ResetForNewInput ()
 {
     REFLEX_CPP_DEBUG_CODE_(
@@ -87,20 +111,20 @@ void Scanner::ResetForNewInput ()
                            << ms_state_machine_name_[StateMachine::START_];
         if (ms_state_machine_mode_flags_[StateMachine::START_] != 0)
         {
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Interactive_::MF_CASE_INSENSITIVE_) != 0)
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
                 *DebugSpewStream() << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Interactive_::MF_UNGREEDY_) != 0)
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::MF_UNGREEDY_) != 0)
                 *DebugSpewStream() << " %ungreedy";
         }
         *DebugSpewStream() << std::endl)
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
     assert(CurrentStateMachine() == StateMachine::START_);
 
 
-#line 77 "../calculator_scanner.reflex"
+#line 69 "../calculator_scanner.reflex"
 
 
-#line 104 "../calculator_scanner.cpp"
+#line 128 "../calculator_scanner.cpp"
 }
 
 Parser::Token Scanner::Scan () throw()
@@ -112,17 +136,16 @@ Parser::Token Scanner::Scan () throw()
     // exist (see comments below).
     while (true)
     {
-        // clear the previous accepted/rejected string.
-        work_string.clear();
         // reset the char buffer and other stuff
         PrepareToScan_();
 
         bool was_at_end_of_input_ = IsAtEndOfInput();
 
-        std::uint32_t accept_handler_index_ = RunDfa_(work_string);
-        // if no valid accept_handler_index_ was returned, then work_string
-        // was filled with everything up to the char after the keep_string
-        // cursor (i.e. the rejected atom).
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        work_string.assign(AcceptedStringBegin_(), AcceptedStringEnd_());
         if (accept_handler_index_ >= ms_accept_handler_count_)
         {
             // if we were already at the end of input and no
@@ -146,11 +169,11 @@ Parser::Token Scanner::Scan () throw()
             do
             {
 
-#line 74 "../calculator_scanner.reflex"
+#line 66 "../calculator_scanner.reflex"
 
     assert(false && "we should have handled this in the catch-all rule");
 
-#line 154 "../calculator_scanner.cpp"
+#line 177 "../calculator_scanner.cpp"
 
             }
             while (false);
@@ -173,11 +196,11 @@ Parser::Token Scanner::Scan () throw()
                 case 0:
                 {
 
-#line 114 "../calculator_scanner.reflex"
+#line 106 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::NUMBER, strtod(accepted_string.c_str(), NULL));
     
-#line 181 "../calculator_scanner.cpp"
+#line 204 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -185,11 +208,11 @@ Parser::Token Scanner::Scan () throw()
                 case 1:
                 {
 
-#line 119 "../calculator_scanner.reflex"
+#line 111 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::NUMBER, strtod(accepted_string.c_str(), NULL));
     
-#line 193 "../calculator_scanner.cpp"
+#line 216 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -197,11 +220,11 @@ Parser::Token Scanner::Scan () throw()
                 case 2:
                 {
 
-#line 124 "../calculator_scanner.reflex"
+#line 116 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::NUMBER, M_PI);
     
-#line 205 "../calculator_scanner.cpp"
+#line 228 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -209,11 +232,11 @@ Parser::Token Scanner::Scan () throw()
                 case 3:
                 {
 
-#line 129 "../calculator_scanner.reflex"
+#line 121 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::NUMBER, M_E);
     
-#line 217 "../calculator_scanner.cpp"
+#line 240 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -221,11 +244,11 @@ Parser::Token Scanner::Scan () throw()
                 case 4:
                 {
 
-#line 134 "../calculator_scanner.reflex"
+#line 126 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::RESULT);
     
-#line 229 "../calculator_scanner.cpp"
+#line 252 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -233,11 +256,11 @@ Parser::Token Scanner::Scan () throw()
                 case 5:
                 {
 
-#line 139 "../calculator_scanner.reflex"
+#line 131 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::LOG);
     
-#line 241 "../calculator_scanner.cpp"
+#line 264 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -245,11 +268,11 @@ Parser::Token Scanner::Scan () throw()
                 case 6:
                 {
 
-#line 144 "../calculator_scanner.reflex"
+#line 136 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::HELP);
     
-#line 253 "../calculator_scanner.cpp"
+#line 276 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -257,11 +280,11 @@ Parser::Token Scanner::Scan () throw()
                 case 7:
                 {
 
-#line 149 "../calculator_scanner.reflex"
+#line 141 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::MOD);
     
-#line 265 "../calculator_scanner.cpp"
+#line 288 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -269,11 +292,11 @@ Parser::Token Scanner::Scan () throw()
                 case 8:
                 {
 
-#line 154 "../calculator_scanner.reflex"
+#line 146 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Token::Id(accepted_string[0]));
     
-#line 277 "../calculator_scanner.cpp"
+#line 300 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -281,11 +304,11 @@ Parser::Token Scanner::Scan () throw()
                 case 9:
                 {
 
-#line 159 "../calculator_scanner.reflex"
+#line 151 "../calculator_scanner.reflex"
 
         // ignore all non-newline whitespace
     
-#line 289 "../calculator_scanner.cpp"
+#line 312 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -293,11 +316,11 @@ Parser::Token Scanner::Scan () throw()
                 case 10:
                 {
 
-#line 164 "../calculator_scanner.reflex"
+#line 156 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::NEWLINE);
     
-#line 301 "../calculator_scanner.cpp"
+#line 324 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -305,11 +328,11 @@ Parser::Token Scanner::Scan () throw()
                 case 11:
                 {
 
-#line 169 "../calculator_scanner.reflex"
+#line 161 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::END_);
     
-#line 313 "../calculator_scanner.cpp"
+#line 336 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -317,11 +340,11 @@ Parser::Token Scanner::Scan () throw()
                 case 12:
                 {
 
-#line 174 "../calculator_scanner.reflex"
+#line 166 "../calculator_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::BAD_TOKEN);
     
-#line 325 "../calculator_scanner.cpp"
+#line 348 "../calculator_scanner.cpp"
 
                 }
                 break;
@@ -332,29 +355,29 @@ Parser::Token Scanner::Scan () throw()
     }
 
 
-#line 53 "../calculator_scanner.reflex"
+#line 45 "../calculator_scanner.reflex"
 
     return Parser::Token(Parser::Terminal::BAD_TOKEN);
 
-#line 340 "../calculator_scanner.cpp"
+#line 363 "../calculator_scanner.cpp"
 }
 
 void Scanner::KeepString ()
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << "Scanner:" << " keeping string" << std::endl)
-    AutomatonApparatus_FastAndBig_Interactive_::KeepString();
+    AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::KeepString();
 }
 
 void Scanner::Unaccept (std::uint32_t unaccept_char_count)
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << "Scanner:" << " unaccepting " << unaccept_char_count << " char" << (unaccept_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Interactive_::Unaccept(unaccept_char_count);
+    AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::Unaccept(unaccept_char_count);
 }
 
 void Scanner::Unreject (std::uint32_t unreject_char_count)
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << "Scanner:" << " unrejecting " << unreject_char_count << " char" << (unreject_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Interactive_::Unreject(unreject_char_count);
+    AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::Unreject(unreject_char_count);
 }
 
 // ///////////////////////////////////////////////////////////////////////
@@ -364,21 +387,21 @@ void Scanner::Unreject (std::uint32_t unreject_char_count)
 bool Scanner::IsInputAtEnd_ () throw()
 {
 
-#line 68 "../calculator_scanner.reflex"
+#line 60 "../calculator_scanner.reflex"
 
     return m_input.peek() == char_traits<char>::eof();
 
-#line 372 "../calculator_scanner.cpp"
+#line 395 "../calculator_scanner.cpp"
 }
 
 std::uint8_t Scanner::ReadNextAtom_ () throw()
 {
 
-#line 71 "../calculator_scanner.reflex"
+#line 63 "../calculator_scanner.reflex"
 
     return m_input.get();
 
-#line 382 "../calculator_scanner.cpp"
+#line 405 "../calculator_scanner.cpp"
 }
 
 void Scanner::PrintAtom_ (std::ostream &out, std::uint8_t atom)
@@ -398,6 +421,11 @@ void Scanner::PrintAtom_ (std::ostream &out, std::uint8_t atom)
 }
 
 void Scanner::PrintString_ (std::ostream &out, std::string const &s)
+{
+    PrintString_(out, s.data(), s.length());
+}
+
+void Scanner::PrintString_ (std::ostream &out, char const *s, std::size_t length)
 {
     // save the existing ostream properties for later restoration
     std::ios_base::fmtflags saved_stream_flags = out.flags();
@@ -417,7 +445,7 @@ void Scanner::PrintString_ (std::ostream &out, std::string const &s)
     out.fill('0');
 
     out << '"';
-    for (std::string::size_type i = 0; i < s.size(); ++i)
+    for (std::size_t i = 0; i < length; ++i)
         PrintAtom_(out, s[i]);
     out << '"';
 
@@ -444,720 +472,466 @@ std::uint32_t const Scanner::ms_state_machine_count_ = sizeof(Scanner::ms_state_
 
 // the order of the states indicates priority (only for accept states).
 // the lower the state's index in this array, the higher its priority.
-ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaState_ const Scanner::ms_state_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::DfaState_ const Scanner::ms_state_table_[] =
 {
-    { 13, 32, 0, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::CONDITIONAL, 0 },
-    { 13, 255, 32, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 12, 0, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 9, 0, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 10, 0, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 8, 0, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 0, 1, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 13, 10, 288, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 1, 54, 298, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 13, 15, 352, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 43 },
-    { 13, 10, 367, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 1, 0, 377, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 1, 10, 377, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 0, 12, 387, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 0, 12, 399, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 3, 0, 411, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 12, 1, 411, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 101 },
-    { 13, 1, 412, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 108 },
-    { 13, 1, 413, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 112 },
-    { 6, 0, 414, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 12, 1, 414, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 111 },
-    { 13, 1, 415, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 103 },
-    { 5, 0, 416, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 12, 1, 416, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 111 },
-    { 13, 1, 417, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 100 },
-    { 7, 0, 418, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 12, 1, 418, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 105 },
-    { 2, 0, 419, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 4, 0, 419, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 11, 255, 419, ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_::INPUT_ATOM, 1 }
+    { 0, 13, 32, 2, 0 },
+    { 32, 13, 20, 0, 0 },
+    { 52, 12, 0, 0, 0 },
+    { 52, 9, 0, 0, 0 },
+    { 52, 10, 0, 0, 0 },
+    { 52, 8, 0, 0, 0 },
+    { 52, 0, 20, 0, 0 },
+    { 72, 13, 20, 0, 0 },
+    { 92, 1, 20, 0, 1 },
+    { 112, 13, 20, 0, 0 },
+    { 132, 13, 20, 0, 0 },
+    { 152, 1, 0, 0, 0 },
+    { 152, 1, 20, 0, 1 },
+    { 172, 0, 20, 0, 1 },
+    { 192, 3, 0, 0, 0 },
+    { 192, 12, 20, 0, 0 },
+    { 212, 13, 20, 0, 0 },
+    { 232, 13, 20, 0, 0 },
+    { 252, 6, 0, 0, 0 },
+    { 252, 12, 20, 0, 0 },
+    { 272, 13, 20, 0, 0 },
+    { 292, 5, 0, 0, 0 },
+    { 292, 12, 20, 0, 0 },
+    { 312, 13, 20, 0, 0 },
+    { 332, 7, 0, 0, 0 },
+    { 332, 12, 20, 0, 0 },
+    { 352, 2, 0, 0, 0 },
+    { 352, 4, 0, 0, 0 },
+    { 352, 11, 20, 0, 0 }
 };
 std::size_t const Scanner::ms_state_count_ = sizeof(Scanner::ms_state_table_) / sizeof(*Scanner::ms_state_table_);
 
-ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_::DfaTransition_ const Scanner::ms_transition_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Interactive_S8_T16_A8_::DfaTransition_ const Scanner::ms_transition_table_[] =
 {
     { 1 },
     { 1 },
-    { 29 },
-    { 29 },
+    { 28 },
+    { 28 },
     { 1 },
     { 1 },
-    { 29 },
-    { 29 },
+    { 28 },
+    { 28 },
     { 1 },
     { 1 },
-    { 29 },
-    { 29 },
+    { 28 },
+    { 28 },
     { 1 },
     { 1 },
-    { 29 },
-    { 29 },
+    { 28 },
+    { 28 },
     { 1 },
     { 1 },
-    { 29 },
-    { 29 },
+    { 28 },
+    { 28 },
     { 1 },
     { 1 },
-    { 29 },
-    { 29 },
+    { 28 },
+    { 28 },
     { 1 },
     { 1 },
-    { 29 },
-    { 29 },
+    { 28 },
+    { 28 },
     { 1 },
     { 1 },
+    { 28 },
+    { 28 },
     { 29 },
-    { 29 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
     { 2 },
     { 3 },
     { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 3 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 5 },
     { 5 },
     { 5 },
-    { 5 },
-    { 2 },
-    { 5 },
     { 2 },
-    { 5 },
     { 6 },
     { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 5 },
-    { 2 },
-    { 5 },
-    { 2 },
-    { 2 },
-    { 2 },
     { 2 },
     { 2 },
+    { 14 },
     { 2 },
     { 15 },
     { 2 },
+    { 19 },
+    { 22 },
     { 2 },
-    { 16 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 20 },
-    { 23 },
-    { 2 },
-    { 2 },
-    { 26 },
-    { 2 },
-    { 28 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
+    { 25 },
+    { 27 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 7 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 8 },
     { 8 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 8 },
     { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 8 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
     { 9 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
+    { 29 },
     { 9 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 10 },
-    { 30 },
-    { 10 },
-    { 30 },
-    { 30 },
+    { 29 },
     { 11 },
     { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 11 },
     { 12 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 12 },
     { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 7 },
-    { 30 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 7 },
-    { 30 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
-    { 14 },
+    { 13 },
+    { 13 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 16 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 17 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 18 },
-    { 19 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 20 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 21 },
-    { 22 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 23 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 24 },
-    { 25 },
-    { 27 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 26 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
     { 2 },
     { 3 },
     { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 3 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 5 },
-    { 5 },
-    { 5 },
     { 5 },
-    { 2 },
     { 5 },
     { 2 },
-    { 5 },
     { 6 },
     { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 13 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 5 },
-    { 2 },
-    { 5 },
-    { 2 },
-    { 2 },
-    { 2 },
     { 2 },
     { 2 },
+    { 14 },
     { 2 },
     { 15 },
     { 2 },
+    { 19 },
+    { 22 },
     { 2 },
-    { 16 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 20 },
-    { 23 },
-    { 2 },
-    { 2 },
-    { 26 },
-    { 2 },
-    { 28 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 }
+    { 25 },
+    { 27 }
 };
 std::size_t const Scanner::ms_transition_count_ = sizeof(Scanner::ms_transition_table_) / sizeof(*Scanner::ms_transition_table_);
 
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 20 atom classes.
+std::uint8_t const Scanner::ms_atom_class_table_[256] =
+{
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 1, 1, 1, 1, 1, 1, 4, 4, 4, 5, 1, 5, 6, 4,
+    7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 4, 1,
+    1, 1, 1, 1, 10, 11, 1, 12, 13, 14, 1, 1, 15, 16, 1, 17,
+    18, 1, 19, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const Scanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    }
+};
+std::size_t const Scanner::ms_skip_set_count_ = sizeof(Scanner::ms_skip_set_table_) / sizeof(*Scanner::ms_skip_set_table_);
+
 char const *const Scanner::ms_accept_handler_regex_[] =
 {
     "{INTEGER}",
@@ -1181,8 +955,8 @@ std::uint32_t const Scanner::ms_accept_handler_count_ = sizeof(Scanner::ms_accep
 // ///////////////////////////////////////////////////////////////////////
 
 
-#line 56 "../calculator_scanner.reflex"
+#line 48 "../calculator_scanner.reflex"
 
 } // end of namespace Calculator
 
-#line 1189 "../calculator_scanner.cpp"
+#line 963 "../calculator_scanner.cpp"
@@ -7,10 +7,10 @@
 
 #include <iostream>
 
-#define REFLEX_CPP_DEBUG_CODE_(spew_code) if (DebugSpew()) { spew_code; }
+#define REFLEX_CPP_DEBUG_CODE_(spew_code) if (DebugSpewIsEnabled()) { spew_code; }
 
 
-#line 65 "Scanner.reflex"
+#line 57 "Scanner.reflex"
 
 #include "ast.hpp"
 #include <cassert>
@@ -43,14 +43,18 @@ void Scanner::AttachIstream (std::istream &in)
 
 Scanner::Scanner ()
     :
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_(
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_(
         ms_state_table_,
         ms_state_count_,
         ms_transition_table_,
         ms_transition_count_,
-        ms_accept_handler_count_)
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_,
+        1024)
 {
-    DebugSpew(false);
+    SetDebugSpewStream(NULL);
 
 
     ResetForNewInput();
@@ -69,10 +73,10 @@ Scanner::StateMachine::Name Scanner::CurrentStateMachine () const
     {
         default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
         case 0: return StateMachine::BLOCK_COMMENT;
-        case 18: return StateMachine::CHAR_LITERAL_END;
-        case 25: return StateMachine::CHAR_LITERAL_GUTS;
-        case 38: return StateMachine::MAIN;
-        case 59: return StateMachine::STRING_LITERAL_GUTS;
+        case 16: return StateMachine::CHAR_LITERAL_END;
+        case 23: return StateMachine::CHAR_LITERAL_GUTS;
+        case 35: return StateMachine::MAIN;
+        case 54: return StateMachine::STRING_LITERAL_GUTS;
     }
 }
 
@@ -86,66 +90,95 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
         state_machine == StateMachine::STRING_LITERAL_GUTS ||
         (false && "invalid StateMachine::Name"));
     REFLEX_CPP_DEBUG_CODE_(
-        std::cerr << 
-#line 119 "Scanner.reflex"
+        *DebugSpewStream() << 
+#line 111 "Scanner.reflex"
 "Scanner:"
-#line 93 "Scanner.cpp"
+#line 97 "Scanner.cpp"
  << " switching to state machine "
-                  << ms_state_machine_name_[state_machine];
+                           << ms_state_machine_name_[state_machine];
         if (ms_state_machine_mode_flags_[state_machine] != 0)
         {
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_CASE_INSENSITIVE_) != 0)
-                std::cerr << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_UNGREEDY_) != 0)
-                std::cerr << " %ungreedy";
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
+                *DebugSpewStream() << " %case_insensitive";
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_UNGREEDY_) != 0)
+                *DebugSpewStream() << " %ungreedy";
         }
-        std::cerr << std::endl)
+        *DebugSpewStream() << std::endl)
     InitialState_(ms_state_table_ + ms_state_machine_start_state_index_[state_machine]);
     ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
     assert(CurrentStateMachine() == state_machine);
 }
 
+Scanner::ScannerCheckpoint Scanner::Checkpoint ()
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 111 "Scanner.reflex"
+"Scanner:"
+#line 118 "Scanner.cpp"
+ << " taking checkpoint" << std::endl)
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_Noninteractive_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void Scanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 111 "Scanner.reflex"
+"Scanner:"
+#line 131 "Scanner.cpp"
+ << " restoring checkpoint" << std::endl)
+    ReflexCpp_::InputApparatus_Noninteractive_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void Scanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_Noninteractive_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
 void Scanner::ResetForNewInput ()
 {
     REFLEX_CPP_DEBUG_CODE_(
-        std::cerr << 
-#line 119 "Scanner.reflex"
+        *DebugSpewStream() << 
+#line 111 "Scanner.reflex"
 "Scanner:"
-#line 115 "Scanner.cpp"
+#line 148 "Scanner.cpp"
  << " executing reset-for-new-input actions and switching to state machine "
-                  << ms_state_machine_name_[StateMachine::START_];
+                           << ms_state_machine_name_[StateMachine::START_];
         if (ms_state_machine_mode_flags_[StateMachine::START_] != 0)
         {
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_CASE_INSENSITIVE_) != 0)
-                std::cerr << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_UNGREEDY_) != 0)
-                std::cerr << " %ungreedy";
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
+                *DebugSpewStream() << " %case_insensitive";
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_UNGREEDY_) != 0)
+                *DebugSpewStream() << " %ungreedy";
         }
-        std::cerr << std::endl)
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+        *DebugSpewStream() << std::endl)
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
     assert(CurrentStateMachine() == StateMachine::START_);
 
 
-#line 110 "Scanner.reflex"
+#line 102 "Scanner.reflex"
 
     m_state_machine_stack.clear();
 
-#line 134 "Scanner.cpp"
+#line 167 "Scanner.cpp"
 }
 
 TokenId Scanner::Scan (
-#line 54 "Scanner.reflex"
+#line 46 "Scanner.reflex"
  std::shared_ptr<Ast::Base> &token 
-#line 140 "Scanner.cpp"
+#line 173 "Scanner.cpp"
 ) throw()
 {
 
-#line 93 "Scanner.reflex"
+#line 85 "Scanner.reflex"
 
     token.reset();
     assert(token == nullptr);
 
-#line 149 "Scanner.cpp"
+#line 182 "Scanner.cpp"
 
     std::string work_string;
     // this is the main scanner loop.  it only breaks when an accept handler
@@ -153,17 +186,16 @@ TokenId Scanner::Scan (
     // exist (see comments below).
     while (true)
     {
-        // clear the previous accepted/rejected string.
-        work_string.clear();
         // reset the char buffer and other stuff
         PrepareToScan_();
 
         bool was_at_end_of_input_ = IsAtEndOfInput();
 
-        std::uint32_t accept_handler_index_ = RunDfa_(work_string);
-        // if no valid accept_handler_index_ was returned, then work_string
-        // was filled with everything up to the char after the keep_string
-        // cursor (i.e. the rejected atom).
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        work_string.assign(AcceptedStringBegin_(), AcceptedStringEnd_());
         if (accept_handler_index_ >= ms_accept_handler_count_)
         {
             // if we were already at the end of input and no
@@ -175,15 +207,15 @@ TokenId Scanner::Scan (
             std::uint8_t rejected_atom = rejected_string.empty() ? '\0' : *rejected_string.rbegin();
 
             REFLEX_CPP_DEBUG_CODE_(
-                std::cerr << 
-#line 119 "Scanner.reflex"
+                *DebugSpewStream() << 
+#line 111 "Scanner.reflex"
 "Scanner:"
-#line 182 "Scanner.cpp"
+#line 214 "Scanner.cpp"
  << " rejecting string ";
-                PrintString_(rejected_string);
-                std::cerr << " (rejected_atom is \'";
-                PrintAtom_(rejected_atom);
-                std::cerr << "\')" << std::endl)
+                PrintString_(*DebugSpewStream(), rejected_string);
+                *DebugSpewStream() << " (rejected_atom is \'";
+                PrintAtom_(*DebugSpewStream(), rejected_atom);
+                *DebugSpewStream() << "\')" << std::endl)
 
             // execute the rejection actions.  the do/while loop is so that a
             // break statement inside the rejection actions doesn't break out
@@ -191,11 +223,11 @@ TokenId Scanner::Scan (
             do
             {
 
-#line 107 "Scanner.reflex"
+#line 99 "Scanner.reflex"
 
     g_log << "unrecognized character " << CharLiteral(rejected_atom) << '\n';
 
-#line 199 "Scanner.cpp"
+#line 231 "Scanner.cpp"
 
             }
             while (false);
@@ -206,14 +238,14 @@ TokenId Scanner::Scan (
             std::string &accepted_string = work_string;
 
             REFLEX_CPP_DEBUG_CODE_(
-                std::cerr << 
-#line 119 "Scanner.reflex"
+                *DebugSpewStream() << 
+#line 111 "Scanner.reflex"
 "Scanner:"
-#line 213 "Scanner.cpp"
+#line 245 "Scanner.cpp"
  << " accepting string ";
-                PrintString_(accepted_string);
-                std::cerr << " in state machine " << ms_state_machine_name_[CurrentStateMachine()]
-                          << " using regex (" << ms_accept_handler_regex_[accept_handler_index_] << ")" << std::endl)
+                PrintString_(*DebugSpewStream(), accepted_string);
+                *DebugSpewStream() << " in state machine " << ms_state_machine_name_[CurrentStateMachine()]
+                                   << " using regex (" << ms_accept_handler_regex_[accept_handler_index_] << ")" << std::endl)
 
             // execute the appropriate accept handler.
             // the accepted string is in accepted_string.
@@ -222,12 +254,12 @@ TokenId Scanner::Scan (
                 case 0:
                 {
 
-#line 249 "Scanner.reflex"
+#line 240 "Scanner.reflex"
 
         m_state_machine_stack.push_back(CurrentStateMachine());
         // We're already in StateMachine::BLOCK_COMMENT; no need to change to it.
     
-#line 231 "Scanner.cpp"
+#line 263 "Scanner.cpp"
 
                 }
                 break;
@@ -235,13 +267,13 @@ TokenId Scanner::Scan (
                 case 1:
                 {
 
-#line 255 "Scanner.reflex"
+#line 246 "Scanner.reflex"
 
         assert(!m_state_machine_stack.empty());
         SwitchToStateMachine(m_state_machine_stack.back());
         m_state_machine_stack.pop_back();
     
-#line 245 "Scanner.cpp"
+#line 277 "Scanner.cpp"
 
                 }
                 break;
@@ -249,12 +281,12 @@ TokenId Scanner::Scan (
                 case 2:
                 {
 
-#line 262 "Scanner.reflex"
+#line 253 "Scanner.reflex"
 
         g_log << "unterminated block comment\n";
         return TokenId::END_OF_FILE;
     
-#line 258 "Scanner.cpp"
+#line 290 "Scanner.cpp"
 
                 }
                 break;
@@ -262,7 +294,7 @@ TokenId Scanner::Scan (
                 case 3:
                 {
 
-#line 333 "Scanner.reflex"
+#line 324 "Scanner.reflex"
 
         assert(token != nullptr);
         SwitchToStateMachine(StateMachine::MAIN);
@@ -271,7 +303,7 @@ TokenId Scanner::Scan (
         else
             return TokenId::CHAR_LITERAL;
     
-#line 275 "Scanner.cpp"
+#line 307 "Scanner.cpp"
 
                 }
                 break;
@@ -279,7 +311,7 @@ TokenId Scanner::Scan (
                 case 4:
                 {
 
-#line 343 "Scanner.reflex"
+#line 334 "Scanner.reflex"
 
         g_log << "unterminated character literal\n";
         assert(token != nullptr);
@@ -287,7 +319,7 @@ TokenId Scanner::Scan (
         SwitchToStateMachine(StateMachine::MAIN);
         return TokenId::END_OF_FILE;
     
-#line 291 "Scanner.cpp"
+#line 323 "Scanner.cpp"
 
                 }
                 break;
@@ -295,7 +327,7 @@ TokenId Scanner::Scan (
                 case 5:
                 {
 
-#line 352 "Scanner.reflex"
+#line 343 "Scanner.reflex"
 
         g_log << "malformed character literal\n";
         assert(token != nullptr);
@@ -303,7 +335,7 @@ TokenId Scanner::Scan (
         SwitchToStateMachine(StateMachine::MAIN);
         return TokenId::BAD_TOKEN;
     
-#line 307 "Scanner.cpp"
+#line 339 "Scanner.cpp"
 
                 }
                 break;
@@ -311,7 +343,7 @@ TokenId Scanner::Scan (
                 case 6:
                 {
 
-#line 271 "Scanner.reflex"
+#line 262 "Scanner.reflex"
 
         assert(accepted_string.length() >= 2);
         assert(accepted_string[0] == '\\');
@@ -325,7 +357,7 @@ TokenId Scanner::Scan (
             token = Ast::char_literal(char(value));
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 329 "Scanner.cpp"
+#line 361 "Scanner.cpp"
 
                 }
                 break;
@@ -333,7 +365,7 @@ TokenId Scanner::Scan (
                 case 7:
                 {
 
-#line 286 "Scanner.reflex"
+#line 277 "Scanner.reflex"
 
         assert(accepted_string.length() >= 3);
         assert(accepted_string[0] == '\\');
@@ -348,7 +380,7 @@ TokenId Scanner::Scan (
             token = Ast::char_literal(char(value));
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 352 "Scanner.cpp"
+#line 384 "Scanner.cpp"
 
                 }
                 break;
@@ -356,14 +388,14 @@ TokenId Scanner::Scan (
                 case 8:
                 {
 
-#line 302 "Scanner.reflex"
+#line 293 "Scanner.reflex"
 
         assert(accepted_string.length() == 2);
         assert(accepted_string[0] == '\\');
         token = Ast::char_literal(EscapedChar(accepted_string[1]));
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 367 "Scanner.cpp"
+#line 399 "Scanner.cpp"
 
                 }
                 break;
@@ -371,13 +403,13 @@ TokenId Scanner::Scan (
                 case 9:
                 {
 
-#line 310 "Scanner.reflex"
+#line 301 "Scanner.reflex"
 
         assert(accepted_string.length() == 1);
         token = Ast::char_literal(accepted_string[0]);
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 381 "Scanner.cpp"
+#line 413 "Scanner.cpp"
 
                 }
                 break;
@@ -385,12 +417,12 @@ TokenId Scanner::Scan (
                 case 10:
                 {
 
-#line 317 "Scanner.reflex"
+#line 308 "Scanner.reflex"
 
         g_log << "unterminated character literal\n";
         return TokenId::END_OF_FILE;
     
-#line 394 "Scanner.cpp"
+#line 426 "Scanner.cpp"
 
                 }
                 break;
@@ -398,13 +430,13 @@ TokenId Scanner::Scan (
                 case 11:
                 {
 
-#line 323 "Scanner.reflex"
+#line 314 "Scanner.reflex"
 
         g_log << "unexpected character " << CharLiteral(accepted_string[0]) << " in character literal\n";
         token = Ast::bad_token();
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 408 "Scanner.cpp"
+#line 440 "Scanner.cpp"
 
                 }
                 break;
@@ -412,12 +444,12 @@ TokenId Scanner::Scan (
                 case 12:
                 {
 
-#line 180 "Scanner.reflex"
+#line 171 "Scanner.reflex"
 
         m_state_machine_stack.push_back(CurrentStateMachine());
         SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
     
-#line 421 "Scanner.cpp"
+#line 453 "Scanner.cpp"
 
                 }
                 break;
@@ -425,11 +457,11 @@ TokenId Scanner::Scan (
                 case 13:
                 {
 
-#line 186 "Scanner.reflex"
+#line 177 "Scanner.reflex"
 
         // Do nothing, don't even return a token.
     
-#line 433 "Scanner.cpp"
+#line 465 "Scanner.cpp"
 
                 }
                 break;
@@ -437,11 +469,11 @@ TokenId Scanner::Scan (
                 case 14:
                 {
 
-#line 191 "Scanner.reflex"
+#line 182 "Scanner.reflex"
 
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_GUTS);
     
-#line 445 "Scanner.cpp"
+#line 477 "Scanner.cpp"
 
                 }
                 break;
@@ -449,12 +481,12 @@ TokenId Scanner::Scan (
                 case 15:
                 {
 
-#line 196 "Scanner.reflex"
+#line 187 "Scanner.reflex"
 
         token = Ast::string_literal(accepted_string);
         SwitchToStateMachine(StateMachine::STRING_LITERAL_GUTS);
     
-#line 458 "Scanner.cpp"
+#line 490 "Scanner.cpp"
 
                 }
                 break;
@@ -462,12 +494,12 @@ TokenId Scanner::Scan (
                 case 16:
                 {
 
-#line 202 "Scanner.reflex"
+#line 193 "Scanner.reflex"
 
         token = Ast::integer_literal(atoll(accepted_string.c_str()));
         return TokenId::INTEGER_LITERAL;
     
-#line 471 "Scanner.cpp"
+#line 503 "Scanner.cpp"
 
                 }
                 break;
@@ -475,12 +507,12 @@ TokenId Scanner::Scan (
                 case 17:
                 {
 
-#line 208 "Scanner.reflex"
+#line 199 "Scanner.reflex"
 
         token = Ast::numeric_literal(atof(accepted_string.c_str()));
         return TokenId::NUMERIC_LITERAL;
     
-#line 484 "Scanner.cpp"
+#line 516 "Scanner.cpp"
 
                 }
                 break;
@@ -488,12 +520,12 @@ TokenId Scanner::Scan (
                 case 18:
                 {
 
-#line 214 "Scanner.reflex"
+#line 205 "Scanner.reflex"
 
         token = Ast::identifier(accepted_string);
         return TokenId::IDENTIFIER;
     
-#line 497 "Scanner.cpp"
+#line 529 "Scanner.cpp"
 
                 }
                 break;
@@ -501,11 +533,11 @@ TokenId Scanner::Scan (
                 case 19:
                 {
 
-#line 220 "Scanner.reflex"
+#line 211 "Scanner.reflex"
 
         return TokenId(accepted_string[0]);
     
-#line 509 "Scanner.cpp"
+#line 541 "Scanner.cpp"
 
                 }
                 break;
@@ -513,11 +545,11 @@ TokenId Scanner::Scan (
                 case 20:
                 {
 
-#line 225 "Scanner.reflex"
+#line 216 "Scanner.reflex"
 
         // Ignore all whitespace.
     
-#line 521 "Scanner.cpp"
+#line 553 "Scanner.cpp"
 
                 }
                 break;
@@ -525,11 +557,11 @@ TokenId Scanner::Scan (
                 case 21:
                 {
 
-#line 230 "Scanner.reflex"
+#line 221 "Scanner.reflex"
 
         // Ignore newlines.
     
-#line 533 "Scanner.cpp"
+#line 565 "Scanner.cpp"
 
                 }
                 break;
@@ -537,11 +569,11 @@ TokenId Scanner::Scan (
                 case 22:
                 {
 
-#line 235 "Scanner.reflex"
+#line 226 "Scanner.reflex"
 
         return TokenId::END_OF_FILE;
     
-#line 545 "Scanner.cpp"
+#line 577 "Scanner.cpp"
 
                 }
                 break;
@@ -549,12 +581,12 @@ TokenId Scanner::Scan (
                 case 23:
                 {
 
-#line 240 "Scanner.reflex"
+#line 231 "Scanner.reflex"
 
         g_log << "unexpected character " << CharLiteral(accepted_string[0]) << '\n';
         return TokenId::BAD_TOKEN;
     
-#line 558 "Scanner.cpp"
+#line 590 "Scanner.cpp"
 
                 }
                 break;
@@ -562,7 +594,7 @@ TokenId Scanner::Scan (
                 case 24:
                 {
 
-#line 364 "Scanner.reflex"
+#line 355 "Scanner.reflex"
 
         assert(token != nullptr);
         // get rid of the trailing endquote
@@ -595,7 +627,7 @@ TokenId Scanner::Scan (
         SwitchToStateMachine(StateMachine::MAIN);
         return TokenId::STRING_LITERAL;
     
-#line 599 "Scanner.cpp"
+#line 631 "Scanner.cpp"
 
                 }
                 break;
@@ -603,14 +635,14 @@ TokenId Scanner::Scan (
                 case 25:
                 {
 
-#line 398 "Scanner.reflex"
+#line 389 "Scanner.reflex"
 
         g_log << "unterminated string literal\n";
         assert(token != nullptr);
         token.reset();
         return TokenId::END_OF_FILE;
     
-#line 614 "Scanner.cpp"
+#line 646 "Scanner.cpp"
 
                 }
                 break;
@@ -621,74 +653,79 @@ TokenId Scanner::Scan (
     }
 
 
-#line 97 "Scanner.reflex"
+#line 89 "Scanner.reflex"
 
     assert(false && "you didn't handle END_OF_FILE properly");
     return TokenId::END_OF_FILE;
 
-#line 630 "Scanner.cpp"
+#line 662 "Scanner.cpp"
 }
 
 void Scanner::KeepString ()
 {
-    REFLEX_CPP_DEBUG_CODE_(std::cerr << 
-#line 119 "Scanner.reflex"
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 111 "Scanner.reflex"
 "Scanner:"
-#line 638 "Scanner.cpp"
+#line 670 "Scanner.cpp"
  << " keeping string" << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::KeepString();
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::KeepString();
 }
 
 void Scanner::Unaccept (std::uint32_t unaccept_char_count)
 {
-    REFLEX_CPP_DEBUG_CODE_(std::cerr << 
-#line 119 "Scanner.reflex"
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 111 "Scanner.reflex"
 "Scanner:"
-#line 648 "Scanner.cpp"
+#line 680 "Scanner.cpp"
  << " unaccepting " << unaccept_char_count << " char" << (unaccept_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::Unaccept(unaccept_char_count);
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::Unaccept(unaccept_char_count);
 }
 
 void Scanner::Unreject (std::uint32_t unreject_char_count)
 {
-    REFLEX_CPP_DEBUG_CODE_(std::cerr << 
-#line 119 "Scanner.reflex"
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 111 "Scanner.reflex"
 "Scanner:"
-#line 658 "Scanner.cpp"
+#line 690 "Scanner.cpp"
  << " unrejecting " << unreject_char_count << " char" << (unreject_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::Unreject(unreject_char_count);
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::Unreject(unreject_char_count);
 }
 
 // ///////////////////////////////////////////////////////////////////////
 // begin internal reflex-generated parser guts -- don't use
 // ///////////////////////////////////////////////////////////////////////
 
-void Scanner::PrintAtom_ (std::uint8_t atom)
+void Scanner::PrintAtom_ (std::ostream &out, std::uint8_t atom)
 {
-    if (atom == '\\')                    std::cerr << "\\\\";
-    else if (atom == '"')                std::cerr << "\\\"";
-    else if (atom >= ' ' && atom <= '~') std::cerr << atom;
-    else if (atom == '\n')               std::cerr << "\\n";
-    else if (atom == '\t')               std::cerr << "\\t";
-    else if (atom == '\0')               std::cerr << "\\0";
+    if (atom == '\\')                    out << "\\\\";
+    else if (atom == '"')                out << "\\\"";
+    else if (atom >= ' ' && atom <= '~') out << atom;
+    else if (atom == '\n')               out << "\\n";
+    else if (atom == '\t')               out << "\\t";
+    else if (atom == '\0')               out << "\\0";
     else
     {
-        std::cerr.width(2);
-        std::cerr << "\\x" << std::hex << std::uppercase << std::uint16_t(atom);
-        std::cerr.width(1);
+        out.width(2);
+        out << "\\x" << std::hex << std::uppercase << std::uint16_t(atom);
+        out.width(1);
     }
 }
 
-void Scanner::PrintString_ (std::string const &s)
+void Scanner::PrintString_ (std::ostream &out, std::string const &s)
+{
+    PrintString_(out, s.data(), s.length());
+}
+
+void Scanner::PrintString_ (std::ostream &out, char const *s, std::size_t length)
 {
-    // save the existing std::cerr properties for later restoration
-    std::ios_base::fmtflags saved_stream_flags = std::cerr.flags();
-    char saved_stream_fill = std::cerr.fill();
-    std::streamsize saved_stream_width = std::cerr.width();
-    std::streamsize saved_stream_precision = std::cerr.precision();
+    // save the existing ostream properties for later restoration
+    std::ios_base::fmtflags saved_stream_flags = out.flags();
+    char saved_stream_fill = out.fill();
+    std::streamsize saved_stream_width = out.width();
+    std::streamsize saved_stream_precision = out.precision();
 
     // clear all format flags to a neutral state
-    std::cerr.unsetf(
+    out.unsetf(
         std::ios_base::boolalpha|std::ios_base::dec|std::ios_base::fixed|
         std::ios_base::hex|std::ios_base::internal|std::ios_base::left|
         std::ios_base::oct|std::ios_base::right|std::ios_base::scientific|
@@ -696,27 +733,27 @@ void Scanner::PrintString_ (std::string const &s)
         std::ios_base::skipws|std::ios_base::unitbuf|std::ios_base::uppercase|
         std::ios_base::adjustfield|std::ios_base::basefield|std::ios_base::floatfield);
     // the '0' char is used hex escape chars, which always have width 2
-    std::cerr.fill('0');
-
-    std::cerr << '"';
-    for (std::string::size_type i = 0; i < s.size(); ++i)
-        PrintAtom_(s[i]);
-    std::cerr << '"';
-
-    // restore the saved std::cerr properties
-    std::cerr.setf(saved_stream_flags);
-    std::cerr.fill(saved_stream_fill);
-    std::cerr.width(saved_stream_width);
-    std::cerr.precision(saved_stream_precision);
+    out.fill('0');
+
+    out << '"';
+    for (std::size_t i = 0; i < length; ++i)
+        PrintAtom_(out, s[i]);
+    out << '"';
+
+    // restore the saved out properties
+    out.setf(saved_stream_flags);
+    out.fill(saved_stream_fill);
+    out.width(saved_stream_width);
+    out.precision(saved_stream_precision);
 }
 
 std::uint32_t const Scanner::ms_state_machine_start_state_index_[] =
 {
     0,
-    18,
-    25,
-    38,
-    59,
+    16,
+    23,
+    35,
+    54,
 };
 std::uint8_t const Scanner::ms_state_machine_mode_flags_[] =
 {
@@ -738,123 +775,109 @@ std::uint32_t const Scanner::ms_state_machine_count_ = sizeof(Scanner::ms_state_
 
 // the order of the states indicates priority (only for accept states).
 // the lower the state's index in this array, the higher its priority.
-ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaState_ const Scanner::ms_state_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaState_ const Scanner::ms_state_table_[] =
 {
-    { 26, 32, 0, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 32, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 319, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 574, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 606, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 1, 32, 861, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 1, 255, 893, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 1, 255, 1148, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 2, 255, 1403, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 2, 255, 1658, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 1913, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 1945, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 0, 32, 2200, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 0, 255, 2232, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 0, 255, 2487, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 2, 255, 2742, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 2, 255, 2997, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 3252, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 3284, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 5, 0, 3539, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 3, 0, 3539, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 5, 32, 3539, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 4, 0, 3571, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 4, 255, 3571, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 3826, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 3858, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 11, 0, 4113, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 9, 0, 4113, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 11, 32, 4113, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 11, 95, 4145, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 32 },
-    { 8, 0, 4240, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 6, 8, 4240, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 6, 8, 4248, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 8, 55, 4256, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 7, 55, 4311, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 10, 95, 4366, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 32 },
-    { 10, 255, 4461, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 4716, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 4748, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 23, 0, 5003, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 20, 0, 5003, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 21, 0, 5003, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 15, 0, 5003, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 14, 0, 5003, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 19, 0, 5003, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 19, 6, 5003, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 42 },
-    { 12, 0, 5009, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 13, 255, 5009, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 16, 56, 5264, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 17, 54, 5320, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 26, 15, 5374, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 43 },
-    { 26, 10, 5389, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 17, 10, 5399, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 16, 56, 5409, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 16, 56, 5465, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 46 },
-    { 18, 75, 5521, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 18, 75, 5596, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 22, 255, 5671, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 5926, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 5958, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 6213, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 25, 255, 6245, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 24, 32, 6500, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 24, 255, 6532, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 26, 32, 6787, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 26, 255, 6819, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 25, 255, 7074, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 24, 255, 7329, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 }
+    { 0, 26, 32, 2, 0 },
+    { 32, 26, 21, 0, 0 },
+    { 53, 26, 32, 2, 0 },
+    { 85, 26, 21, 0, 0 },
+    { 106, 26, 32, 2, 0 },
+    { 138, 26, 21, 0, 0 },
+    { 159, 1, 32, 2, 0 },
+    { 191, 1, 21, 0, 0 },
+    { 212, 2, 21, 0, 0 },
+    { 233, 2, 21, 0, 0 },
+    { 254, 26, 32, 2, 0 },
+    { 286, 26, 21, 0, 0 },
+    { 307, 0, 32, 2, 0 },
+    { 339, 0, 21, 0, 0 },
+    { 360, 2, 21, 0, 0 },
+    { 381, 2, 21, 0, 0 },
+    { 402, 26, 32, 2, 0 },
+    { 434, 26, 21, 0, 0 },
+    { 455, 5, 0, 0, 0 },
+    { 455, 3, 0, 0, 0 },
+    { 455, 5, 32, 2, 0 },
+    { 487, 4, 0, 0, 0 },
+    { 487, 4, 21, 0, 0 },
+    { 508, 26, 32, 2, 0 },
+    { 540, 26, 21, 0, 0 },
+    { 561, 11, 0, 0, 0 },
+    { 561, 9, 0, 0, 0 },
+    { 561, 11, 32, 2, 0 },
+    { 593, 11, 21, 0, 0 },
+    { 614, 8, 0, 0, 0 },
+    { 614, 6, 21, 0, 1 },
+    { 635, 8, 21, 0, 0 },
+    { 656, 7, 21, 0, 2 },
+    { 677, 10, 21, 0, 0 },
+    { 698, 10, 21, 0, 0 },
+    { 719, 26, 32, 2, 0 },
+    { 751, 26, 21, 0, 0 },
+    { 772, 23, 0, 0, 0 },
+    { 772, 20, 0, 0, 0 },
+    { 772, 21, 0, 0, 0 },
+    { 772, 15, 0, 0, 0 },
+    { 772, 14, 0, 0, 0 },
+    { 772, 19, 0, 0, 0 },
+    { 772, 19, 21, 0, 0 },
+    { 793, 12, 0, 0, 0 },
+    { 793, 13, 21, 0, 3 },
+    { 814, 16, 21, 0, 0 },
+    { 835, 17, 21, 0, 4 },
+    { 856, 26, 21, 0, 0 },
+    { 877, 26, 21, 0, 0 },
+    { 898, 17, 21, 0, 4 },
+    { 919, 16, 21, 0, 4 },
+    { 940, 18, 21, 0, 5 },
+    { 961, 22, 21, 0, 0 },
+    { 982, 26, 32, 2, 0 },
+    { 1014, 26, 21, 0, 0 },
+    { 1035, 26, 32, 2, 0 },
+    { 1067, 25, 21, 0, 0 },
+    { 1088, 24, 32, 2, 0 },
+    { 1120, 24, 21, 0, 0 },
+    { 1141, 26, 32, 2, 0 },
+    { 1173, 26, 21, 0, 0 },
+    { 1194, 25, 21, 0, 0 }
 };
 std::size_t const Scanner::ms_state_count_ = sizeof(Scanner::ms_state_table_) / sizeof(*Scanner::ms_state_table_);
 
-ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const Scanner::ms_transition_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaTransition_ const Scanner::ms_transition_table_[] =
 {
     { 1 },
     { 1 },
-    { 17 },
-    { 17 },
+    { 15 },
+    { 15 },
     { 1 },
     { 1 },
-    { 17 },
-    { 17 },
+    { 15 },
+    { 15 },
     { 1 },
     { 1 },
-    { 17 },
-    { 17 },
+    { 15 },
+    { 15 },
     { 1 },
     { 1 },
-    { 17 },
-    { 17 },
+    { 15 },
+    { 15 },
     { 1 },
     { 1 },
-    { 17 },
-    { 17 },
+    { 15 },
+    { 15 },
     { 1 },
     { 1 },
-    { 17 },
-    { 17 },
+    { 15 },
+    { 15 },
     { 1 },
     { 1 },
-    { 17 },
-    { 17 },
+    { 15 },
+    { 15 },
     { 1 },
     { 1 },
-    { 17 },
-    { 17 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
+    { 15 },
+    { 15 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -863,8 +886,10 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
+    { 10 },
     { 2 },
     { 2 },
     { 2 },
@@ -873,6 +898,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 3 },
+    { 3 },
+    { 9 },
+    { 9 },
+    { 3 },
+    { 3 },
+    { 9 },
+    { 9 },
+    { 3 },
+    { 3 },
+    { 9 },
+    { 9 },
+    { 3 },
+    { 3 },
+    { 9 },
+    { 9 },
+    { 3 },
+    { 3 },
+    { 9 },
+    { 9 },
+    { 3 },
+    { 3 },
+    { 9 },
+    { 9 },
+    { 3 },
+    { 3 },
+    { 9 },
+    { 9 },
+    { 3 },
+    { 3 },
+    { 9 },
+    { 9 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -881,19 +939,51 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
     { 2 },
     { 2 },
     { 2 },
     { 2 },
-    { 4 },
     { 2 },
     { 2 },
     { 2 },
     { 2 },
-    { 11 },
     { 2 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -902,8 +992,10 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
+    { 6 },
     { 2 },
     { 2 },
     { 2 },
@@ -912,6 +1004,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -920,6 +1045,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
     { 2 },
@@ -931,6 +1057,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -939,8 +1066,10 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
+    { 6 },
     { 2 },
     { 2 },
     { 2 },
@@ -949,6 +1078,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -957,6 +1087,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
     { 2 },
@@ -968,6 +1099,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -976,6 +1140,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 12 },
     { 2 },
     { 2 },
     { 2 },
@@ -987,6 +1152,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 13 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -995,8 +1193,10 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
+    { 6 },
     { 2 },
     { 2 },
     { 2 },
@@ -1005,6 +1205,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -1013,6 +1214,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 12 },
     { 2 },
     { 2 },
     { 2 },
@@ -1024,6 +1226,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 63 },
     { 2 },
     { 2 },
     { 2 },
@@ -1032,8 +1235,10 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
+    { 10 },
     { 2 },
     { 2 },
     { 2 },
@@ -1042,7365 +1247,907 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 3 },
-    { 3 },
-    { 10 },
-    { 10 },
-    { 3 },
-    { 3 },
-    { 10 },
-    { 10 },
-    { 3 },
-    { 3 },
-    { 10 },
-    { 10 },
-    { 3 },
-    { 3 },
-    { 10 },
-    { 10 },
-    { 3 },
-    { 3 },
-    { 10 },
-    { 10 },
-    { 3 },
-    { 3 },
-    { 10 },
-    { 10 },
-    { 3 },
-    { 3 },
-    { 10 },
-    { 10 },
-    { 3 },
-    { 3 },
-    { 10 },
-    { 10 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 6 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 6 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 12 },
-    { 12 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 16 },
-    { 16 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 13 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 14 },
-    { 14 },
-    { 15 },
-    { 15 },
-    { 14 },
-    { 14 },
-    { 15 },
-    { 15 },
-    { 14 },
-    { 14 },
-    { 15 },
-    { 15 },
-    { 14 },
-    { 14 },
-    { 15 },
-    { 15 },
-    { 14 },
-    { 14 },
-    { 15 },
-    { 15 },
-    { 14 },
-    { 14 },
-    { 15 },
-    { 15 },
-    { 14 },
-    { 14 },
-    { 15 },
-    { 15 },
-    { 14 },
-    { 14 },
-    { 15 },
-    { 15 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 6 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 6 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 13 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 11 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 19 },
-    { 19 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 19 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 19 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 19 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 19 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 19 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 19 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 19 },
-    { 24 },
-    { 24 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 21 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 22 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 23 },
-    { 23 },
-    { 20 },
-    { 20 },
-    { 23 },
-    { 23 },
-    { 20 },
-    { 20 },
-    { 23 },
-    { 23 },
-    { 20 },
-    { 20 },
-    { 23 },
-    { 23 },
-    { 20 },
-    { 20 },
-    { 23 },
-    { 23 },
-    { 20 },
-    { 20 },
-    { 23 },
-    { 23 },
-    { 20 },
-    { 20 },
-    { 23 },
-    { 23 },
-    { 20 },
-    { 20 },
-    { 23 },
-    { 23 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 21 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 22 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 26 },
-    { 26 },
-    { 37 },
-    { 37 },
-    { 26 },
-    { 26 },
-    { 37 },
-    { 37 },
-    { 26 },
-    { 26 },
-    { 37 },
-    { 37 },
-    { 26 },
-    { 26 },
-    { 37 },
-    { 37 },
-    { 26 },
-    { 26 },
-    { 37 },
-    { 37 },
-    { 26 },
-    { 26 },
-    { 37 },
-    { 37 },
-    { 26 },
-    { 26 },
-    { 37 },
-    { 37 },
-    { 26 },
-    { 26 },
-    { 37 },
-    { 37 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 28 },
-    { 28 },
-    { 27 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 27 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 29 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 30 },
-    { 30 },
-    { 36 },
-    { 36 },
-    { 30 },
-    { 30 },
-    { 36 },
-    { 36 },
-    { 30 },
-    { 30 },
-    { 36 },
-    { 36 },
-    { 30 },
-    { 30 },
-    { 36 },
-    { 36 },
-    { 30 },
-    { 30 },
-    { 36 },
-    { 36 },
-    { 30 },
-    { 30 },
-    { 36 },
-    { 36 },
-    { 30 },
-    { 30 },
-    { 36 },
-    { 36 },
-    { 30 },
-    { 30 },
-    { 36 },
-    { 36 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 34 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 33 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 35 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 34 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 31 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 28 },
-    { 28 },
-    { 27 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 27 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 29 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 28 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 39 },
-    { 39 },
-    { 58 },
-    { 58 },
-    { 39 },
-    { 39 },
-    { 58 },
-    { 58 },
-    { 39 },
-    { 39 },
-    { 58 },
-    { 58 },
-    { 39 },
-    { 39 },
-    { 58 },
-    { 58 },
-    { 39 },
-    { 39 },
-    { 58 },
-    { 58 },
-    { 39 },
-    { 39 },
-    { 58 },
-    { 58 },
-    { 39 },
-    { 39 },
-    { 58 },
-    { 58 },
-    { 39 },
-    { 39 },
-    { 58 },
-    { 58 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 41 },
-    { 42 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 41 },
-    { 40 },
-    { 43 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 44 },
-    { 45 },
-    { 45 },
-    { 45 },
-    { 45 },
-    { 40 },
-    { 45 },
-    { 45 },
-    { 46 },
-    { 49 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 45 },
-    { 45 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 45 },
-    { 40 },
-    { 45 },
-    { 45 },
-    { 56 },
-    { 40 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 40 },
-    { 45 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 47 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 69 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 48 },
-    { 50 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 51 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 51 },
-    { 50 },
-    { 50 },
-    { 50 },
-    { 50 },
-    { 50 },
-    { 50 },
-    { 50 },
-    { 50 },
-    { 50 },
-    { 50 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 51 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 51 },
-    { 52 },
-    { 69 },
-    { 52 },
-    { 69 },
-    { 69 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 53 },
-    { 50 },
-    { 69 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 51 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 51 },
-    { 50 },
-    { 69 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 55 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 51 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 51 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 57 },
-    { 69 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 69 },
-    { 57 },
-    { 69 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 57 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 41 },
-    { 42 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 41 },
-    { 40 },
-    { 43 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 44 },
-    { 45 },
-    { 45 },
-    { 45 },
-    { 45 },
-    { 40 },
-    { 45 },
-    { 45 },
-    { 46 },
-    { 49 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 54 },
-    { 45 },
-    { 45 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 45 },
-    { 40 },
-    { 45 },
-    { 45 },
-    { 56 },
-    { 40 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 56 },
-    { 40 },
-    { 45 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 40 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 63 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 65 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 60 },
-    { 60 },
-    { 62 },
-    { 62 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 63 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 65 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 64 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 64 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 64 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 64 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 64 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 64 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 64 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 64 },
-    { 64 },
-    { 68 },
-    { 68 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 63 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 65 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 66 },
-    { 66 },
-    { 67 },
-    { 67 },
-    { 66 },
-    { 66 },
-    { 67 },
-    { 67 },
-    { 66 },
-    { 66 },
-    { 67 },
-    { 67 },
-    { 66 },
-    { 66 },
-    { 67 },
-    { 67 },
-    { 66 },
-    { 66 },
-    { 67 },
-    { 67 },
-    { 66 },
-    { 66 },
-    { 67 },
-    { 67 },
-    { 66 },
-    { 66 },
-    { 67 },
-    { 67 },
-    { 66 },
-    { 66 },
-    { 67 },
-    { 67 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
+    { 17 },
+    { 17 },
+    { 22 },
+    { 22 },
+    { 17 },
+    { 17 },
+    { 22 },
+    { 22 },
+    { 17 },
+    { 17 },
+    { 22 },
+    { 22 },
+    { 17 },
+    { 17 },
+    { 22 },
+    { 22 },
+    { 17 },
+    { 17 },
+    { 22 },
+    { 22 },
+    { 17 },
+    { 17 },
+    { 22 },
+    { 22 },
+    { 17 },
+    { 17 },
+    { 22 },
+    { 22 },
+    { 17 },
+    { 17 },
+    { 22 },
+    { 22 },
+    { 63 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 19 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 20 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 21 },
+    { 21 },
+    { 18 },
+    { 18 },
+    { 21 },
+    { 21 },
+    { 18 },
+    { 18 },
+    { 21 },
+    { 21 },
+    { 18 },
+    { 18 },
+    { 21 },
+    { 21 },
+    { 18 },
+    { 18 },
+    { 21 },
+    { 21 },
+    { 18 },
+    { 18 },
+    { 21 },
+    { 21 },
+    { 18 },
+    { 18 },
+    { 21 },
+    { 21 },
+    { 18 },
+    { 18 },
+    { 21 },
+    { 21 },
+    { 63 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 19 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 20 },
+    { 18 },
+    { 24 },
+    { 24 },
+    { 34 },
+    { 34 },
+    { 24 },
+    { 24 },
+    { 34 },
+    { 34 },
+    { 24 },
+    { 24 },
+    { 34 },
+    { 34 },
+    { 24 },
+    { 24 },
+    { 34 },
+    { 34 },
+    { 24 },
+    { 24 },
+    { 34 },
+    { 34 },
+    { 24 },
+    { 24 },
+    { 34 },
+    { 34 },
+    { 24 },
+    { 24 },
+    { 34 },
+    { 34 },
+    { 24 },
+    { 24 },
+    { 34 },
+    { 34 },
+    { 63 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 26 },
+    { 26 },
+    { 25 },
+    { 25 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 27 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 33 },
+    { 33 },
+    { 28 },
+    { 28 },
+    { 33 },
+    { 33 },
+    { 28 },
+    { 28 },
+    { 33 },
+    { 33 },
+    { 28 },
+    { 28 },
+    { 33 },
+    { 33 },
+    { 28 },
+    { 28 },
+    { 33 },
+    { 33 },
+    { 28 },
+    { 28 },
+    { 33 },
+    { 33 },
+    { 28 },
+    { 28 },
+    { 33 },
+    { 33 },
+    { 28 },
+    { 28 },
+    { 33 },
+    { 33 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 30 },
+    { 30 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 30 },
+    { 30 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 32 },
+    { 32 },
+    { 32 },
+    { 32 },
+    { 32 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 32 },
+    { 32 },
+    { 32 },
+    { 32 },
+    { 32 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 30 },
+    { 30 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 63 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 26 },
+    { 26 },
+    { 25 },
+    { 25 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 27 },
+    { 26 },
+    { 36 },
+    { 36 },
+    { 53 },
+    { 53 },
+    { 36 },
+    { 36 },
+    { 53 },
+    { 53 },
+    { 36 },
+    { 36 },
+    { 53 },
+    { 53 },
+    { 36 },
+    { 36 },
+    { 53 },
+    { 53 },
+    { 36 },
+    { 36 },
+    { 53 },
+    { 53 },
+    { 36 },
+    { 36 },
+    { 53 },
+    { 53 },
+    { 36 },
+    { 36 },
+    { 53 },
+    { 53 },
+    { 36 },
+    { 36 },
+    { 53 },
+    { 53 },
+    { 63 },
+    { 37 },
+    { 38 },
+    { 39 },
+    { 38 },
+    { 37 },
+    { 40 },
+    { 41 },
+    { 42 },
+    { 42 },
+    { 42 },
+    { 42 },
+    { 43 },
+    { 46 },
+    { 51 },
+    { 51 },
+    { 52 },
+    { 52 },
+    { 52 },
+    { 37 },
+    { 52 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 44 },
+    { 63 },
+    { 63 },
+    { 45 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 45 },
+    { 45 },
+    { 63 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 45 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 47 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 48 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 47 },
+    { 47 },
+    { 47 },
+    { 63 },
+    { 48 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 49 },
+    { 63 },
+    { 63 },
+    { 50 },
+    { 50 },
+    { 50 },
+    { 63 },
     { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 50 },
+    { 50 },
+    { 50 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 50 },
+    { 50 },
+    { 50 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 47 },
+    { 63 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 63 },
+    { 48 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 52 },
+    { 52 },
+    { 52 },
+    { 52 },
+    { 52 },
+    { 52 },
+    { 63 },
+    { 52 },
+    { 63 },
+    { 37 },
+    { 38 },
+    { 39 },
+    { 38 },
+    { 37 },
+    { 40 },
+    { 41 },
+    { 42 },
+    { 42 },
+    { 42 },
+    { 42 },
+    { 43 },
+    { 46 },
+    { 51 },
+    { 51 },
+    { 52 },
+    { 52 },
+    { 52 },
+    { 37 },
+    { 52 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 63 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 58 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 60 },
+    { 56 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 55 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 63 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 58 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 60 },
+    { 56 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 59 },
+    { 63 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 58 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 60 },
+    { 56 },
     { 61 },
     { 61 },
+    { 62 },
+    { 62 },
     { 61 },
     { 61 },
+    { 62 },
+    { 62 },
     { 61 },
     { 61 },
+    { 62 },
+    { 62 },
     { 61 },
     { 61 },
+    { 62 },
+    { 62 },
     { 61 },
     { 61 },
+    { 62 },
+    { 62 },
     { 61 },
     { 61 },
+    { 62 },
+    { 62 },
     { 61 },
     { 61 },
+    { 62 },
+    { 62 },
     { 61 },
     { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 65 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 },
-    { 61 }
+    { 62 },
+    { 62 },
+    { 63 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 63 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 },
+    { 56 }
 };
 std::size_t const Scanner::ms_transition_count_ = sizeof(Scanner::ms_transition_table_) / sizeof(*Scanner::ms_transition_table_);
 
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 21 atom classes.
+std::uint8_t const Scanner::ms_atom_class_table_[256] =
+{
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 5, 6, 5, 5, 5, 5, 7, 8, 8, 9, 10, 5, 10, 11, 12,
+    13, 14, 14, 14, 14, 14, 14, 14, 15, 15, 8, 8, 5, 5, 5, 5,
+    5, 16, 16, 16, 16, 17, 16, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 8, 19, 8, 8, 18,
+    5, 16, 16, 16, 16, 17, 16, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 20, 18, 18, 5, 8, 5, 5, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const Scanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 55, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 126, 0, 0, 0, 126, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        3, false,
+        { 48, 65, 97, 0 },
+        { 57, 70, 102, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 11, 0, 0 },
+        { 9, 255, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    }
+};
+std::size_t const Scanner::ms_skip_set_count_ = sizeof(Scanner::ms_skip_set_table_) / sizeof(*Scanner::ms_skip_set_table_);
+
 char const *const Scanner::ms_accept_handler_regex_[] =
 {
     "/[*]",
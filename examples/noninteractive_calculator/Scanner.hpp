@@ -5,16 +5,144 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
-#include <deque>
+#include <cstring>
 #include <iterator>
+#include <streambuf>
 #include <string>
+#include <type_traits>
+#include <vector>
+
+// runs of atoms which leave the DFA in the same state are skipped over (and
+// newlines are counted, if the input position is tracked) using SIMD
+// instructions where available.  define REFLEX_CPP_DISABLE_SIMD to use the
+// portable implementation.
+#if !defined(REFLEX_CPP_DISABLE_SIMD) && defined(__GNUC__) && defined(__AVX2__)
+#include <immintrin.h>
+#define REFLEX_CPP_USING_AVX2_
+#elif !defined(REFLEX_CPP_DISABLE_SIMD) && defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#define REFLEX_CPP_USING_SSE2_
+#endif
 
-#if !defined(ReflexCpp_namespace_)
-#define ReflexCpp_namespace_
 namespace ReflexCpp_ {
 
+// each apparatus class is guarded separately, so that scanners generated
+// with different interactivity, track_input_position and size_and_speed
+// settings (and, for the table-driven AutomatonApparatus, different DFA table
+// index widths) can be used in the same translation unit.
+
+#if !defined(ReflexCpp_AtomSkipSet_defined_)
+#define ReflexCpp_AtomSkipSet_defined_
+
+// /////////////////////////////////////////////////////////////////////////////
+// a set of input atoms on which a DFA state transitions to itself, so that a
+// run of them can be skipped over at once.  the SIMD implementation of Skip
+// uses the set's ranges (if it can be described by few enough of them), and
+// the portable implementation uses its bitmap.
+// /////////////////////////////////////////////////////////////////////////////
+
+struct AtomSkipSet_
+{
+    // bit atom%8 of m_bitmap[atom/8] is set iff atom is in the set.
+    std::uint8_t m_bitmap[32];
+    // the number of inclusive ranges [m_range_lower[i], m_range_upper[i]]
+    // which give the atoms in the set (or the atoms not in the set, if
+    // m_ranges_are_complement is true).  if this is 0, only m_bitmap is used.
+    std::uint8_t m_range_count;
+    bool m_ranges_are_complement;
+    std::uint8_t m_range_lower[4];
+    std::uint8_t m_range_upper[4];
+
+    bool Contains (std::uint8_t atom) const
+    {
+        return (m_bitmap[atom >> 3] & (1 << (atom & 7))) != 0;
+    }
+    // returns the first position in [begin, end) whose atom is not in the
+    // set, or end if there is none.
+    std::uint8_t const *Skip (std::uint8_t const *begin, std::uint8_t const *end) const
+    {
+        assert(begin <= end);
+        assert(m_range_count <= 4);
+#if defined(REFLEX_CPP_USING_AVX2_)
+        if (m_range_count > 0 && end - begin >= 32)
+        {
+            __m256i lower[4];
+            __m256i width[4];
+            for (std::uint8_t r = 0; r < m_range_count; ++r)
+            {
+                lower[r] = _mm256_set1_epi8(char(m_range_lower[r]));
+                width[r] = _mm256_set1_epi8(char(m_range_upper[r] - m_range_lower[r]));
+            }
+            do
+            {
+                __m256i atoms = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(begin));
+                // an atom is in a range iff its (unsigned, wrapped-around)
+                // offset from the range's lower bound is at most its width.
+                __m256i in_ranges = _mm256_setzero_si256();
+                for (std::uint8_t r = 0; r < m_range_count; ++r)
+                {
+                    __m256i offset = _mm256_sub_epi8(atoms, lower[r]);
+                    in_ranges = _mm256_or_si256(in_ranges, _mm256_cmpeq_epi8(_mm256_min_epu8(offset, width[r]), offset));
+                }
+                std::uint32_t stop_mask = std::uint32_t(_mm256_movemask_epi8(in_ranges));
+                if (!m_ranges_are_complement)
+                    stop_mask = ~stop_mask;
+                if (stop_mask != 0)
+                    return begin + __builtin_ctz(stop_mask);
+                begin += 32;
+            }
+            while (end - begin >= 32);
+        }
+#elif defined(REFLEX_CPP_USING_SSE2_)
+        if (m_range_count > 0 && end - begin >= 16)
+        {
+            __m128i lower[4];
+            __m128i width[4];
+            for (std::uint8_t r = 0; r < m_range_count; ++r)
+            {
+                lower[r] = _mm_set1_epi8(char(m_range_lower[r]));
+                width[r] = _mm_set1_epi8(char(m_range_upper[r] - m_range_lower[r]));
+            }
+            do
+            {
+                __m128i atoms = _mm_loadu_si128(reinterpret_cast<__m128i const *>(begin));
+                // an atom is in a range iff its (unsigned, wrapped-around)
+                // offset from the range's lower bound is at most its width.
+                __m128i in_ranges = _mm_setzero_si128();
+                for (std::uint8_t r = 0; r < m_range_count; ++r)
+                {
+                    __m128i offset = _mm_sub_epi8(atoms, lower[r]);
+                    in_ranges = _mm_or_si128(in_ranges, _mm_cmpeq_epi8(_mm_min_epu8(offset, width[r]), offset));
+                }
+                std::uint32_t stop_mask = std::uint32_t(_mm_movemask_epi8(in_ranges));
+                if (!m_ranges_are_complement)
+                    stop_mask = ~stop_mask & 0xFFFF;
+                if (stop_mask != 0)
+                    return begin + __builtin_ctz(stop_mask);
+                begin += 16;
+            }
+            while (end - begin >= 16);
+        }
+#endif
+        while (begin != end && Contains(*begin))
+            ++begin;
+        return begin;
+    }
+}; // end of struct ReflexCpp_::AtomSkipSet_
+
+// the skip set tables are aggregate-initialized from constants, which is only
+// guaranteed to be static (not dynamic, and therefore not racy) initialization
+// for trivial standard-layout types.
+static_assert(std::is_trivial<AtomSkipSet_>::value && std::is_standard_layout<AtomSkipSet_>::value, "AtomSkipSet_ must be constant-initializable");
+
+#endif // !defined(ReflexCpp_AtomSkipSet_defined_)
+
+#if !defined(ReflexCpp_InputApparatus_Noninteractive_defined_)
+#define ReflexCpp_InputApparatus_Noninteractive_defined_
+
 // /////////////////////////////////////////////////////////////////////////////
 // implements the InputApparatus interface as described in the documentation
 // /////////////////////////////////////////////////////////////////////////////
@@ -23,152 +151,314 @@ class InputApparatus_Noninteractive_
 {
 protected:
 
-    InputApparatus_Noninteractive_ ()
+    // should read at most block_capacity bytes into block and return the
+    // number of bytes read.  returning 0 indicates end of input.
+    typedef std::size_t (*ReadCallback)(void *context, char *block, std::size_t block_capacity);
+
+    InputApparatus_Noninteractive_ (std::size_t input_readahead)
         :
-        m_input_readahead(1024) // default, arbitrary reasonable lookahead
+        m_streambuf(NULL),
+        m_read_callback(NULL),
+        m_read_callback_context(NULL),
+        m_input_readahead(input_readahead)
     {
         // subclasses must call InputApparatus_Noninteractive_::ResetForNewInput_ in their constructors.
     }
 
     bool IsAtEndOfInput () { return IsConditionalMet(CF_END_OF_INPUT, CF_END_OF_INPUT); }
 
+    // each of IstreamIterator, InputStreambuf and InputReadCallback replaces
+    // any input source previously attached using the others.
     std::istream_iterator<char> const IstreamIterator () const { return m_it; }
-    void IstreamIterator (std::istream_iterator<char> it) { m_it = it; }
+    void IstreamIterator (std::istream_iterator<char> it)
+    {
+        m_it = it;
+        m_streambuf = NULL;
+        m_read_callback = NULL;
+    }
+    std::streambuf *InputStreambuf () const { return m_streambuf; }
+    void InputStreambuf (std::streambuf *streambuf)
+    {
+        m_it = m_it_end;
+        m_streambuf = streambuf;
+        m_read_callback = NULL;
+    }
+    void InputReadCallback (ReadCallback read_callback, void *context)
+    {
+        m_it = m_it_end;
+        m_streambuf = NULL;
+        m_read_callback = read_callback;
+        m_read_callback_context = context;
+    }
     std::size_t InputReadahead () const { return m_input_readahead; }
     void InputReadahead (std::size_t input_readahead) { m_input_readahead = input_readahead; }
 
     void KeepString ()
     {
-        assert(m_accept_cursor > m_start_cursor && "may only KeepString within accept or reject handler code");
+        assert(m_accept_cursor != NULL && "may only KeepString within accept or reject handler code");
         // reset the start cursor, so that the entire accepted string is
         // "put back in the already-read buffer", but we'll keep reading
         // from the same read cursor.
-        m_start_cursor = 0;
+        m_start_cursor = m_token_start;
         // save the accepted string's end position at the time of KeepString
         m_kept_string_cursor = m_accept_cursor;
         // leave the accept cursor to be reset in the next loop
     }
     void Unaccept (std::uint32_t unaccept_char_count)
     {
-        assert(m_accept_cursor > m_start_cursor && "may only Unaccept within accept handler code");
+        assert(m_accept_cursor != NULL && "may only Unaccept within accept handler code");
         UnacceptUnrejectCommon(unaccept_char_count);
     }
     void Unreject (std::uint32_t unreject_char_count)
     {
-        assert(m_accept_cursor == m_start_cursor+1 && "may only Unreject within accept handler code");
+        assert(m_accept_cursor == m_start_cursor && "may only Unreject within accept handler code");
         UnacceptUnrejectCommon(unreject_char_count);
     }
 
+    // the scan position recorded by TakeInputCheckpoint_.  the cursors are
+    // stored as offsets from the beginning of the input (including the
+    // initial '\0'), so that they stay valid when the buffer is compacted or
+    // reallocated.
+    struct InputCheckpoint
+    {
+        std::size_t m_token_start_offset;
+        std::size_t m_start_cursor_offset;
+        std::size_t m_read_cursor_offset;
+        std::size_t m_kept_string_cursor_offset;
+        // NO_OFFSET indicates that the accept cursor was NULL
+        std::size_t m_accept_cursor_offset;
+        bool m_keep_string_has_been_called;
+
+        enum { NO_OFFSET = ~std::size_t(0) };
+    }; // end of struct ReflexCpp_::InputApparatus_Noninteractive_::InputCheckpoint
+
+    // records the scan position, which may only be done between scans (not
+    // from handler code).  the previous atom (which the conditional flags
+    // depend on) and everything after it stays in the buffer until the
+    // checkpoint is passed to ReleaseInputCheckpoint_.
+    InputCheckpoint TakeInputCheckpoint_ ()
+    {
+        InputCheckpoint checkpoint;
+        checkpoint.m_token_start_offset = CursorOffset(m_token_start);
+        checkpoint.m_start_cursor_offset = CursorOffset(m_start_cursor);
+        checkpoint.m_read_cursor_offset = CursorOffset(m_read_cursor);
+        checkpoint.m_kept_string_cursor_offset = CursorOffset(m_kept_string_cursor);
+        checkpoint.m_accept_cursor_offset = m_accept_cursor != NULL ? CursorOffset(m_accept_cursor) : std::size_t(InputCheckpoint::NO_OFFSET);
+        checkpoint.m_keep_string_has_been_called = m_keep_string_has_been_called;
+        m_pinned_offsets.push_back(checkpoint.m_token_start_offset);
+        return checkpoint;
+    }
+    // returns to the scan position recorded by TakeInputCheckpoint_.  the
+    // checkpoint must not have been released.
+    void RestoreInputCheckpoint_ (InputCheckpoint const &checkpoint)
+    {
+        assert(std::find(m_pinned_offsets.begin(), m_pinned_offsets.end(), checkpoint.m_token_start_offset) != m_pinned_offsets.end() && "may not Restore a released checkpoint");
+        m_token_start = CursorAt(checkpoint.m_token_start_offset);
+        m_start_cursor = CursorAt(checkpoint.m_start_cursor_offset);
+        m_read_cursor = CursorAt(checkpoint.m_read_cursor_offset);
+        m_kept_string_cursor = CursorAt(checkpoint.m_kept_string_cursor_offset);
+        m_accept_cursor = checkpoint.m_accept_cursor_offset != std::size_t(InputCheckpoint::NO_OFFSET) ? CursorAt(checkpoint.m_accept_cursor_offset) : NULL;
+        m_keep_string_has_been_called = checkpoint.m_keep_string_has_been_called;
+    }
+    // unpins the buffered input kept for the checkpoint.  each checkpoint
+    // must be released exactly once, but not necessarily in order.
+    void ReleaseInputCheckpoint_ (InputCheckpoint const &checkpoint)
+    {
+        std::vector<std::size_t>::iterator it = std::find(m_pinned_offsets.begin(), m_pinned_offsets.end(), checkpoint.m_token_start_offset);
+        assert(it != m_pinned_offsets.end() && "may not release a checkpoint more than once");
+        if (it != m_pinned_offsets.end())
+            m_pinned_offsets.erase(it);
+    }
+
     void PrepareToScan_ ()
     {
-        assert(m_start_cursor < m_read_cursor);
-        // update the read and keep_string cursors.  if KeepString was called,
-        // this should do nothing, since in that case, m_start_cursor will be
-        // zero;  if Unaccept was called, it should have postcondition
-        // m_read_cursor == m_start_cursor + 1
-        m_read_cursor -= m_start_cursor;
-        m_kept_string_cursor -= m_start_cursor;
-        // dump the first m_start_cursor chars from the buffer
-        while (m_start_cursor > 0)
-        {
-            --m_start_cursor;
-            m_buffer.pop_front();
-        }
+        assert(m_start_cursor <= m_read_cursor);
+        // the next string starts at the start cursor.  if KeepString was
+        // called, this does nothing, since in that case, m_start_cursor will
+        // be m_token_start;  if Unaccept was called, it should have
+        // postcondition m_read_cursor == m_start_cursor.  the consumed atoms
+        // before the new m_token_start are left in the buffer, and are only
+        // discarded (in bulk) when FillBuffer next needs to make room.
+        m_token_start = m_start_cursor;
         // reset the accept cursor
-        m_accept_cursor = m_start_cursor;
+        m_accept_cursor = NULL;
         m_keep_string_has_been_called = false;
-        assert(m_kept_string_cursor > m_start_cursor);
-        assert(m_accept_cursor == 0);
+        assert(m_kept_string_cursor >= m_start_cursor);
+        // this is an offset, since FillBuffer may move the buffer.
+        m_kept_string_length = m_kept_string_cursor - m_token_start;
     }
     void ResetForNewInput_ ()
     {
-        m_current_conditional_flags = 0;
-        m_buffer.clear();
-        m_buffer.push_front('\0'); // special "previous" atom for beginning of input
-        assert(m_buffer.size() == 1);
-        m_start_cursor = 0;
-        m_read_cursor = 1;
-        m_kept_string_cursor = 1;
-        m_accept_cursor = 0;
+        if (m_buffer.size() < 2)
+            m_buffer.resize(2);
+        m_buffer[0] = '\0'; // special "previous" atom for beginning of input
+        m_buffer_end = &m_buffer[0] + 1;
+        m_discarded_atom_count = 0;
+        m_pinned_offsets.clear();
+        m_token_start = m_buffer_end;
+        m_start_cursor = m_buffer_end;
+        m_read_cursor = m_buffer_end;
+        m_kept_string_cursor = m_buffer_end;
+        m_kept_string_length = 0;
+        m_accept_cursor = NULL;
         m_keep_string_has_been_called = false;
         m_it = m_it_end;
+        m_streambuf = NULL;
+        m_read_callback = NULL;
     }
 
-    // for use in AutomatonApparatus_FastAndBig_Noninteractive_ only
-    std::uint8_t CurrentConditionalFlags_ ()
+    // for use in AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_ only
+    std::uint8_t CurrentConditionalFlags_ (std::uint8_t conditional_mask)
     {
-        UpdateConditionalFlags();
-        return m_current_conditional_flags;
+        return ConditionalFlags(conditional_mask);
     }
     std::uint8_t InputAtom_ ()
     {
         FillBuffer();
-        assert(m_read_cursor > 0);
-        assert(m_read_cursor < m_buffer.size());
-        return m_buffer[m_read_cursor];
+        assert(m_read_cursor >= m_token_start);
+        assert(m_read_cursor < m_buffer_end);
+        return *m_read_cursor;
     }
     void AdvanceReadCursor_ ()
     {
-        assert(m_start_cursor == 0);
-        assert(m_read_cursor > 0);
-        assert(m_read_cursor < m_buffer.size());
-        if (m_buffer[m_read_cursor] != '\0')
+        assert(m_start_cursor == m_token_start);
+        assert(m_read_cursor >= m_token_start);
+        assert(m_read_cursor < m_buffer_end);
+        if (*m_read_cursor != '\0')
             ++m_read_cursor;
     }
+    // advances the read cursor past the run of atoms in skip_set, as if by
+    // calling AdvanceReadCursor_ once for each of them.
+    void AdvanceReadCursorPast_ (AtomSkipSet_ const &skip_set)
+    {
+        assert(m_start_cursor == m_token_start);
+        assert(m_read_cursor >= m_token_start);
+        // '\0' is never in a skip set, so this stops at the end of input.
+        do
+        {
+            FillBuffer();
+            assert(m_read_cursor < m_buffer_end);
+            m_read_cursor = skip_set.Skip(m_read_cursor, m_buffer_end);
+        }
+        while (m_read_cursor == m_buffer_end);
+    }
     void SetAcceptCursor_ ()
     {
-        assert(m_start_cursor == 0);
-        assert(m_read_cursor > 0);
-        assert(m_read_cursor <= m_buffer.size());
+        assert(m_start_cursor == m_token_start);
+        assert(m_read_cursor >= m_token_start);
+        assert(m_read_cursor <= m_buffer_end);
         m_accept_cursor = m_read_cursor;
     }
-    void Accept_ (std::string &s)
+    void Accept_ ()
     {
-        assert(m_accept_cursor > 0 && "can't Accept_ if the accept cursor is not set");
+        assert(m_accept_cursor != NULL && "can't Accept_ if the accept cursor is not set");
         assert(m_accept_cursor <= m_read_cursor);
-        AcceptRejectCommon(s);
+        AcceptRejectCommon();
     }
-    void Reject_ (std::string &s)
+    void Reject_ ()
     {
-        assert(m_accept_cursor == 0 && "can't Reject_ if the accept cursor was set");
+        assert(m_accept_cursor == NULL && "can't Reject_ if the accept cursor was set");
         // must set the accept cursor to indicate the rejected string
         // (which is the kept string plus the rejected atom)
         m_accept_cursor = m_kept_string_cursor;
-        assert(m_accept_cursor < m_buffer.size());
-        if (m_buffer[m_accept_cursor] != '\0')
+        assert(m_accept_cursor < m_buffer_end);
+        if (*m_accept_cursor != '\0')
             ++m_accept_cursor;
-        AcceptRejectCommon(s);
+        AcceptRejectCommon();
+    }
+
+    // for use in the scanner subclass only -- these indicate the string most
+    // recently accepted/rejected by RunDfa_, and must be retrieved before
+    // the accept/reject handler code is executed.
+    std::uint8_t const *AcceptedStringBegin_ () const
+    {
+        assert(m_accept_cursor != NULL);
+        return m_token_start;
+    }
+    std::uint8_t const *AcceptedStringEnd_ () const
+    {
+        assert(m_accept_cursor != NULL);
+        return m_accept_cursor;
+    }
+    // the beginning of the part of the accepted string which was scanned by
+    // the most recent RunDfa_ (i.e. the accepted string without the kept
+    // string it started with, if any).
+    std::uint8_t const *ScannedStringBegin_ () const
+    {
+        assert(m_accept_cursor != NULL);
+        return m_token_start + m_kept_string_length;
+    }
+    // returns the offset (from the beginning of the input) of position,
+    // which must be between the previous atom and the read cursor.
+    std::size_t InputOffset_ (std::uint8_t const *position) const
+    {
+        assert(position > &m_buffer[0] && position <= m_buffer_end);
+        // m_buffer[0] was initially the '\0' preceding the input.
+        return m_discarded_atom_count + (position - &m_buffer[0]) - 1;
+    }
+    // returns true iff the next scan starts with a string kept by KeepString.
+    bool HasKeptString_ () const
+    {
+        return m_kept_string_cursor != m_start_cursor;
+    }
+    // undoes the Accept_ or Reject_ done by the most recent RunDfa_, so that
+    // the next scan starts over from the same place.  this may not be used if
+    // the scan started with a kept string (see HasKeptString_).
+    void Unscan_ ()
+    {
+        assert(m_accept_cursor != NULL && "can only Unscan_ after RunDfa_");
+        assert(!m_keep_string_has_been_called);
+        m_start_cursor = m_token_start;
+        m_read_cursor = m_token_start;
+        m_kept_string_cursor = m_token_start;
+        m_accept_cursor = NULL;
     }
 
 private:
 
+    // the cursors point into m_buffer, so a copy would refer to the
+    // original's buffer.
+    InputApparatus_Noninteractive_ (InputApparatus_Noninteractive_ const &);
+    void operator = (InputApparatus_Noninteractive_ const &);
+
+    // converts between cursors and the offsets used by InputCheckpoint.
+    std::size_t CursorOffset (std::uint8_t const *cursor) const
+    {
+        assert(cursor > &m_buffer[0] && cursor <= m_buffer_end);
+        return m_discarded_atom_count + (cursor - &m_buffer[0]);
+    }
+    std::uint8_t const *CursorAt (std::size_t offset) const
+    {
+        // the previous atom must still be in the buffer.
+        assert(offset > m_discarded_atom_count);
+        assert(offset - m_discarded_atom_count <= std::size_t(m_buffer_end - &m_buffer[0]));
+        return &m_buffer[0] + (offset - m_discarded_atom_count);
+    }
     void UnacceptUnrejectCommon (std::uint32_t char_count)
     {
         assert(!m_keep_string_has_been_called && "may only Unaccept/Unreject before KeepString");
-        assert(char_count <= m_start_cursor && "can't Unaccept/Unreject more characters than were rejected");
+        assert(char_count <= std::size_t(m_start_cursor - m_token_start) && "can't Unaccept/Unreject more characters than were rejected");
         if (char_count == 0)
             return; // nothing to do
         // update the cursors
         m_start_cursor -= char_count;
-        m_read_cursor = m_start_cursor + 1;
-        m_kept_string_cursor = m_start_cursor + 1;
+        m_read_cursor = m_start_cursor;
+        m_kept_string_cursor = m_start_cursor;
         m_accept_cursor -= char_count;
     }
-    void AcceptRejectCommon (std::string &s)
+    void AcceptRejectCommon ()
     {
-        assert(s.empty());
-        assert(m_buffer.size() >= 2);
-        assert(m_start_cursor == 0);
+        assert(m_start_cursor == m_token_start);
+        assert(m_buffer_end > m_token_start);
         // the accept cursor indicates the end of the string to accept/reject
-        assert(m_accept_cursor > 0 && m_accept_cursor <= m_buffer.size());
+        assert(m_accept_cursor != NULL && m_accept_cursor >= m_token_start && m_accept_cursor <= m_buffer_end);
         // there should not be an EOF-indicating '\0' at the end of the string
-        assert(m_accept_cursor == 1 || m_buffer[m_accept_cursor-1] != '\0');
-        // extract the accepted/rejected string: range [1,m_accept_cursor).
-        s.insert(s.begin(), m_buffer.begin()+1, m_buffer.begin()+m_accept_cursor);
-        assert(s.size() == m_accept_cursor-1);
-        // set the start cursor to one before the end of the string
-        // (the last char in the string becomes the previous atom)
-        m_start_cursor = m_accept_cursor - 1;
+        assert(m_accept_cursor == m_token_start || m_accept_cursor[-1] != '\0');
+        // the accepted/rejected string is the range [m_token_start,m_accept_cursor),
+        // and it stays in the buffer until the next call to PrepareToScan_.
+        // the next scan starts at the end of the string (the last atom in
+        // the string becomes the previous atom)
+        m_start_cursor = m_accept_cursor;
         // reset the other cursors
         m_read_cursor = m_accept_cursor;
         m_kept_string_cursor = m_accept_cursor;
@@ -185,31 +475,54 @@ private:
 
     bool IsConditionalMet (std::uint8_t conditional_mask, std::uint8_t conditional_flags)
     {
-        UpdateConditionalFlags();
         // return true iff no bits indicated by conditional_mask differ between
-        // conditional_flags and m_current_conditional_flags.
-        return ((conditional_flags ^ m_current_conditional_flags) & conditional_mask) == 0;
+        // conditional_flags and the current conditional flags.
+        return ((conditional_flags ^ ConditionalFlags(conditional_mask)) & conditional_mask) == 0;
     }
     void FillBuffer ()
     {
-        assert(m_read_cursor > 0);
-        assert(m_read_cursor <= m_buffer.size());
+        assert(m_read_cursor >= m_token_start);
+        assert(m_read_cursor <= m_buffer_end);
         // if we already have at least one atom ahead of the read cursor in
         // the input buffer, there is no need to suck another one out.
-        if (m_read_cursor < m_buffer.size())
+        if (m_read_cursor < m_buffer_end)
             return;
         // if the last atom (in front of the read cursor) in the input buffer
         // is '\0' then we have reached EOF, so there is no need to suck
         // another atom out.
-        if (m_buffer.size() >= 2 && *m_buffer.rbegin() == '\0')
+        if (m_buffer_end > m_token_start && m_buffer_end[-1] == '\0')
         {
-            assert(m_read_cursor < m_buffer.size());
+            assert(m_read_cursor < m_buffer_end);
             return;
         }
 
+        // if a std::streambuf or read callback is the input source, read
+        // whole blocks of the readahead size directly into the buffer.  if
+        // our readahead is unbounded, keep reading (in geometrically
+        // growing blocks) until end of input.
+        if (m_streambuf != NULL || m_read_callback != NULL)
+        {
+            do
+            {
+                std::size_t block_capacity = ReserveBlockSpace();
+                std::size_t read_count = ReadBlock(m_buffer_end, block_capacity);
+                assert(read_count <= block_capacity);
+                // if we're at end of input, push a null char.
+                if (read_count == 0)
+                {
+                    *m_buffer_end++ = '\0';
+                    break;
+                }
+                m_buffer_end += read_count;
+            }
+            while (m_input_readahead == 0);
+        }
         // if we're at end of input, push a null char.
-        if (m_it == m_it_end)
-            m_buffer.push_back('\0');
+        else if (m_it == m_it_end)
+        {
+            ReserveBufferSpace(1);
+            *m_buffer_end++ = '\0';
+        }
         // otherwise read stuff
         else
         {
@@ -217,32 +530,135 @@ private:
             // stick a null char at the end to signal end of input.
             if (m_input_readahead == 0)
             {
-                copy(m_it, m_it_end, std::back_inserter(m_buffer));
-                m_buffer.push_back('\0');
+                for ( ; m_it != m_it_end; ++m_it)
+                {
+                    ReserveBufferSpace(1);
+                    *m_buffer_end++ = *m_it;
+                }
+                ReserveBufferSpace(1);
+                *m_buffer_end++ = '\0';
             }
             // otherwise, read the readahead number of bytes.
             else
+            {
+                ReserveBufferSpace(m_input_readahead);
                 for (std::size_t i = 0; i < m_input_readahead && m_it != m_it_end; ++i, ++m_it)
-                    m_buffer.push_back(*m_it);
+                    *m_buffer_end++ = *m_it;
+            }
         }
 
         // ensure there is at least one atom on each side of the read cursor.
-        assert(m_buffer.size() >= 2);
-        assert(m_read_cursor < m_buffer.size());
+        assert(m_buffer_end > m_token_start);
+        assert(m_read_cursor < m_buffer_end);
     }
-    void UpdateConditionalFlags ()
+    // makes room after m_buffer_end for the next block read, returning its
+    // capacity -- m_input_readahead atoms, or if that is 0, the room left in
+    // the buffer, which is only made (by ReserveBufferSpace) once the buffer
+    // is full.  reserving the size of the buffer for each read would instead
+    // double the buffer on every read returning less than that.
+    std::size_t ReserveBlockSpace ()
     {
-        FillBuffer();
-        assert(m_read_cursor > 0);
-        assert(m_read_cursor < m_buffer.size());
-        // given the atoms surrounding the read cursor, calculate the
-        // current conditional flags.
-        m_current_conditional_flags = 0;
-        if (m_buffer[m_read_cursor-1] == '\0')                                            m_current_conditional_flags |= CF_BEGINNING_OF_INPUT;
-        if (m_buffer[m_read_cursor] == '\0')                                              m_current_conditional_flags |= CF_END_OF_INPUT;
-        if (m_buffer[m_read_cursor-1] == '\0' || m_buffer[m_read_cursor-1] == '\n')       m_current_conditional_flags |= CF_BEGINNING_OF_LINE;
-        if (m_buffer[m_read_cursor] == '\0' || m_buffer[m_read_cursor] == '\n')           m_current_conditional_flags |= CF_END_OF_LINE;
-        if (IsWordChar(m_buffer[m_read_cursor-1]) != IsWordChar(m_buffer[m_read_cursor])) m_current_conditional_flags |= CF_WORD_BOUNDARY;
+        if (m_input_readahead != 0)
+        {
+            ReserveBufferSpace(m_input_readahead);
+            return m_input_readahead;
+        }
+        if (m_buffer_end == &m_buffer[0] + m_buffer.size())
+            ReserveBufferSpace((m_buffer.size() + 1) / 2);
+        return &m_buffer[0] + m_buffer.size() - m_buffer_end;
+    }
+    // reads at most block_capacity atoms into block from the attached
+    // std::streambuf or read callback, returning the number of atoms read.
+    // a return value of 0 indicates end of input.
+    std::size_t ReadBlock (std::uint8_t *block, std::size_t block_capacity)
+    {
+        if (m_streambuf != NULL)
+        {
+            std::streamsize read_count = m_streambuf->sgetn(reinterpret_cast<char *>(block), block_capacity);
+            return read_count > 0 ? std::size_t(read_count) : 0;
+        }
+        else
+        {
+            assert(m_read_callback != NULL);
+            return m_read_callback(m_read_callback_context, reinterpret_cast<char *>(block), block_capacity);
+        }
+    }
+    // ensures there is room for at least atom_count atoms after m_buffer_end.
+    // the live part of the buffer -- from the previous atom (just before
+    // m_token_start) through m_buffer_end -- is moved to the front of the
+    // buffer with a single memmove, and the buffer is only grown (at least
+    // geometrically) if that doesn't free up enough room.
+    void ReserveBufferSpace (std::size_t atom_count)
+    {
+        std::uint8_t *buffer_begin = &m_buffer[0];
+        if (std::size_t(buffer_begin + m_buffer.size() - m_buffer_end) >= atom_count)
+            return;
+
+        std::uint8_t const *live_begin = m_token_start - 1;
+        // the input from the previous atom of each checkpoint on is pinned.
+        for (std::vector<std::size_t>::const_iterator it = m_pinned_offsets.begin(); it != m_pinned_offsets.end(); ++it)
+        {
+            std::uint8_t const *pinned_begin = CursorAt(*it) - 1;
+            if (pinned_begin < live_begin)
+                live_begin = pinned_begin;
+        }
+        std::size_t live_size = m_buffer_end - live_begin;
+        std::size_t token_start_offset = m_token_start - live_begin;
+        std::size_t start_cursor_offset = m_start_cursor - live_begin;
+        std::size_t read_cursor_offset = m_read_cursor - live_begin;
+        std::size_t kept_string_cursor_offset = m_kept_string_cursor - live_begin;
+        std::size_t accept_cursor_offset = m_accept_cursor != NULL ? m_accept_cursor - live_begin : 0;
+        // everything before the live part is discarded.
+        m_discarded_atom_count += live_begin - buffer_begin;
+
+        if (m_buffer.size() - live_size >= atom_count)
+        {
+            std::memmove(buffer_begin, live_begin, live_size);
+        }
+        else
+        {
+            std::size_t new_buffer_size = 2*m_buffer.size();
+            if (new_buffer_size < live_size + atom_count)
+                new_buffer_size = live_size + atom_count;
+            Buffer new_buffer(new_buffer_size);
+            std::memcpy(&new_buffer[0], live_begin, live_size);
+            m_buffer.swap(new_buffer);
+            buffer_begin = &m_buffer[0];
+        }
+
+        m_buffer_end = buffer_begin + live_size;
+        m_token_start = buffer_begin + token_start_offset;
+        m_start_cursor = buffer_begin + start_cursor_offset;
+        m_read_cursor = buffer_begin + read_cursor_offset;
+        m_kept_string_cursor = buffer_begin + kept_string_cursor_offset;
+        if (m_accept_cursor != NULL)
+            m_accept_cursor = buffer_begin + accept_cursor_offset;
+    }
+    // given the atoms surrounding the read cursor, calculates the conditional
+    // flags indicated by conditional_mask; the others are returned as 0.
+    std::uint8_t ConditionalFlags (std::uint8_t conditional_mask)
+    {
+        assert(m_read_cursor > &m_buffer[0]);
+        // the previous atom is always in the buffer, so the next atom is only
+        // read (which may block) if the mask has a flag that depends on it.
+        // otherwise, any atom which is neither '\0', '\n' nor a word char will
+        // do, since the flags it affects are masked off.
+        std::uint8_t previous_atom = m_read_cursor[-1];
+        std::uint8_t next_atom = ' ';
+        if ((conditional_mask & (CF_END_OF_INPUT|CF_END_OF_LINE|CF_WORD_BOUNDARY)) != 0)
+        {
+            FillBuffer();
+            assert(m_read_cursor >= m_token_start);
+            assert(m_read_cursor < m_buffer_end);
+            next_atom = m_read_cursor[0];
+        }
+        std::uint8_t conditional_flags = 0;
+        if (previous_atom == '\0')                                        conditional_flags |= CF_BEGINNING_OF_INPUT;
+        if (next_atom == '\0')                                            conditional_flags |= CF_END_OF_INPUT;
+        if (previous_atom == '\0' || previous_atom == '\n')               conditional_flags |= CF_BEGINNING_OF_LINE;
+        if (next_atom == '\0' || next_atom == '\n')                       conditional_flags |= CF_END_OF_LINE;
+        if (IsWordChar(previous_atom) != IsWordChar(next_atom))           conditional_flags |= CF_WORD_BOUNDARY;
+        return conditional_flags & conditional_mask;
     }
     static bool IsWordChar (std::uint8_t c)
     {
@@ -271,36 +687,61 @@ private:
         return s_is_word_char_table[c] != 0;
     }
 
-    typedef std::deque<std::uint8_t> Buffer;
+    typedef std::vector<std::uint8_t> Buffer;
 
-    std::uint8_t m_current_conditional_flags;
+    // contiguous storage for the input.  the atom just before m_token_start
+    // is always present (it is the "previous" atom used in calculating the
+    // conditional flags), and everything before it may be discarded.
     Buffer m_buffer;
-    // indicates the "previous" atom (of the kept string)
-    Buffer::size_type m_start_cursor;
+    // indicates the end of the atoms read into m_buffer so far
+    std::uint8_t *m_buffer_end;
+    // the number of atoms (including the initial '\0') which have been
+    // discarded from the front of m_buffer, for calculating input offsets.
+    std::size_t m_discarded_atom_count;
+    // the token start offsets of the unreleased checkpoints (see
+    // TakeInputCheckpoint_), whose input may not be discarded.
+    std::vector<std::size_t> m_pinned_offsets;
+    // indicates the first atom of the string currently being scanned
+    std::uint8_t const *m_token_start;
+    // indicates where the next scan will start (the first atom of the kept string)
+    std::uint8_t const *m_start_cursor;
     // indicates how far the scanner has read
-    Buffer::size_type m_read_cursor;
+    std::uint8_t const *m_read_cursor;
     // indicates the end of the kept string
-    Buffer::size_type m_kept_string_cursor;
-    // if != m_start_cursor, indicates the most recent, longest accepted string
-    Buffer::size_type m_accept_cursor;
+    std::uint8_t const *m_kept_string_cursor;
+    // if not NULL, indicates the end of the most recent, longest accepted string
+    std::uint8_t const *m_accept_cursor;
+    // the length of the kept string the current scan started with
+    std::size_t m_kept_string_length;
     // indicates if KeepString has been called during the accept/reject handler
     bool m_keep_string_has_been_called;
     // an istream_iterator to read through the input source
     std::istream_iterator<char> m_it;
     // keep a handy end-of-stream input iterator
     std::istream_iterator<char> m_it_end;
+    // if not NULL, the streambuf to read blocks of input from
+    std::streambuf *m_streambuf;
+    // if not NULL, the callback to read blocks of input with
+    ReadCallback m_read_callback;
+    // passed as the context parameter to m_read_callback
+    void *m_read_callback_context;
     // the max number of bytes that will be put into the buffer each time the
     // input is pulled for bytes.  a value of 0 indicates that the input will
     // be read until EOF is hit.
     std::size_t m_input_readahead;
 }; // end of class ReflexCpp_::InputApparatus_Noninteractive_
 
+#endif // !defined(ReflexCpp_InputApparatus_Noninteractive_defined_)
+
+#if !defined(ReflexCpp_AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_defined_)
+#define ReflexCpp_AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_defined_
+
 // /////////////////////////////////////////////////////////////////////////////
 // implements the AutomatonApparatus interface as described in the documentation
 // -- it contains all the generalized state machinery for running a reflex DFA.
 // /////////////////////////////////////////////////////////////////////////////
 
-class AutomatonApparatus_FastAndBig_Noninteractive_ : protected InputApparatus_Noninteractive_
+class AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_ : protected InputApparatus_Noninteractive_
 {
 protected:
 
@@ -311,38 +752,60 @@ protected:
         MF_UNGREEDY_         = (1 << 1)
     };
 
+    // the narrowest integer types which can hold each kind of index used
+    // in the DFA tables, including the sentinel values -- the state count
+    // (indicating no state), the transition table size and the accept
+    // handler count (indicating no accept handler).
+    typedef std::uint8_t DfaStateIndex_;
+    typedef std::uint16_t DfaTransitionIndex_;
+    typedef std::uint8_t AcceptHandlerIndex_;
+
+    // the fields are ordered so as to minimize padding.
     struct DfaState_
     {
-        std::uint32_t m_accept_handler_index;
-        std::uint32_t m_transition_count;
-        std::uint32_t m_transition_offset;
-        std::uint8_t m_transition_type;
-        std::uint8_t m_transition_first_index;
-    }; // end of struct ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaState_
+        DfaTransitionIndex_ m_transition_offset;
+        AcceptHandlerIndex_ m_accept_handler_index;
+        // this is at most 256 (one transition per atom class or input atom).
+        std::uint16_t m_transition_count;
+        // the mask of the conditional flags tested by this state's transitions
+        // (which are then CONDITIONAL), or 0 if its transitions are INPUT_ATOM.
+        std::uint8_t m_conditional_mask;
+        // index into the skip set table, or 0 if this state has no skip set.
+        std::uint8_t m_skip_set_index;
+    }; // end of struct ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaState_
     struct DfaTransition_
     {
         enum Type
         {
             INPUT_ATOM = 0, INPUT_ATOM_RANGE, CONDITIONAL
-        }; // end of enum ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::Type
+        }; // end of enum ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaTransition_::Type
 
-        std::uint32_t m_target_dfa_state_offset;
-    }; // end of struct ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_
+        DfaStateIndex_ m_target_dfa_state_offset;
+    }; // end of struct ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaTransition_
 
-    AutomatonApparatus_FastAndBig_Noninteractive_ (
+    static_assert(std::is_trivial<DfaState_>::value && std::is_standard_layout<DfaState_>::value, "DfaState_ must be constant-initializable");
+    static_assert(std::is_trivial<DfaTransition_>::value && std::is_standard_layout<DfaTransition_>::value, "DfaTransition_ must be constant-initializable");
+
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_ (
         DfaState_ const *state_table,
         std::size_t state_count,
         DfaTransition_ const *transition_table,
         std::size_t transition_count,
-        std::uint32_t accept_handler_count)
+        std::uint8_t const *atom_class_table,
+        AtomSkipSet_ const *skip_set_table,
+        std::size_t skip_set_count,
+        std::uint32_t accept_handler_count,
+        std::size_t input_readahead)
         :
-        InputApparatus_Noninteractive_(),
+        InputApparatus_Noninteractive_(input_readahead),
         m_accept_handler_count(accept_handler_count),
         m_state_table(state_table),
         m_state_count(state_count),
-        m_transition_table(transition_table)
+        m_transition_table(transition_table),
+        m_atom_class_table(atom_class_table),
+        m_skip_set_table(skip_set_table)
     {
-        CheckDfa(state_table, state_count, transition_table, transition_count);
+        CheckDfa(state_table, state_count, transition_table, transition_count, atom_class_table, skip_set_table, skip_set_count);
         // subclasses must call ReflexCpp_::InputApparatus_Noninteractive_::ResetForNewInput_ in their constructors.
     }
 
@@ -368,9 +831,8 @@ protected:
         m_accept_state = NULL;
         m_mode_flags = mode_flags;
     }
-    std::uint32_t RunDfa_ (std::string &s)
+    std::uint32_t RunDfa_ ()
     {
-        assert(s.empty());
         // reset the current state to the initial state.
         assert(m_initial_state != NULL);
         m_current_state = m_initial_state;
@@ -378,6 +840,11 @@ protected:
         // loop until there are no valid transitions from the current state.
         while (m_current_state != NULL)
         {
+            // if the current state transitions to itself on a set of atoms,
+            // advance past any run of them at once, since doing so doesn't
+            // change the current state.
+            if (m_current_state->m_skip_set_index != 0)
+                AdvanceReadCursorPast_(m_skip_set_table[m_current_state->m_skip_set_index]);
             // if the current state is an accept state, save it
             if (IsAcceptState(m_current_state))
             {
@@ -393,7 +860,7 @@ protected:
                 }
             }
             // turn the crank on the state machine, exercising the appropriate
-            // conditional (using m_current_conditional_flags) or atomic
+            // conditional (using the conditional flags at the read cursor) or atomic
             // transition (using the atom at the read cursor in the buffer).
             // m_current_state will be set to the transitioned-to state, or
             // NULL if no transition was possible.
@@ -403,8 +870,8 @@ protected:
         // using the accept handler indicated by the most recent accept state.
         if (m_accept_state != NULL)
         {
-            // extract the accepted string from the buffer
-            Accept_(s);
+            // delimit the accepted string in the buffer
+            Accept_();
             // save off the accept handler index
             std::uint32_t accept_handler_index = m_accept_state->m_accept_handler_index;
             // clear the accept state for next time
@@ -412,12 +879,12 @@ protected:
             // return accept_handler_index to indicate which handler to call
             return accept_handler_index;
         }
-        // otherwise the input atom went unhandled; extract the rejected string.
+        // otherwise the input atom went unhandled; delimit the rejected string.
         else
         {
-            // put the rejected string in the return string and indicate
-            // that no accept handler should be called.
-            Reject_(s);
+            // delimit the rejected string in the buffer and indicate that no
+            // accept handler should be called.
+            Reject_();
             return m_accept_handler_count;
         }
     }
@@ -428,6 +895,7 @@ private:
     using InputApparatus_Noninteractive_::CurrentConditionalFlags_;
     using InputApparatus_Noninteractive_::InputAtom_;
     using InputApparatus_Noninteractive_::AdvanceReadCursor_;
+    using InputApparatus_Noninteractive_::AdvanceReadCursorPast_;
     using InputApparatus_Noninteractive_::SetAcceptCursor_;
     using InputApparatus_Noninteractive_::Accept_;
     using InputApparatus_Noninteractive_::Reject_;
@@ -436,35 +904,19 @@ private:
     {
         assert(m_current_state != NULL);
         std::uint32_t target_dfa_state_offset = m_state_count;
-        if (m_current_state->m_transition_type == DfaTransition_::CONDITIONAL)
+        if (m_current_state->m_conditional_mask != 0)
         {
-            target_dfa_state_offset = m_transition_table[m_current_state->m_transition_offset + CurrentConditionalFlags_()].m_target_dfa_state_offset;
+            // the flags outside the state's mask are 0, which is fine because
+            // they don't affect the transition.
+            target_dfa_state_offset = m_transition_table[m_current_state->m_transition_offset + CurrentConditionalFlags_(m_current_state->m_conditional_mask)].m_target_dfa_state_offset;
             // don't advance the read cursor, because no input was actualy eaten
         }
-        else // m_current_state->m_transition_type == DfaTransition_::INPUT_ATOM
+        // an INPUT_ATOM state has either no transitions or one transition
+        // per atom class (the state machine's case-insensitivity is already
+        // incorporated into the table), so no range check is needed.
+        else if (m_current_state->m_transition_count > 0)
         {
-            std::uint8_t input_atom = InputAtom_();
-
-            // only do the lookup if the input atom is in range of the table
-            if (input_atom >= m_current_state->m_transition_first_index &&
-                input_atom < m_current_state->m_transition_first_index + m_current_state->m_transition_count)
-            {
-                target_dfa_state_offset = m_transition_table[m_current_state->m_transition_offset + input_atom - m_current_state->m_transition_first_index].m_target_dfa_state_offset;
-            }
-
-            // if we're case-insensitive and the above check didn't match, try
-            // the switched case input atom
-            if ((m_mode_flags & MF_CASE_INSENSITIVE_) != 0 && target_dfa_state_offset == m_state_count)
-            {
-                input_atom = SwitchCase(input_atom);
-                // only do the lookup if the input atom is in range of the table
-                if (input_atom >= m_current_state->m_transition_first_index &&
-                    input_atom < m_current_state->m_transition_first_index + m_current_state->m_transition_count)
-                {
-                    target_dfa_state_offset = m_transition_table[m_current_state->m_transition_offset + input_atom - m_current_state->m_transition_first_index].m_target_dfa_state_offset;
-                }
-            }
-
+            target_dfa_state_offset = m_transition_table[m_current_state->m_transition_offset + m_atom_class_table[InputAtom_()]].m_target_dfa_state_offset;
             // only advance the read cursor if the transition was valid
             if (target_dfa_state_offset < m_state_count)
                 AdvanceReadCursor_();
@@ -476,33 +928,55 @@ private:
         assert(state != NULL);
         return state->m_accept_handler_index < m_accept_handler_count;
     }
-    static std::uint8_t SwitchCase (std::uint8_t c)
-    {
-        if (c >= 'a' && c <= 'z')
-            return c - 'a' + 'A';
-        if (c >= 'A' && c <= 'Z')
-            return c - 'A' + 'a';
-        return c;
-    }
     static void CheckDfa (
         DfaState_ const *state_table,
         std::size_t state_count,
         DfaTransition_ const *transition_table,
-        std::size_t transition_count)
+        std::size_t transition_count,
+        std::uint8_t const *atom_class_table,
+        AtomSkipSet_ const *skip_set_table,
+        std::size_t skip_set_count)
     {
         // if any assertions in this method fail, the state and/or
         // transition tables were created incorrectly.
         assert(state_table != NULL && "must have a state table");
         assert(state_count > 0 && "must have at least one state");
         assert(transition_table != NULL && "must have a transition table");
+        assert(skip_set_table != NULL && "must have a skip set table");
+        for (DfaState_ const *s = state_table, *s_end = state_table + state_count;
+             s != s_end;
+             ++s)
+        {
+            assert(s->m_skip_set_index < skip_set_count &&
+                   "skip set index out of range (does not point to a valid skip set)");
+        }
+        for (std::size_t i = 1; i < skip_set_count; ++i)
+        {
+            assert(!skip_set_table[i].Contains('\0') &&
+                   "'\\0' may not be in a skip set, since it marks the end of input");
+            assert(skip_set_table[i].m_range_count <= 4 &&
+                   "a skip set may not have more than 4 ranges");
+        }
+        assert(atom_class_table != NULL && "must have an atom class table");
+        std::size_t atom_class_count = 0;
+        for (std::size_t i = 0; i < 256; ++i)
+            if (atom_class_table[i] >= atom_class_count)
+                atom_class_count = atom_class_table[i] + 1;
         {
             DfaTransition_ const *t = transition_table;
             for (DfaState_ const *s = state_table, *s_end = state_table + state_count;
                  s != s_end;
                  ++s)
             {
-                assert(s->m_transition_type == DfaTransition_::INPUT_ATOM ||
-                       s->m_transition_type == DfaTransition_::CONDITIONAL);
+                assert(s->m_conditional_mask < 32 &&
+                       "a conditional mask may only contain the 5 conditional flags");
+                assert((s->m_conditional_mask != 0 ||
+                        s->m_transition_count == 0 ||
+                        s->m_transition_count == atom_class_count) &&
+                       "an INPUT_ATOM state must have one transition per atom class");
+                assert((s->m_conditional_mask == 0 ||
+                        s->m_transition_count == 32) &&
+                       "a CONDITIONAL state must have one transition per combination of conditional flags");
                 assert(transition_table + s->m_transition_offset == t &&
                        "states' transitions must be contiguous and in ascending order");
                 t += s->m_transition_count;
@@ -525,17 +999,20 @@ private:
     DfaState_ const *const m_state_table;
     std::size_t const m_state_count;
     DfaTransition_ const *const m_transition_table;
+    std::uint8_t const *const m_atom_class_table;
+    AtomSkipSet_ const *const m_skip_set_table;
     DfaState_ const *m_initial_state;
     DfaState_ const *m_current_state;
     DfaState_ const *m_accept_state;
     std::uint8_t m_mode_flags;
-}; // end of class ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_
+}; // end of class ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_
+
+#endif // !defined(ReflexCpp_AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_defined_)
 
 } // end of namespace ReflexCpp_
-#endif // !defined(ReflexCpp_namespace_)
 
 
-#line 19 "Scanner.reflex"
+#line 11 "Scanner.reflex"
 
 #pragma once
 
@@ -568,9 +1045,9 @@ enum TokenId : std::uint32_t
 
 std::string AsString (TokenId token_id);
 
-#line 572 "Scanner.hpp"
+#line 1049 "Scanner.hpp"
 
-class Scanner : private ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_
+class Scanner : private ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_
 {
 public:
 
@@ -588,37 +1065,78 @@ public:
         }; // end of enum Scanner::StateMachine::Name
     }; // end of struct Scanner::StateMachine
 
+    // a scan position and state machine recorded by Checkpoint (its contents
+    // are internal)
+    struct ScannerCheckpoint
+    {
+        InputApparatus_Noninteractive_::InputCheckpoint m_input;
+        StateMachine::Name m_state_machine;
+    }; // end of struct Scanner::ScannerCheckpoint
+
     Scanner ();
     ~Scanner ();
 
-    bool DebugSpew () const { return m_debug_spew_; }
-    void DebugSpew (bool debug_spew) { m_debug_spew_ = debug_spew; }
-
+    /// Returns true if and only if "debug spew" is enabled (which prints, to the
+    /// debug spew stream, what actions the scanner is taking).  This method, along
+    /// with all other debug spew code can be removed by removing the
+    /// %target.cpp.generate_debug_spew_code directive from the primary source.
+    bool DebugSpewIsEnabled () const { return m_debug_spew_stream_ != NULL; }
+    /// Returns the debug spew stream (see DebugSpewIsEnabled()).  This method,
+    /// along with all other debug spew code can be removed by removing the
+    /// %target.cpp.generate_debug_spew_code directive from the primary source.
+    std::ostream *DebugSpewStream () { return m_debug_spew_stream_; }
+    /// Sets the debug spew stream (see DebugSpewIsEnabled()).  If NULL is passed
+    /// in, then debug spew printing will be disabled.  The default value is NULL.
+    /// This method, along with all other debug spew code can be removed by removing
+    /// the %target.cpp.generate_debug_spew_code directive from the primary source.
+    void SetDebugSpewStream (std::ostream *debug_spew_stream) { m_debug_spew_stream_ = debug_spew_stream; }
+
+    /// Returns the currently active state machine.
     StateMachine::Name CurrentStateMachine () const;
+    /// Switches the current state machine to the specified one.
     void SwitchToStateMachine (StateMachine::Name state_machine);
 
-    using AutomatonApparatus_FastAndBig_Noninteractive_::IsAtEndOfInput;
-    using AutomatonApparatus_FastAndBig_Noninteractive_::IstreamIterator;
-    using AutomatonApparatus_FastAndBig_Noninteractive_::InputReadahead;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::IsAtEndOfInput;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::ReadCallback;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::IstreamIterator;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::InputStreambuf;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::InputReadCallback;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::InputReadahead;
+
+    /// Records the current scan position (including what the conditional
+    /// flags such as ^ and \b depend on) and the current state machine, so
+    /// that Restore can later return to them -- e.g. to scan ahead
+    /// speculatively and then rewind -- without copying the input.  The input
+    /// from the checkpoint on stays in the buffer until ReleaseCheckpoint is
+    /// called, so checkpoints should be released promptly.  May only be
+    /// called between scans (not from handler code).
+    ScannerCheckpoint Checkpoint ();
+    /// Returns to the scan position and state machine recorded by checkpoint,
+    /// which must not have been released.  Checkpoints are invalidated by
+    /// ResetForNewInput.  May only be called between scans.
+    void Restore (ScannerCheckpoint const &checkpoint);
+    /// Allows the input buffered for checkpoint to be discarded.  Each
+    /// checkpoint must be released exactly once, in any order.
+    void ReleaseCheckpoint (ScannerCheckpoint const &checkpoint);
 
     void ResetForNewInput ();
 
     TokenId Scan (
-#line 54 "Scanner.reflex"
+#line 46 "Scanner.reflex"
  std::shared_ptr<Ast::Base> &token 
-#line 610 "Scanner.hpp"
+#line 1128 "Scanner.hpp"
 ) throw();
 
 public:
 
 
-#line 55 "Scanner.reflex"
+#line 47 "Scanner.reflex"
 
     void AttachIstream (std::istream &in);
 
     std::vector<StateMachine::Name> m_state_machine_stack;
 
-#line 622 "Scanner.hpp"
+#line 1140 "Scanner.hpp"
 
 
 private:
@@ -632,26 +1150,37 @@ private:
 
     using InputApparatus_Noninteractive_::PrepareToScan_;
     using InputApparatus_Noninteractive_::ResetForNewInput_;
+    using InputApparatus_Noninteractive_::AcceptedStringBegin_;
+    using InputApparatus_Noninteractive_::AcceptedStringEnd_;
 
-    using AutomatonApparatus_FastAndBig_Noninteractive_::InitialState_;
-    using AutomatonApparatus_FastAndBig_Noninteractive_::ResetForNewInput_;
-    using AutomatonApparatus_FastAndBig_Noninteractive_::RunDfa_;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::InitialState_;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::ResetForNewInput_;
+    using AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::RunDfa_;
 
     // debug spew methods
-    static void PrintAtom_ (std::uint8_t atom);
-    static void PrintString_ (std::string const &s);
-
-    bool m_debug_spew_;
-
-    // state machine and automaton data
+    static void PrintAtom_ (std::ostream &out, std::uint8_t atom);
+    static void PrintString_ (std::ostream &out, std::string const &s);
+    static void PrintString_ (std::ostream &out, char const *s, std::size_t length);
+
+    std::ostream *m_debug_spew_stream_;
+
+    // state machine and automaton data.  these are the only static members
+    // of the scanner and of the ReflexCpp_ apparatus classes, and they are
+    // const and constant-initialized (they live in read-only data and are
+    // never written), so any number of scanner instances may run concurrently
+    // in different threads, as long as each instance is used by one thread
+    // at a time.
     static std::uint32_t const ms_state_machine_start_state_index_[];
     static std::uint8_t const ms_state_machine_mode_flags_[];
     static char const *const ms_state_machine_name_[];
     static std::uint32_t const ms_state_machine_count_;
-    static AutomatonApparatus_FastAndBig_Noninteractive_::DfaState_ const ms_state_table_[];
+    static AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaState_ const ms_state_table_[];
     static std::size_t const ms_state_count_;
-    static AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const ms_transition_table_[];
+    static AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaTransition_ const ms_transition_table_[];
     static std::size_t const ms_transition_count_;
+    static std::uint8_t const ms_atom_class_table_[256];
+    static ReflexCpp_::AtomSkipSet_ const ms_skip_set_table_[];
+    static std::size_t const ms_skip_set_count_;
     static char const *const ms_accept_handler_regex_[];
     static std::uint32_t const ms_accept_handler_count_;
 
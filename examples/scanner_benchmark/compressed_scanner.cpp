@@ -0,0 +1,719 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// compressed_scanner.cpp generated by reflex
+// from compressed_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "compressed_scanner.hpp"
+
+
+CompressedScanner::CompressedScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T8_A8_(
+        ms_state_table_,
+        ms_state_count_,
+        ms_transition_table_,
+        ms_transition_count_,
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_)
+{
+
+    ResetForNewInput();
+}
+
+CompressedScanner::~CompressedScanner ()
+{
+}
+
+CompressedScanner::StateMachine::Name CompressedScanner::CurrentStateMachine () const
+{
+    assert(InitialState_() != NULL);
+    std::size_t initial_node_index = InitialState_() - ms_state_table_;
+    assert(initial_node_index < ms_state_count_);
+    switch (initial_node_index)
+    {
+        default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
+        case 0: return StateMachine::MAIN;
+    }
+}
+
+void CompressedScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(ms_state_table_ + ms_state_machine_start_state_index_[state_machine]);
+    ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+CompressedScanner::ScannerCheckpoint CompressedScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void CompressedScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void CompressedScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void CompressedScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T8_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type CompressedScanner::Scan () throw()
+{
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 37 "compressed_scanner.reflex"
+
+    return Token::BAD_TOKEN;
+
+#line 123 "compressed_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 1:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 2:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 4:
+                {
+                    return Token::FLOAT;
+                }
+                break;
+
+                case 5:
+                {
+                    return Token::STRING;
+                }
+                break;
+
+                case 6:
+                {
+                    return Token::COMMENT;
+                }
+                break;
+
+                case 7:
+                {
+                    return Token::COMMENT;
+                }
+                break;
+
+                case 8:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 9:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 10:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 28 "compressed_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 218 "compressed_scanner.cpp"
+}
+
+std::size_t CompressedScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::uint32_t CompressedScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 8)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 31];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const CompressedScanner::ms_state_machine_start_state_index_[] =
+{
+    0,
+};
+std::uint8_t const CompressedScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+};
+std::uint32_t const CompressedScanner::ms_state_machine_count_ = 1;
+
+// the order of the states indicates priority (only for accept states).
+// the lower the state's index in this array, the higher its priority.
+ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T8_A8_::DfaState_ const CompressedScanner::ms_state_table_[] =
+{
+    { 127, 29, 11, 2, 0 },
+    { 45, 29, 11, 0, 0 },
+    { 92, 29, 9, 0, 1 },
+    { 10, 29, 8, 0, 0 },
+    { 0, 29, 8, 0, 0 },
+    { 23, 29, 11, 0, 2 },
+    { 0, 29, 5, 0, 0 },
+    { 97, 5, 11, 0, 0 },
+    { 73, 29, 8, 0, 0 },
+    { 87, 29, 8, 0, 0 },
+    { 106, 29, 8, 0, 0 },
+    { 59, 29, 8, 0, 0 },
+    { 0, 29, 11, 0, 3 },
+    { 109, 12, 11, 0, 4 },
+    { 0, 29, 7, 0, 0 },
+    { 68, 11, 6, 0, 5 },
+    { 90, 29, 2, 0, 0 },
+    { 101, 29, 4, 0, 6 },
+    { 96, 29, 11, 0, 0 },
+    { 104, 29, 11, 0, 0 },
+    { 0, 19, 4, 0, 6 },
+    { 101, 16, 2, 0, 6 },
+    { 94, 29, 11, 0, 0 },
+    { 0, 22, 3, 0, 7 },
+    { 109, 3, 8, 0, 0 },
+    { 108, 3, 8, 0, 0 },
+    { 79, 29, 1, 0, 8 },
+    { 103, 29, 8, 0, 0 },
+    { 0, 1, 10, 0, 0 }
+};
+std::size_t const CompressedScanner::ms_state_count_ = sizeof(CompressedScanner::ms_state_table_) / sizeof(*CompressedScanner::ms_state_table_);
+
+// the comb vector of all the states' lookup tables.  each element is
+// { target state, owner state }; an owner of 29 indicates an unused element.
+ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T8_A8_::DfaTransition_ const CompressedScanner::ms_transition_table_[] =
+{
+    { 29, 29 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 13, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 12, 12 },
+    { 5, 5 },
+    { 5, 5 },
+    { 4, 3 },
+    { 5, 5 },
+    { 6, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 5, 5 },
+    { 7, 5 },
+    { 5, 5 },
+    { 2, 1 },
+    { 2, 1 },
+    { 3, 1 },
+    { 5, 1 },
+    { 4, 1 },
+    { 8, 1 },
+    { 4, 1 },
+    { 9, 1 },
+    { 10, 1 },
+    { 4, 1 },
+    { 11, 1 },
+    { 16, 1 },
+    { 21, 1 },
+    { 24, 1 },
+    { 3, 1 },
+    { 25, 1 },
+    { 26, 1 },
+    { 26, 1 },
+    { 26, 1 },
+    { 26, 1 },
+    { 12, 11 },
+    { 27, 1 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 11 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 4, 8 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 15, 15 },
+    { 26, 26 },
+    { 26, 26 },
+    { 2, 2 },
+    { 2, 2 },
+    { 4, 9 },
+    { 26, 26 },
+    { 26, 26 },
+    { 26, 26 },
+    { 26, 26 },
+    { 17, 16 },
+    { 5, 7 },
+    { 21, 16 },
+    { 21, 16 },
+    { 19, 18 },
+    { 19, 18 },
+    { 23, 22 },
+    { 23, 22 },
+    { 20, 18 },
+    { 20, 18 },
+    { 22, 16 },
+    { 23, 22 },
+    { 23, 22 },
+    { 17, 17 },
+    { 17, 17 },
+    { 4, 10 },
+    { 20, 19 },
+    { 20, 19 },
+    { 5, 7 },
+    { 18, 17 },
+    { 14, 13 },
+    { 29, 21 },
+    { 4, 10 },
+    { 3, 24 },
+    { 3, 25 },
+    { 4, 27 },
+    { 1, 0 },
+    { 1, 0 },
+    { 28, 0 },
+    { 28, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 28, 0 },
+    { 28, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 28, 0 },
+    { 28, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 28, 0 },
+    { 28, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 28, 0 },
+    { 28, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 28, 0 },
+    { 28, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 28, 0 },
+    { 28, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 28, 0 },
+    { 28, 0 }
+};
+std::size_t const CompressedScanner::ms_transition_count_ = sizeof(CompressedScanner::ms_transition_table_) / sizeof(*CompressedScanner::ms_transition_table_);
+
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 24 atom classes.
+std::uint8_t const CompressedScanner::ms_atom_class_table_[256] =
+{
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 4, 5, 1, 1, 6, 7, 1, 6, 6, 8, 9, 6, 10, 11, 12,
+    13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6, 6, 15, 16, 17, 6,
+    1, 18, 18, 18, 18, 19, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 21, 20, 20, 6, 22, 6, 6, 20,
+    1, 18, 18, 18, 18, 19, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 21, 20, 20, 6, 23, 6, 6, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const CompressedScanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 251, 255, 255, 255, 255, 255, 255, 239, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        4, false,
+        { 1, 11, 35, 93 },
+        { 9, 33, 91, 255 }
+    },
+    {
+        {
+            254, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 43, 0, 0 },
+        { 41, 255, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 42, 0, 0, 0 },
+        { 42, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 11, 0, 0 },
+        { 9, 255, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 126, 0, 0, 0, 126, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        3, false,
+        { 48, 65, 97, 0 },
+        { 57, 70, 102, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    }
+};
+std::size_t const CompressedScanner::ms_skip_set_count_ = sizeof(CompressedScanner::ms_skip_set_table_) / sizeof(*CompressedScanner::ms_skip_set_table_);
+
+std::uint32_t const CompressedScanner::ms_accept_handler_count_ = 11;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const CompressedScanner::ms_accept_handler_is_token_only_[] =
+{
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true
+};
+CompressedScanner::TokenId const CompressedScanner::ms_accept_handler_token_id_[] =
+{
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::INTEGER,
+    Token::FLOAT,
+    Token::STRING,
+    Token::COMMENT,
+    Token::COMMENT,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const CompressedScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    0,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const CompressedScanner::ms_keyword_slot_table_[] =
+{
+    { "break", 5, 0, 0 },
+    { "default", 7, 0, 0 },
+    { "", 0, 0, 11 },
+    { "int", 3, 0, 0 },
+    { "", 0, 0, 11 },
+    { "static", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "const", 5, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "void", 4, 0, 0 },
+    { "return", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "continue", 8, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "switch", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "case", 4, 0, 0 },
+    { "do", 2, 0, 0 },
+    { "if", 2, 0, 0 },
+    { "", 0, 0, 11 },
+    { "struct", 6, 0, 0 },
+    { "char", 4, 0, 0 },
+    { "else", 4, 0, 0 },
+    { "while", 5, 0, 0 },
+    { "for", 3, 0, 0 },
+    { "", 0, 0, 11 }
+};
+std::uint16_t const CompressedScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    2,
+    1,
+    0,
+    0,
+    1,
+    2,
+    2
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,1085 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// direct_scanner.cpp generated by reflex
+// from direct_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "direct_scanner.hpp"
+
+
+DirectScanner::DirectScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_DirectCoded_InMemory_()
+{
+
+    ResetForNewInput();
+}
+
+DirectScanner::~DirectScanner ()
+{
+}
+
+DirectScanner::StateMachine::Name DirectScanner::CurrentStateMachine () const
+{
+    std::size_t initial_node_index = InitialState_();
+    switch (initial_node_index)
+    {
+        default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
+        case 0: return StateMachine::MAIN;
+    }
+}
+
+void DirectScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(ms_state_machine_start_state_index_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+DirectScanner::ScannerCheckpoint DirectScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void DirectScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void DirectScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void DirectScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_DirectCoded_InMemory_::ResetForNewInput_(ms_state_machine_start_state_index_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type DirectScanner::Scan () throw()
+{
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 37 "direct_scanner.reflex"
+
+    return Token::BAD_TOKEN;
+
+#line 112 "direct_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 1:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 2:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 4:
+                {
+                    return Token::FLOAT;
+                }
+                break;
+
+                case 5:
+                {
+                    return Token::STRING;
+                }
+                break;
+
+                case 6:
+                {
+                    return Token::COMMENT;
+                }
+                break;
+
+                case 7:
+                {
+                    return Token::COMMENT;
+                }
+                break;
+
+                case 8:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 9:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 10:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 28 "direct_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 207 "direct_scanner.cpp"
+}
+
+std::size_t DirectScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::uint32_t DirectScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 8)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 31];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const DirectScanner::ms_state_machine_start_state_index_[] =
+{
+    0,
+};
+std::uint8_t const DirectScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+};
+std::uint32_t const DirectScanner::ms_state_machine_count_ = 1;
+
+// this is the direct-coded DFA.  each DFA state is a block of code labeled
+// with the state's index, which switches on the input atom (or on the
+// conditional flags) and jumps directly to the target state's block.  if
+// there is no valid transition, the most recent accept state's accept
+// handler index is returned (or ms_accept_handler_count_ if there was none).
+std::uint32_t DirectScanner::RunDfa_ ()
+{
+    std::uint32_t accept_handler_index_ = ms_accept_handler_count_;
+
+    switch (InitialState_())
+    {
+        case 0: goto dfa_state_0;
+        default: assert(false && "invalid initial state -- this should never happen"); goto dfa_halt;
+    }
+
+dfa_state_0:
+    switch (CurrentConditionalFlags_(2))
+    {
+        case 0: case 1:
+        case 4: case 5:
+        case 8: case 9:
+        case 12: case 13:
+        case 16: case 17:
+        case 20: case 21:
+        case 24: case 25:
+        case 28: case 29:
+            goto dfa_state_1;
+        case 2: case 3:
+        case 6: case 7:
+        case 10: case 11:
+        case 14: case 15:
+        case 18: case 19:
+        case 22: case 23:
+        case 26: case 27:
+        case 30: case 31:
+            goto dfa_state_28;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_1:
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_2;
+        case 33:
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_3;
+        case 34:
+            AdvanceReadCursor_();
+            goto dfa_state_5;
+        case 37:
+        case 40: case 41: case 42:
+        case 44:
+        case 46:
+        case 58: case 59:
+        case 63:
+        case 91:
+        case 93: case 94:
+        case 123:
+        case 125: case 126:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        case 38:
+            AdvanceReadCursor_();
+            goto dfa_state_8;
+        case 43:
+            AdvanceReadCursor_();
+            goto dfa_state_9;
+        case 45:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_11;
+        case 48:
+            AdvanceReadCursor_();
+            goto dfa_state_16;
+        case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_21;
+        case 60:
+            AdvanceReadCursor_();
+            goto dfa_state_24;
+        case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_25;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_26;
+        case 124:
+            AdvanceReadCursor_();
+            goto dfa_state_27;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_2:
+    AdvanceReadCursorPast_(ms_skip_set_table_[1]);
+    accept_handler_index_ = 9;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_2;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_3:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_4:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_5:
+    AdvanceReadCursorPast_(ms_skip_set_table_[2]);
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9:
+        case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+        case 27: case 28: case 29: case 30: case 31: case 32: case 33:
+        case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+        case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+        case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82:
+        case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 91:
+        case 93: case 94: case 95: case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108:
+        case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: case 123: case 124:
+        case 125: case 126: case 127: case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138: case 139: case 140:
+        case 141: case 142: case 143: case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154: case 155: case 156:
+        case 157: case 158: case 159: case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170: case 171: case 172:
+        case 173: case 174: case 175: case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186: case 187: case 188:
+        case 189: case 190: case 191: case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202: case 203: case 204:
+        case 205: case 206: case 207: case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218: case 219: case 220:
+        case 221: case 222: case 223: case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234: case 235: case 236:
+        case 237: case 238: case 239: case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250: case 251: case 252:
+        case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_5;
+        case 34:
+            AdvanceReadCursor_();
+            goto dfa_state_6;
+        case 92:
+            AdvanceReadCursor_();
+            goto dfa_state_7;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_6:
+    accept_handler_index_ = 5;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_7:
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9:
+        case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+        case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+        case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+        case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+        case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106:
+        case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+        case 123: case 124: case 125: case 126: case 127: case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138:
+        case 139: case 140: case 141: case 142: case 143: case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154:
+        case 155: case 156: case 157: case 158: case 159: case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170:
+        case 171: case 172: case 173: case 174: case 175: case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186:
+        case 187: case 188: case 189: case 190: case 191: case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202:
+        case 203: case 204: case 205: case 206: case 207: case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218:
+        case 219: case 220: case 221: case 222: case 223: case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234:
+        case 235: case 236: case 237: case 238: case 239: case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250:
+        case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_5;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_8:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 38:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_9:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 43:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_10:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 45:
+        case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_11:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 42:
+            AdvanceReadCursor_();
+            goto dfa_state_12;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_15;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_12:
+    AdvanceReadCursorPast_(ms_skip_set_table_[3]);
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+        case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+        case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41:
+        case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+        case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+        case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106:
+        case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+        case 123: case 124: case 125: case 126: case 127: case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138:
+        case 139: case 140: case 141: case 142: case 143: case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154:
+        case 155: case 156: case 157: case 158: case 159: case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170:
+        case 171: case 172: case 173: case 174: case 175: case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186:
+        case 187: case 188: case 189: case 190: case 191: case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202:
+        case 203: case 204: case 205: case 206: case 207: case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218:
+        case 219: case 220: case 221: case 222: case 223: case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234:
+        case 235: case 236: case 237: case 238: case 239: case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250:
+        case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_12;
+        case 42:
+            AdvanceReadCursor_();
+            goto dfa_state_13;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_13:
+    AdvanceReadCursorPast_(ms_skip_set_table_[4]);
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+        case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+        case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41:
+        case 43: case 44: case 45: case 46:
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+        case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+        case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+        case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111:
+        case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: case 123: case 124: case 125: case 126: case 127:
+        case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138: case 139: case 140: case 141: case 142: case 143:
+        case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154: case 155: case 156: case 157: case 158: case 159:
+        case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170: case 171: case 172: case 173: case 174: case 175:
+        case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186: case 187: case 188: case 189: case 190: case 191:
+        case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202: case 203: case 204: case 205: case 206: case 207:
+        case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218: case 219: case 220: case 221: case 222: case 223:
+        case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234: case 235: case 236: case 237: case 238: case 239:
+        case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250: case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_12;
+        case 42:
+            AdvanceReadCursor_();
+            goto dfa_state_13;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_14;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_14:
+    accept_handler_index_ = 7;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_15:
+    AdvanceReadCursorPast_(ms_skip_set_table_[5]);
+    accept_handler_index_ = 6;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9:
+        case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+        case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+        case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+        case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+        case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106:
+        case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+        case 123: case 124: case 125: case 126: case 127: case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138:
+        case 139: case 140: case 141: case 142: case 143: case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154:
+        case 155: case 156: case 157: case 158: case 159: case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170:
+        case 171: case 172: case 173: case 174: case 175: case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186:
+        case 187: case 188: case 189: case 190: case 191: case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202:
+        case 203: case 204: case 205: case 206: case 207: case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218:
+        case 219: case 220: case 221: case 222: case 223: case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234:
+        case 235: case 236: case 237: case 238: case 239: case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250:
+        case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_15;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_16:
+    accept_handler_index_ = 2;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 46:
+            AdvanceReadCursor_();
+            goto dfa_state_17;
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_21;
+        case 88:
+        case 120:
+            AdvanceReadCursor_();
+            goto dfa_state_22;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_17:
+    AdvanceReadCursorPast_(ms_skip_set_table_[6]);
+    accept_handler_index_ = 4;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_17;
+        case 69:
+        case 101:
+            AdvanceReadCursor_();
+            goto dfa_state_18;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_18:
+    switch (InputAtom_())
+    {
+        case 43:
+        case 45:
+            AdvanceReadCursor_();
+            goto dfa_state_19;
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_20;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_19:
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_20;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_20:
+    AdvanceReadCursorPast_(ms_skip_set_table_[6]);
+    accept_handler_index_ = 4;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_20;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_21:
+    AdvanceReadCursorPast_(ms_skip_set_table_[6]);
+    accept_handler_index_ = 2;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 46:
+            AdvanceReadCursor_();
+            goto dfa_state_17;
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_21;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_22:
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70:
+        case 97: case 98: case 99: case 100: case 101: case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_23;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_23:
+    AdvanceReadCursorPast_(ms_skip_set_table_[7]);
+    accept_handler_index_ = 3;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70:
+        case 97: case 98: case 99: case 100: case 101: case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_23;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_24:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 60:
+            AdvanceReadCursor_();
+            goto dfa_state_3;
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_25:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_3;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_26:
+    AdvanceReadCursorPast_(ms_skip_set_table_[8]);
+    accept_handler_index_ = 1;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_26;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_27:
+    accept_handler_index_ = 8;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 124:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_28:
+    accept_handler_index_ = 10;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_2;
+        case 33:
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_3;
+        case 34:
+            AdvanceReadCursor_();
+            goto dfa_state_5;
+        case 37:
+        case 40: case 41: case 42:
+        case 44:
+        case 46:
+        case 58: case 59:
+        case 63:
+        case 91:
+        case 93: case 94:
+        case 123:
+        case 125: case 126:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        case 38:
+            AdvanceReadCursor_();
+            goto dfa_state_8;
+        case 43:
+            AdvanceReadCursor_();
+            goto dfa_state_9;
+        case 45:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_11;
+        case 48:
+            AdvanceReadCursor_();
+            goto dfa_state_16;
+        case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_21;
+        case 60:
+            AdvanceReadCursor_();
+            goto dfa_state_24;
+        case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_25;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_26;
+        case 124:
+            AdvanceReadCursor_();
+            goto dfa_state_27;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_halt:
+    if (accept_handler_index_ < ms_accept_handler_count_)
+        Accept_();
+    else
+        Reject_();
+    return accept_handler_index_;
+}
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const DirectScanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 251, 255, 255, 255, 255, 255, 255, 239, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        4, false,
+        { 1, 11, 35, 93 },
+        { 9, 33, 91, 255 }
+    },
+    {
+        {
+            254, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 43, 0, 0 },
+        { 41, 255, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 42, 0, 0, 0 },
+        { 42, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 11, 0, 0 },
+        { 9, 255, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 126, 0, 0, 0, 126, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        3, false,
+        { 48, 65, 97, 0 },
+        { 57, 70, 102, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    }
+};
+
+std::uint32_t const DirectScanner::ms_accept_handler_count_ = 11;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const DirectScanner::ms_accept_handler_is_token_only_[] =
+{
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true
+};
+DirectScanner::TokenId const DirectScanner::ms_accept_handler_token_id_[] =
+{
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::INTEGER,
+    Token::FLOAT,
+    Token::STRING,
+    Token::COMMENT,
+    Token::COMMENT,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const DirectScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    0,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const DirectScanner::ms_keyword_slot_table_[] =
+{
+    { "break", 5, 0, 0 },
+    { "default", 7, 0, 0 },
+    { "", 0, 0, 11 },
+    { "int", 3, 0, 0 },
+    { "", 0, 0, 11 },
+    { "static", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "const", 5, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "void", 4, 0, 0 },
+    { "return", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "continue", 8, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "switch", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "case", 4, 0, 0 },
+    { "do", 2, 0, 0 },
+    { "if", 2, 0, 0 },
+    { "", 0, 0, 11 },
+    { "struct", 6, 0, 0 },
+    { "char", 4, 0, 0 },
+    { "else", 4, 0, 0 },
+    { "while", 5, 0, 0 },
+    { "for", 3, 0, 0 },
+    { "", 0, 0, 11 }
+};
+std::uint16_t const DirectScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    2,
+    1,
+    0,
+    0,
+    1,
+    2,
+    2
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,629 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// lazy_scanner.cpp generated by reflex
+// from lazy_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "lazy_scanner.hpp"
+
+
+LazyScanner::LazyScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_(
+        ms_nfa_state_table_,
+        ms_nfa_state_count_,
+        ms_nfa_transition_table_,
+        ms_nfa_transition_count_,
+        ms_state_machine_start_state_index_,
+        ms_state_machine_count_,
+        4096,
+        ms_accept_handler_count_)
+{
+
+    ResetForNewInput();
+}
+
+LazyScanner::~LazyScanner ()
+{
+}
+
+LazyScanner::StateMachine::Name LazyScanner::CurrentStateMachine () const
+{
+    assert(InitialState_() < ms_state_machine_count_);
+    return StateMachine::Name(InitialState_());
+}
+
+void LazyScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(state_machine);
+    ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+LazyScanner::ScannerCheckpoint LazyScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void LazyScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void LazyScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void LazyScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::ResetForNewInput_(StateMachine::START_, ms_state_machine_mode_flags_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type LazyScanner::Scan () throw()
+{
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 37 "lazy_scanner.reflex"
+
+    return Token::BAD_TOKEN;
+
+#line 117 "lazy_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 1:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 2:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 4:
+                {
+                    return Token::FLOAT;
+                }
+                break;
+
+                case 5:
+                {
+                    return Token::STRING;
+                }
+                break;
+
+                case 6:
+                {
+                    return Token::COMMENT;
+                }
+                break;
+
+                case 7:
+                {
+                    return Token::COMMENT;
+                }
+                break;
+
+                case 8:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 9:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 10:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 28 "lazy_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 212 "lazy_scanner.cpp"
+}
+
+std::size_t LazyScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::uint32_t LazyScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 8)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 31];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const LazyScanner::ms_state_machine_start_state_index_[] =
+{
+    11,
+};
+std::uint8_t const LazyScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+};
+std::uint32_t const LazyScanner::ms_state_machine_count_ = 1;
+
+// the NFA which the DFA states are made from.  the first
+// ms_accept_handler_count_ states are the accept states, and the order of
+// those indicates priority (the lower the index, the higher the priority).
+ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaState_ const LazyScanner::ms_nfa_state_table_[] =
+{
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 10 },
+    { 10, 1 },
+    { 11, 3 },
+    { 14, 1 },
+    { 15, 5 },
+    { 20, 1 },
+    { 21, 1 },
+    { 22, 2 },
+    { 24, 1 },
+    { 25, 1 },
+    { 26, 2 },
+    { 28, 3 },
+    { 31, 4 },
+    { 35, 1 },
+    { 36, 1 },
+    { 37, 1 },
+    { 38, 2 },
+    { 40, 1 },
+    { 41, 3 },
+    { 44, 2 },
+    { 46, 2 },
+    { 48, 4 },
+    { 52, 1 },
+    { 53, 2 },
+    { 55, 1 },
+    { 56, 1 },
+    { 57, 1 },
+    { 58, 1 },
+    { 59, 2 },
+    { 61, 5 },
+    { 66, 2 },
+    { 68, 1 },
+    { 69, 1 },
+    { 70, 1 },
+    { 71, 1 },
+    { 72, 3 },
+    { 75, 1 },
+    { 76, 1 },
+    { 77, 1 },
+    { 78, 1 },
+    { 79, 1 },
+    { 80, 2 },
+    { 82, 3 },
+    { 85, 3 },
+    { 88, 2 },
+    { 90, 1 },
+    { 91, 2 },
+    { 93, 1 },
+    { 94, 20 },
+    { 114, 1 },
+    { 115, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 119, 1 },
+    { 120, 1 },
+    { 121, 1 },
+    { 122, 1 },
+    { 123, 1 },
+    { 124, 1 },
+    { 125, 1 },
+    { 126, 1 },
+    { 127, 1 },
+    { 128, 1 },
+    { 129, 1 },
+    { 130, 2 },
+    { 132, 3 },
+    { 135, 1 },
+    { 136, 1 }
+};
+std::size_t const LazyScanner::ms_nfa_state_count_ = sizeof(LazyScanner::ms_nfa_state_table_) / sizeof(*LazyScanner::ms_nfa_state_table_);
+
+ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_ const LazyScanner::ms_nfa_transition_table_[] =
+{
+    { 12, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 16, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 19, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 24, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 35, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 42, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 47, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 58, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 75, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 78, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 13, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 14, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 14, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 14, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 15, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 15, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 15, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 15, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 15, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 1, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 17, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 18, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 18, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 2, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 20, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 21, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 48, 48 },
+    { 22, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 88, 88 },
+    { 22, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 120, 120 },
+    { 23, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 23, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 70 },
+    { 23, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 102 },
+    { 23, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 23, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 70 },
+    { 23, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 102 },
+    { 3, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 25, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 27, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 46, 46 },
+    { 27, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 26, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 30, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 4, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 29, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 31, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 30, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 29, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 32, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 69, 69 },
+    { 32, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 101, 101 },
+    { 33, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 43, 43 },
+    { 33, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 45, 45 },
+    { 32, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 33, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 34, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 34, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 4, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 36, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 37, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 34, 34 },
+    { 39, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 5, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 34, 34 },
+    { 38, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 40, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 41, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 92, 92 },
+    { 39, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 9 },
+    { 39, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 11, 33 },
+    { 39, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 35, 91 },
+    { 39, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 93, 255 },
+    { 39, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 9 },
+    { 39, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 11, 255 },
+    { 43, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 44, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 47, 47 },
+    { 45, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 47, 47 },
+    { 46, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 46, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 9 },
+    { 46, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 11, 255 },
+    { 6, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 48, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 49, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 47, 47 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 52, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 57, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 51, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 53, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 55, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 52, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 52, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 43, 255 },
+    { 52, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 52, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 43, 46 },
+    { 52, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 255 },
+    { 55, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 54, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 7, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 47, 47 },
+    { 57, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 56, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 59, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 72, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 33, 33 },
+    { 73, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 38, 38 },
+    { 65, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 43, 43 },
+    { 64, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 45, 45 },
+    { 66, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 45, 45 },
+    { 60, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 60, 60 },
+    { 67, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 60, 60 },
+    { 69, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 60, 60 },
+    { 71, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 62, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 62, 62 },
+    { 68, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 62, 62 },
+    { 70, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 62, 62 },
+    { 74, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 124, 124 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 33, 33 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 37, 38 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 40, 47 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 58, 63 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 91, 91 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 93, 94 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 123, 126 },
+    { 61, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 60, 60 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 63, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 62, 62 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 62, 62 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 43, 43 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 45, 45 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 60, 60 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 62, 62 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 38, 38 },
+    { 8, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 124, 124 },
+    { 76, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 77, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 77, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 77, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 77, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 9, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 79, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 2, 2 }
+};
+std::size_t const LazyScanner::ms_nfa_transition_count_ = sizeof(LazyScanner::ms_nfa_transition_table_) / sizeof(*LazyScanner::ms_nfa_transition_table_);
+
+std::uint32_t const LazyScanner::ms_accept_handler_count_ = 11;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const LazyScanner::ms_accept_handler_is_token_only_[] =
+{
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true
+};
+LazyScanner::TokenId const LazyScanner::ms_accept_handler_token_id_[] =
+{
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::INTEGER,
+    Token::FLOAT,
+    Token::STRING,
+    Token::COMMENT,
+    Token::COMMENT,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const LazyScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    0,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const LazyScanner::ms_keyword_slot_table_[] =
+{
+    { "break", 5, 0, 0 },
+    { "default", 7, 0, 0 },
+    { "", 0, 0, 11 },
+    { "int", 3, 0, 0 },
+    { "", 0, 0, 11 },
+    { "static", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "const", 5, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "void", 4, 0, 0 },
+    { "return", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "continue", 8, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "switch", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "case", 4, 0, 0 },
+    { "do", 2, 0, 0 },
+    { "if", 2, 0, 0 },
+    { "", 0, 0, 11 },
+    { "struct", 6, 0, 0 },
+    { "char", 4, 0, 0 },
+    { "else", 4, 0, 0 },
+    { "while", 5, 0, 0 },
+    { "for", 3, 0, 0 },
+    { "", 0, 0, 11 }
+};
+std::uint16_t const LazyScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    2,
+    1,
+    0,
+    0,
+    1,
+    2,
+    2
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
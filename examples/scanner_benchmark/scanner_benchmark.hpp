@@ -0,0 +1,22 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+#pragma once
+
+// Token types shared by TableScanner and DirectScanner, so that their outputs
+// can be compared directly.
+struct Token
+{
+    enum Type
+    {
+        END_OF_INPUT = 0,
+        BAD_TOKEN,
+        KEYWORD,
+        IDENTIFIER,
+        INTEGER,
+        FLOAT,
+        STRING,
+        COMMENT,
+        OPERATOR,
+        WHITESPACE
+    }; // end of enum Token::Type
+}; // end of struct Token
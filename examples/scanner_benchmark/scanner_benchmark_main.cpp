@@ -0,0 +1,268 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "compressed_scanner.hpp"
+#include "direct_scanner.hpp"
+#include "lazy_scanner.hpp"
+#include "table_scanner.hpp"
+
+// Deterministically generates roughly size bytes of C-like source text.
+std::string generate_input (std::size_t size) {
+    static char const *const FRAGMENTS[] = {
+        "int ", "return ", "while (", "if (", "else ", "for (", "struct ", "static ",
+        "counter", "value_", "x", "some_longer_identifier", "_tmp0", "ptr",
+        "0", "42", "1234567", "0x7fFF", "3.14159", "2.5e-3",
+        "\"a string\"", "\"escaped \\\" quote\"",
+        "// line comment\n", "/* block\n   comment */",
+        " = ", " + ", " - ", " * ", " / ", " == ", " != ", " <<= ", " -> ", " && ", " || ",
+        "(", ")", "[", "]", "{", "}", ";", ",", ".",
+        " ", "  ", "\n", "\n    ", "\t",
+    };
+    static std::size_t const FRAGMENT_COUNT = sizeof(FRAGMENTS) / sizeof(FRAGMENTS[0]);
+
+    std::string retval;
+    retval.reserve(size + 64);
+    std::uint32_t state = 0x12345678;
+    while (retval.size() < size) {
+        // xorshift32; quality is irrelevant, only determinism matters.
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        retval += FRAGMENTS[state % FRAGMENT_COUNT];
+        // Separate tokens so that adjacent fragments usually don't merge.
+        retval += ' ';
+    }
+    return retval;
+}
+
+struct ScanResult
+{
+    std::uint64_t m_token_count;
+    std::uint64_t m_checksum;
+    double m_seconds;
+};
+
+template <typename Scanner_>
+ScanResult time_scanner (std::string const &input, int passes) {
+    Scanner_ scanner;
+    ScanResult result = { 0, 0, 0.0 };
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        scanner.InputSpan(input.data(), input.data() + input.size());
+        Token::Type token;
+        while ((token = scanner.Scan()) != Token::END_OF_INPUT) {
+            ++result.m_token_count;
+            result.m_checksum = result.m_checksum * 31 + token;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    result.m_seconds = std::chrono::duration<double>(end - start).count();
+    return result;
+}
+
+// Scans using ScanBatch, only calling Scan when a batch stops short (which for
+// these scanners only happens at the end of input).
+template <typename Scanner_>
+ScanResult time_scanner_batch (std::string const &input, int passes) {
+    static std::size_t const TOKEN_CAPACITY = 256;
+    Token::Type token_ids[TOKEN_CAPACITY];
+    std::size_t token_offsets[TOKEN_CAPACITY];
+    std::size_t token_lengths[TOKEN_CAPACITY];
+    Scanner_ scanner;
+    ScanResult result = { 0, 0, 0.0 };
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        scanner.InputSpan(input.data(), input.data() + input.size());
+        while (true) {
+            std::size_t token_count = scanner.ScanBatch(token_ids, token_offsets, token_lengths, TOKEN_CAPACITY);
+            for (std::size_t i = 0; i < token_count; ++i)
+                result.m_checksum = result.m_checksum * 31 + token_ids[i];
+            result.m_token_count += token_count;
+            if (token_count < TOKEN_CAPACITY) {
+                Token::Type token = scanner.Scan();
+                if (token == Token::END_OF_INPUT)
+                    break;
+                ++result.m_token_count;
+                result.m_checksum = result.m_checksum * 31 + token;
+            }
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    result.m_seconds = std::chrono::duration<double>(end - start).count();
+    return result;
+}
+
+// Scans using ScanParallel, which splits the input into up to thread_count
+// chunks scanned concurrently, only calling Scan when it stops short (which for
+// these scanners only happens at the end of input).
+template <typename Scanner_>
+ScanResult time_scanner_parallel (std::string const &input, int passes, unsigned int thread_count) {
+    std::vector<Token::Type> token_ids;
+    std::vector<std::size_t> token_offsets;
+    std::vector<std::size_t> token_lengths;
+    Scanner_ scanner;
+    ScanResult result = { 0, 0, 0.0 };
+    auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        scanner.InputSpan(input.data(), input.data() + input.size());
+        while (true) {
+            token_ids.clear();
+            token_offsets.clear();
+            token_lengths.clear();
+            std::size_t token_count = scanner.ScanParallel(token_ids, token_offsets, token_lengths, thread_count);
+            for (std::size_t i = 0; i < token_count; ++i)
+                result.m_checksum = result.m_checksum * 31 + token_ids[i];
+            result.m_token_count += token_count;
+            Token::Type token = scanner.Scan();
+            if (token == Token::END_OF_INPUT)
+                break;
+            ++result.m_token_count;
+            result.m_checksum = result.m_checksum * 31 + token;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    result.m_seconds = std::chrono::duration<double>(end - start).count();
+    return result;
+}
+
+// Runs thread_count scanner instances concurrently, each over its own copy of
+// the input, to measure how throughput scales with cores.  The scanners share
+// only their (read-only) DFA tables.  The returned result covers all threads;
+// its token count and checksum are those of the first thread, so that it can
+// be compared against single-threaded results.
+template <typename Scanner_>
+ScanResult time_scanner_threads (std::string const &input, int passes, unsigned int thread_count) {
+    std::vector<std::string> inputs(thread_count, input);
+    std::vector<ScanResult> results(thread_count);
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < thread_count; ++i)
+        threads.emplace_back([&inputs, &results, passes, i] () { results[i] = time_scanner<Scanner_>(inputs[i], passes); });
+    for (std::thread &thread : threads)
+        thread.join();
+    auto end = std::chrono::steady_clock::now();
+
+    ScanResult result = results[0];
+    result.m_seconds = std::chrono::duration<double>(end - start).count();
+    for (ScanResult const &thread_result : results) {
+        if (thread_result.m_token_count != result.m_token_count || thread_result.m_checksum != result.m_checksum) {
+            // Poison the result so that it fails to match.
+            result.m_token_count = 0;
+            break;
+        }
+    }
+    return result;
+}
+
+void print_result (char const *name, ScanResult const &result, std::size_t total_bytes) {
+    std::cout << name << ": "
+              << result.m_token_count << " tokens, "
+              << result.m_seconds << " s, "
+              << total_bytes / result.m_seconds / (1024.0 * 1024.0) << " MB/s\n";
+}
+
+bool results_match (ScanResult const &a, ScanResult const &b) {
+    return a.m_token_count == b.m_token_count && a.m_checksum == b.m_checksum;
+}
+
+int main (int argc, char **argv) {
+    std::string input;
+    if (argc >= 2) {
+        std::ifstream in(argv[1], std::ios::binary);
+        if (!in.is_open()) {
+            std::cerr << "error: could not open file \"" << argv[1] << "\"\n";
+            return 1;
+        }
+        input.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    } else {
+        input = generate_input(16*1024*1024);
+    }
+    int passes = argc >= 3 ? std::atoi(argv[2]) : 5;
+    if (passes <= 0)
+        passes = 1;
+
+    std::size_t total_bytes = input.size() * passes;
+    std::cout << "scanning " << input.size() << " bytes, " << passes << " passes\n";
+
+    // Warm up the scanners (and the input's cache lines) before timing.
+    time_scanner<TableScanner>(input, 1);
+    time_scanner<CompressedScanner>(input, 1);
+    time_scanner<DirectScanner>(input, 1);
+    time_scanner<LazyScanner>(input, 1);
+
+    ScanResult table_result = time_scanner<TableScanner>(input, passes);
+    ScanResult compressed_result = time_scanner<CompressedScanner>(input, passes);
+    ScanResult direct_result = time_scanner<DirectScanner>(input, passes);
+    ScanResult lazy_result = time_scanner<LazyScanner>(input, passes);
+    ScanResult table_batch_result = time_scanner_batch<TableScanner>(input, passes);
+    ScanResult direct_batch_result = time_scanner_batch<DirectScanner>(input, passes);
+
+    print_result("table-driven DFA", table_result, total_bytes);
+    print_result("compressed table-driven DFA", compressed_result, total_bytes);
+    print_result("direct-coded DFA", direct_result, total_bytes);
+    print_result("lazily made DFA", lazy_result, total_bytes);
+    print_result("table-driven DFA, batched", table_batch_result, total_bytes);
+    print_result("direct-coded DFA, batched", direct_batch_result, total_bytes);
+    std::cout << "compressed speedup: " << table_result.m_seconds / compressed_result.m_seconds << "x\n";
+    std::cout << "direct-coded speedup: " << table_result.m_seconds / direct_result.m_seconds << "x\n";
+    std::cout << "lazily made speedup: " << table_result.m_seconds / lazy_result.m_seconds << "x\n";
+    std::cout << "table-driven batched speedup: " << table_result.m_seconds / table_batch_result.m_seconds << "x\n";
+    std::cout << "direct-coded batched speedup: " << direct_result.m_seconds / direct_batch_result.m_seconds << "x\n";
+
+    if (!results_match(table_result, compressed_result) || !results_match(table_result, direct_result) ||
+        !results_match(table_result, lazy_result) ||
+        !results_match(table_result, table_batch_result) || !results_match(table_result, direct_batch_result)) {
+        std::cerr << "error: scanners produced different token streams\n";
+        return 1;
+    }
+
+    // Scaling curve of concurrent, independent scanner instances: thread
+    // counts 1, 2, 4, ... up to (and including) the hardware concurrency.
+    unsigned int max_thread_count = std::thread::hardware_concurrency();
+    if (max_thread_count == 0)
+        max_thread_count = 1;
+    std::vector<unsigned int> thread_counts;
+    for (unsigned int thread_count = 1; thread_count < max_thread_count; thread_count *= 2)
+        thread_counts.push_back(thread_count);
+    thread_counts.push_back(max_thread_count);
+
+    double single_thread_rate = 0.0;
+    for (unsigned int thread_count : thread_counts) {
+        ScanResult thread_result = time_scanner_threads<TableScanner>(input, passes, thread_count);
+        if (!results_match(table_result, thread_result)) {
+            std::cerr << "error: concurrent scanners produced different token streams\n";
+            return 1;
+        }
+        double rate = total_bytes * thread_count / thread_result.m_seconds / (1024.0 * 1024.0);
+        if (thread_count == 1)
+            single_thread_rate = rate;
+        std::cout << "table-driven DFA, " << thread_count << " thread(s): "
+                  << thread_result.m_seconds << " s, "
+                  << rate << " MB/s aggregate, "
+                  << rate / single_thread_rate << "x scaling\n";
+    }
+
+    // Scaling curve of a single input split among threads by ScanParallel.
+    for (unsigned int thread_count : thread_counts) {
+        ScanResult parallel_result = time_scanner_parallel<TableScanner>(input, passes, thread_count);
+        if (!results_match(table_result, parallel_result)) {
+            std::cerr << "error: parallel scan produced a different token stream\n";
+            return 1;
+        }
+        std::cout << "table-driven DFA, parallel, " << thread_count << " thread(s): "
+                  << parallel_result.m_seconds << " s, "
+                  << total_bytes / parallel_result.m_seconds / (1024.0 * 1024.0) << " MB/s, "
+                  << table_result.m_seconds / parallel_result.m_seconds << "x speedup\n";
+    }
+    return 0;
+}
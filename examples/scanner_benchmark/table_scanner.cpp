@@ -0,0 +1,1357 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// table_scanner.cpp generated by reflex
+// from table_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "table_scanner.hpp"
+
+#include <algorithm>
+
+
+TableScanner::TableScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_S8_T16_A8_(
+        ms_state_table_,
+        ms_state_count_,
+        ms_transition_table_,
+        ms_transition_count_,
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_)
+{
+
+    ResetForNewInput();
+}
+
+TableScanner::~TableScanner ()
+{
+}
+
+TableScanner::StateMachine::Name TableScanner::CurrentStateMachine () const
+{
+    assert(InitialState_() != NULL);
+    std::size_t initial_node_index = InitialState_() - ms_state_table_;
+    assert(initial_node_index < ms_state_count_);
+    switch (initial_node_index)
+    {
+        default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
+        case 0: return StateMachine::MAIN;
+    }
+}
+
+void TableScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(ms_state_table_ + ms_state_machine_start_state_index_[state_machine]);
+    ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+TableScanner::ScannerCheckpoint TableScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void TableScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void TableScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void TableScanner::ResetForNewInput ()
+{
+    m_parallel_scan_chunks_.clear();
+    ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type TableScanner::Scan () throw()
+{
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 37 "table_scanner.reflex"
+
+    return Token::BAD_TOKEN;
+
+#line 126 "table_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 1:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 2:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 4:
+                {
+                    return Token::FLOAT;
+                }
+                break;
+
+                case 5:
+                {
+                    return Token::STRING;
+                }
+                break;
+
+                case 6:
+                {
+                    return Token::COMMENT;
+                }
+                break;
+
+                case 7:
+                {
+                    return Token::COMMENT;
+                }
+                break;
+
+                case 8:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 9:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 10:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 28 "table_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 221 "table_scanner.cpp"
+}
+
+std::size_t TableScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::size_t TableScanner::ScanParallel (std::vector<TokenId> &token_ids, std::vector<std::size_t> &token_offsets, std::vector<std::size_t> &token_lengths, std::size_t thread_count)
+{
+    // a string kept by KeepString must be scanned by Scan (see ScanBatch).
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t const input_size = InputSpanEnd() - InputSpanBegin();
+    std::size_t offset = ScanOffset_();
+    std::vector<ParallelScanChunk_> &chunks = m_parallel_scan_chunks_;
+    // the chunks from a previous call can be reused as long as they cover
+    // the current offset in the current state machine.
+    if (chunks.empty() || m_parallel_scan_state_machine_ != CurrentStateMachine() || offset < chunks.front().m_begin)
+    {
+        // chunks smaller than this aren't worth starting a thread for.
+        static std::size_t const MIN_CHUNK_SIZE = 64*1024;
+        std::size_t const remaining_size = input_size - offset;
+        std::size_t chunk_count = thread_count;
+        if (chunk_count > remaining_size / MIN_CHUNK_SIZE)
+            chunk_count = remaining_size / MIN_CHUNK_SIZE;
+        if (chunk_count == 0)
+            chunk_count = 1;
+
+        // a single chunk would only be scanned by ScanBatch, into temporary
+        // vectors, so the input is scanned by ScanBatch directly instead.
+        if (chunk_count == 1)
+        {
+            static std::size_t const TOKEN_CAPACITY = 256;
+            TokenId batch_token_ids[TOKEN_CAPACITY];
+            std::size_t batch_token_offsets[TOKEN_CAPACITY];
+            std::size_t batch_token_lengths[TOKEN_CAPACITY];
+            std::size_t const initial_token_count = token_ids.size();
+            std::size_t token_count;
+            do
+            {
+                token_count = ScanBatch(batch_token_ids, batch_token_offsets, batch_token_lengths, TOKEN_CAPACITY);
+                token_ids.insert(token_ids.end(), batch_token_ids, batch_token_ids + token_count);
+                token_offsets.insert(token_offsets.end(), batch_token_offsets, batch_token_offsets + token_count);
+                token_lengths.insert(token_lengths.end(), batch_token_lengths, batch_token_lengths + token_count);
+            }
+            while (token_count == TOKEN_CAPACITY);
+            return token_ids.size() - initial_token_count;
+        }
+
+        chunks.clear();
+        chunks.resize(chunk_count);
+        for (std::size_t i = 0; i < chunk_count; ++i)
+        {
+            chunks[i].m_begin = offset + remaining_size / chunk_count * i;
+            chunks[i].m_end = i+1 < chunk_count ? offset + remaining_size / chunk_count * (i+1) : input_size;
+        }
+        m_parallel_scan_state_machine_ = CurrentStateMachine();
+        // the first chunk is scanned by this thread, while the others are
+        // scanned speculatively.
+        std::vector<std::thread> threads;
+        try {
+            threads.reserve(chunk_count - 1);
+            for (std::size_t i = 1; i < chunk_count; ++i)
+                threads.push_back(std::thread(&TableScanner::ScanParallelChunk_, InputSpanBegin(), InputSpanEnd(), CurrentStateMachine(), &chunks[i]));
+            ScanParallelChunk_(InputSpanBegin(), InputSpanEnd(), CurrentStateMachine(), &chunks[0]);
+        } catch (...) {
+            // destroying a joinable std::thread calls std::terminate, so the
+            // threads already started (e.g. before starting another one
+            // threw) must be joined.  their chunks are incomplete, so none
+            // of them are kept.
+            for (std::size_t i = 0; i < threads.size(); ++i)
+                threads[i].join();
+            chunks.clear();
+            throw;
+        }
+        for (std::size_t i = 0; i < threads.size(); ++i)
+            threads[i].join();
+    }
+
+    // stitch the chunks together, following the actual token stream.  the
+    // scan from a given offset (with no kept string) in a given state
+    // machine is deterministic, and token-only rules don't switch state
+    // machines, so once a chunk's scan has found a token beginning where the
+    // actual token stream is, the run of contiguous tokens following it are
+    // actual tokens, and likewise a chunk's stop is an actual stop.
+    std::size_t const initial_token_count = token_ids.size();
+    std::size_t chunk_index = 0;
+    while (true)
+    {
+        while (chunk_index+1 < chunks.size() && offset >= chunks[chunk_index].m_end)
+            ++chunk_index;
+        ParallelScanChunk_ const &chunk = chunks[chunk_index];
+
+        if (std::binary_search(chunk.m_stop_offsets.begin(), chunk.m_stop_offsets.end(), offset))
+        {
+            SeekTo_(offset);
+            break;
+        }
+
+        std::vector<std::size_t>::const_iterator it = std::lower_bound(chunk.m_token_offsets.begin(), chunk.m_token_offsets.end(), offset);
+        if (it != chunk.m_token_offsets.end() && *it == offset)
+        {
+            std::size_t i = it - chunk.m_token_offsets.begin();
+            do
+            {
+                token_ids.push_back(chunk.m_token_ids[i]);
+                token_offsets.push_back(chunk.m_token_offsets[i]);
+                token_lengths.push_back(chunk.m_token_lengths[i]);
+                offset = chunk.m_token_offsets[i] + chunk.m_token_lengths[i];
+                ++i;
+            }
+            while (i < chunk.m_token_offsets.size() && chunk.m_token_offsets[i] == offset);
+        }
+        else
+        {
+            // the chunk's scan isn't in step with the actual token stream
+            // (yet), so scan the next token sequentially.
+            if (ScanOffset_() != offset)
+                SeekTo_(offset);
+            TokenId token_id;
+            std::size_t token_offset;
+            std::size_t token_length;
+            if (ScanBatch(&token_id, &token_offset, &token_length, 1) == 0)
+                break;
+            token_ids.push_back(token_id);
+            token_offsets.push_back(token_offset);
+            token_lengths.push_back(token_length);
+            offset = token_offset + token_length;
+        }
+    }
+    return token_ids.size() - initial_token_count;
+}
+
+void TableScanner::ScanParallelChunk_ (char const *input_begin, char const *input_end, StateMachine::Name state_machine, ParallelScanChunk_ *chunk)
+{
+    static std::size_t const TOKEN_CAPACITY = 256;
+    TokenId token_ids[TOKEN_CAPACITY];
+    std::size_t token_offsets[TOKEN_CAPACITY];
+    std::size_t token_lengths[TOKEN_CAPACITY];
+    // each chunk is scanned by its own scanner instance, which only shares
+    // the (constant) DFA tables with the others.
+    TableScanner scanner;
+    scanner.InputSpan(input_begin, input_end);
+    scanner.SeekTo_(chunk->m_begin);
+    scanner.SwitchToStateMachine(state_machine);
+    while (true)
+    {
+        std::size_t token_count = scanner.ScanBatch(token_ids, token_offsets, token_lengths, TOKEN_CAPACITY);
+        for (std::size_t i = 0; i < token_count; ++i)
+        {
+            if (token_offsets[i] >= chunk->m_end)
+                return;
+            chunk->m_token_ids.push_back(token_ids[i]);
+            chunk->m_token_offsets.push_back(token_offsets[i]);
+            chunk->m_token_lengths.push_back(token_lengths[i]);
+        }
+        if (token_count < TOKEN_CAPACITY)
+        {
+            // record the stop and resume the scan at the next atom, so that
+            // a stop (e.g. a rule with a non-trivial handler) doesn't leave
+            // the rest of the chunk to be scanned sequentially.
+            std::size_t stop_offset = scanner.ScanOffset_();
+            if (stop_offset >= chunk->m_end)
+                return;
+            chunk->m_stop_offsets.push_back(stop_offset);
+            scanner.SeekTo_(stop_offset + 1);
+        }
+    }
+}
+
+std::uint32_t TableScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 8)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 31];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const TableScanner::ms_state_machine_start_state_index_[] =
+{
+    0,
+};
+std::uint8_t const TableScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+};
+std::uint32_t const TableScanner::ms_state_machine_count_ = 1;
+
+// the order of the states indicates priority (only for accept states).
+// the lower the state's index in this array, the higher its priority.
+ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_S8_T16_A8_::DfaState_ const TableScanner::ms_state_table_[] =
+{
+    { 0, 11, 32, 2, 0 },
+    { 32, 11, 24, 0, 0 },
+    { 56, 9, 24, 0, 1 },
+    { 80, 8, 24, 0, 0 },
+    { 104, 8, 0, 0, 0 },
+    { 104, 11, 24, 0, 2 },
+    { 128, 5, 0, 0, 0 },
+    { 128, 11, 24, 0, 0 },
+    { 152, 8, 24, 0, 0 },
+    { 176, 8, 24, 0, 0 },
+    { 200, 8, 24, 0, 0 },
+    { 224, 8, 24, 0, 0 },
+    { 248, 11, 24, 0, 3 },
+    { 272, 11, 24, 0, 4 },
+    { 296, 7, 0, 0, 0 },
+    { 296, 6, 24, 0, 5 },
+    { 320, 2, 24, 0, 0 },
+    { 344, 4, 24, 0, 6 },
+    { 368, 11, 24, 0, 0 },
+    { 392, 11, 24, 0, 0 },
+    { 416, 4, 24, 0, 6 },
+    { 440, 2, 24, 0, 6 },
+    { 464, 11, 24, 0, 0 },
+    { 488, 3, 24, 0, 7 },
+    { 512, 8, 24, 0, 0 },
+    { 536, 8, 24, 0, 0 },
+    { 560, 1, 24, 0, 8 },
+    { 584, 8, 24, 0, 0 },
+    { 608, 10, 24, 0, 0 }
+};
+std::size_t const TableScanner::ms_state_count_ = sizeof(TableScanner::ms_state_table_) / sizeof(*TableScanner::ms_state_table_);
+
+ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_S8_T16_A8_::DfaTransition_ const TableScanner::ms_transition_table_[] =
+{
+    { 1 },
+    { 1 },
+    { 28 },
+    { 28 },
+    { 1 },
+    { 1 },
+    { 28 },
+    { 28 },
+    { 1 },
+    { 1 },
+    { 28 },
+    { 28 },
+    { 1 },
+    { 1 },
+    { 28 },
+    { 28 },
+    { 1 },
+    { 1 },
+    { 28 },
+    { 28 },
+    { 1 },
+    { 1 },
+    { 28 },
+    { 28 },
+    { 1 },
+    { 1 },
+    { 28 },
+    { 28 },
+    { 1 },
+    { 1 },
+    { 28 },
+    { 28 },
+    { 29 },
+    { 29 },
+    { 2 },
+    { 2 },
+    { 3 },
+    { 5 },
+    { 4 },
+    { 8 },
+    { 4 },
+    { 9 },
+    { 10 },
+    { 4 },
+    { 11 },
+    { 16 },
+    { 21 },
+    { 24 },
+    { 3 },
+    { 25 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 29 },
+    { 27 },
+    { 29 },
+    { 29 },
+    { 2 },
+    { 2 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 4 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 5 },
+    { 5 },
+    { 29 },
+    { 5 },
+    { 6 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 5 },
+    { 29 },
+    { 5 },
+    { 5 },
+    { 29 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 5 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 4 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 4 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 4 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 4 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 12 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 15 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 13 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 29 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 13 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 14 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 12 },
+    { 29 },
+    { 15 },
+    { 15 },
+    { 29 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 15 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 17 },
+    { 29 },
+    { 21 },
+    { 21 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 22 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 17 },
+    { 17 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 18 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 19 },
+    { 19 },
+    { 29 },
+    { 29 },
+    { 20 },
+    { 20 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 20 },
+    { 20 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 20 },
+    { 20 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 17 },
+    { 29 },
+    { 21 },
+    { 21 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 23 },
+    { 23 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 23 },
+    { 23 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 23 },
+    { 23 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 23 },
+    { 23 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 3 },
+    { 4 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 4 },
+    { 3 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 26 },
+    { 26 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 29 },
+    { 4 },
+    { 29 },
+    { 29 },
+    { 2 },
+    { 2 },
+    { 3 },
+    { 5 },
+    { 4 },
+    { 8 },
+    { 4 },
+    { 9 },
+    { 10 },
+    { 4 },
+    { 11 },
+    { 16 },
+    { 21 },
+    { 24 },
+    { 3 },
+    { 25 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 26 },
+    { 29 },
+    { 27 }
+};
+std::size_t const TableScanner::ms_transition_count_ = sizeof(TableScanner::ms_transition_table_) / sizeof(*TableScanner::ms_transition_table_);
+
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 24 atom classes.
+std::uint8_t const TableScanner::ms_atom_class_table_[256] =
+{
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 4, 5, 1, 1, 6, 7, 1, 6, 6, 8, 9, 6, 10, 11, 12,
+    13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6, 6, 15, 16, 17, 6,
+    1, 18, 18, 18, 18, 19, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 21, 20, 20, 6, 22, 6, 6, 20,
+    1, 18, 18, 18, 18, 19, 18, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 20, 20, 20, 20, 20, 20, 20, 21, 20, 20, 6, 23, 6, 6, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const TableScanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 251, 255, 255, 255, 255, 255, 255, 239, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        4, false,
+        { 1, 11, 35, 93 },
+        { 9, 33, 91, 255 }
+    },
+    {
+        {
+            254, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 43, 0, 0 },
+        { 41, 255, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 42, 0, 0, 0 },
+        { 42, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 11, 0, 0 },
+        { 9, 255, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 126, 0, 0, 0, 126, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        3, false,
+        { 48, 65, 97, 0 },
+        { 57, 70, 102, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    }
+};
+std::size_t const TableScanner::ms_skip_set_count_ = sizeof(TableScanner::ms_skip_set_table_) / sizeof(*TableScanner::ms_skip_set_table_);
+
+std::uint32_t const TableScanner::ms_accept_handler_count_ = 11;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const TableScanner::ms_accept_handler_is_token_only_[] =
+{
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true
+};
+TableScanner::TokenId const TableScanner::ms_accept_handler_token_id_[] =
+{
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::INTEGER,
+    Token::FLOAT,
+    Token::STRING,
+    Token::COMMENT,
+    Token::COMMENT,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const TableScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    0,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const TableScanner::ms_keyword_slot_table_[] =
+{
+    { "break", 5, 0, 0 },
+    { "default", 7, 0, 0 },
+    { "", 0, 0, 11 },
+    { "int", 3, 0, 0 },
+    { "", 0, 0, 11 },
+    { "static", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "const", 5, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "void", 4, 0, 0 },
+    { "return", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "continue", 8, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "switch", 6, 0, 0 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "", 0, 0, 11 },
+    { "case", 4, 0, 0 },
+    { "do", 2, 0, 0 },
+    { "if", 2, 0, 0 },
+    { "", 0, 0, 11 },
+    { "struct", 6, 0, 0 },
+    { "char", 4, 0, 0 },
+    { "else", 4, 0, 0 },
+    { "while", 5, 0, 0 },
+    { "for", 3, 0, 0 },
+    { "", 0, 0, 11 }
+};
+std::uint16_t const TableScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    2,
+    1,
+    0,
+    0,
+    1,
+    2,
+    2
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
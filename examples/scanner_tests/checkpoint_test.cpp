@@ -0,0 +1,136 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that scanning ahead from a Checkpoint and then calling Restore
+// rescans exactly the same tokens, and that the tokens (not counting the
+// ones scanned ahead) are the same as plain Scan, for each kind of input
+// source.  The buffered scanners have tiny readaheads, so that scanning ahead
+// refills the buffer while the checkpointed input is pinned in it.
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include "block_scanner.hpp"
+#include "push_scanner.hpp"
+#include "reference_scanner.hpp"
+#include "streambuf_scanner.hpp"
+
+// Returns the next token of a scanner which reads its own input.
+struct ReadInput
+{
+    template <typename Scanner_>
+    Token::Type operator () (Scanner_ &scanner) { return scanner.Scan(); }
+}; // end of struct ReadInput
+
+// Returns the next token of a push-mode scanner, feeding it pieces of 0 to 5
+// atoms of input as it needs them.
+struct FeedInput
+{
+    std::string const &m_input;
+    std::size_t m_fed;
+    InputGenerator &m_generator;
+
+    FeedInput (std::string const &input, InputGenerator &generator) : m_input(input), m_fed(0), m_generator(generator) { }
+
+    template <typename Scanner_>
+    Token::Type operator () (Scanner_ &scanner)
+    {
+        for (std::size_t i = 0; i < 100000; ++i)
+        {
+            Token::Type token = scanner.Scan();
+            if (token != Token::NEED_MORE_INPUT)
+                return token;
+            if (m_fed == m_input.size())
+            {
+                scanner.FeedEndOfInput();
+            }
+            else
+            {
+                std::size_t piece_size = std::min(m_generator.Next(6), m_input.size() - m_fed);
+                scanner.Feed(m_input.data() + m_fed, piece_size);
+                m_fed += piece_size;
+            }
+        }
+        return Token::NEED_MORE_INPUT;
+    }
+}; // end of struct FeedInput
+
+// Scans up to token_count tokens (stopping after the end of input), returning
+// their record.
+template <typename Scanner_, typename NextToken_>
+std::string ScanTokensAhead (Scanner_ &scanner, NextToken_ &next_token, std::size_t token_count, bool &is_at_end_of_input)
+{
+    std::string token_record;
+    is_at_end_of_input = false;
+    for (std::size_t i = 0; i < token_count && !is_at_end_of_input; ++i)
+    {
+        Token::Type token = next_token(scanner);
+        RecordToken(token_record, token, scanner.m_text);
+        is_at_end_of_input = token == Token::END_OF_INPUT || token == Token::NEED_MORE_INPUT;
+    }
+    return token_record;
+}
+
+// Scans the input, taking a checkpoint before about every third token,
+// scanning 1 to 4 tokens ahead, restoring the checkpoint and rescanning them.
+template <typename Scanner_, typename NextToken_>
+std::string ScanTokensWithRestores (Scanner_ &scanner, NextToken_ next_token, InputGenerator &generator)
+{
+    std::string token_record;
+    bool is_at_end_of_input = false;
+    for (std::size_t i = 0; i < 100000 && !is_at_end_of_input; ++i)
+    {
+        if (generator.Next(3) != 0)
+        {
+            token_record += ScanTokensAhead(scanner, next_token, 1, is_at_end_of_input);
+            continue;
+        }
+
+        typename Scanner_::ScannerCheckpoint checkpoint(scanner.Checkpoint());
+        std::size_t token_count = 1 + generator.Next(4);
+        std::string scanned_ahead(ScanTokensAhead(scanner, next_token, token_count, is_at_end_of_input));
+        scanner.Restore(checkpoint);
+        std::string rescanned(ScanTokensAhead(scanner, next_token, token_count, is_at_end_of_input));
+        scanner.ReleaseCheckpoint(checkpoint);
+        if (rescanned != scanned_ahead)
+            return token_record + "<scanned ahead " + scanned_ahead + "but rescanned " + rescanned + ">";
+        token_record += rescanned;
+    }
+    return token_record;
+}
+
+int main ()
+{
+    InputGenerator generator;
+    int failure_count = 0;
+    for (int i = 0; i < 2000 && failure_count < 10; ++i)
+    {
+        std::string input(generator.Input(24));
+
+        ReferenceScanner reference_scanner;
+        reference_scanner.InputSpan(input.data(), input.data() + input.size());
+        std::string expected(ScanTokens(reference_scanner));
+
+        {
+            ReferenceScanner scanner;
+            scanner.InputSpan(input.data(), input.data() + input.size());
+            failure_count += CheckTokenRecord("in-memory checkpoint", input, expected, ScanTokensWithRestores(scanner, ReadInput(), generator));
+        }
+        {
+            std::istringstream in(input);
+            StreambufScanner scanner;
+            scanner.InputStreambuf(in.rdbuf());
+            failure_count += CheckTokenRecord("streambuf checkpoint", input, expected, ScanTokensWithRestores(scanner, ReadInput(), generator));
+        }
+        {
+            BlockScanner scanner;
+            scanner.m_block_input = input;
+            scanner.m_max_block_size = 2;
+            failure_count += CheckTokenRecord("return_next_input_block checkpoint", input, expected, ScanTokensWithRestores(scanner, ReadInput(), generator));
+        }
+        {
+            PushScanner scanner;
+            failure_count += CheckTokenRecord("push checkpoint", input, expected, ScanTokensWithRestores(scanner, FeedInput(input, generator), generator));
+        }
+    }
+    return failure_count == 0 ? 0 : 1;
+}
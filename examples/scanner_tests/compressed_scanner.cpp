@@ -0,0 +1,1835 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// compressed_scanner.cpp generated by reflex
+// from compressed_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "compressed_scanner.hpp"
+
+
+CompressedScanner::CompressedScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_(
+        ms_state_table_,
+        ms_state_count_,
+        ms_transition_table_,
+        ms_transition_count_,
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_)
+{
+
+    ResetForNewInput();
+}
+
+CompressedScanner::~CompressedScanner ()
+{
+}
+
+CompressedScanner::StateMachine::Name CompressedScanner::CurrentStateMachine () const
+{
+    assert(InitialState_() != NULL);
+    std::size_t initial_node_index = InitialState_() - ms_state_table_;
+    assert(initial_node_index < ms_state_count_);
+    switch (initial_node_index)
+    {
+        default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
+        case 0: return StateMachine::BLOCK_COMMENT;
+        case 8: return StateMachine::KEYWORDS;
+        case 25: return StateMachine::KEYWORDS_CASE_INSENSITIVE;
+        case 65: return StateMachine::KEYWORDS_UNGREEDY;
+        case 82: return StateMachine::MAIN;
+    }
+}
+
+void CompressedScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::BLOCK_COMMENT ||
+        state_machine == StateMachine::KEYWORDS ||
+        state_machine == StateMachine::KEYWORDS_CASE_INSENSITIVE ||
+        state_machine == StateMachine::KEYWORDS_UNGREEDY ||
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(ms_state_table_ + ms_state_machine_start_state_index_[state_machine]);
+    ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+CompressedScanner::ScannerCheckpoint CompressedScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void CompressedScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void CompressedScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void CompressedScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type CompressedScanner::Scan () throw()
+{
+
+#line 47 "compressed_scanner.reflex"
+
+    m_text.clear();
+
+#line 93 "compressed_scanner.cpp"
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 59 "compressed_scanner.reflex"
+
+    m_text.assign(rejected_string_data, rejected_string_length);
+    return Token::BAD_TOKEN;
+
+#line 138 "compressed_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+
+#line 129 "compressed_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::COMMENT;
+    
+#line 166 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 1:
+                {
+
+#line 136 "compressed_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::UNTERMINATED_COMMENT;
+    
+#line 180 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 2:
+                {
+
+#line 150 "compressed_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 190 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 4:
+                {
+
+#line 154 "compressed_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 206 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 5:
+                {
+
+#line 157 "compressed_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 216 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 6:
+                {
+
+#line 159 "compressed_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 226 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 7:
+                {
+
+#line 161 "compressed_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 236 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 8:
+                {
+
+#line 164 "compressed_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 246 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 9:
+                {
+
+#line 167 "compressed_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 256 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 10:
+                {
+
+#line 169 "compressed_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 266 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 11:
+                {
+
+#line 172 "compressed_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 276 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 12:
+                {
+
+#line 176 "compressed_scanner.reflex"
+ KeepString(); 
+#line 286 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 13:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 14:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 15:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 16:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 17:
+                {
+
+#line 228 "compressed_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 320 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 18:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 19:
+                {
+
+#line 232 "compressed_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 336 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 20:
+                {
+
+#line 235 "compressed_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 346 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 21:
+                {
+
+#line 237 "compressed_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 356 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 22:
+                {
+
+#line 239 "compressed_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 366 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 23:
+                {
+
+#line 242 "compressed_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 376 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 24:
+                {
+
+#line 245 "compressed_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 386 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 25:
+                {
+
+#line 247 "compressed_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 396 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 26:
+                {
+
+#line 250 "compressed_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 406 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 27:
+                {
+
+#line 254 "compressed_scanner.reflex"
+ KeepString(); 
+#line 416 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 28:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 29:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 30:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 31:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 32:
+                {
+
+#line 189 "compressed_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 450 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 33:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 34:
+                {
+
+#line 193 "compressed_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 466 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 35:
+                {
+
+#line 196 "compressed_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 476 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 36:
+                {
+
+#line 198 "compressed_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 486 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 37:
+                {
+
+#line 200 "compressed_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 496 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 38:
+                {
+
+#line 203 "compressed_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 506 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 39:
+                {
+
+#line 206 "compressed_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 516 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 40:
+                {
+
+#line 208 "compressed_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 526 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 41:
+                {
+
+#line 211 "compressed_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 536 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 42:
+                {
+
+#line 215 "compressed_scanner.reflex"
+ KeepString(); 
+#line 546 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 43:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 44:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 45:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 46:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 47:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 48:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 49:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 50:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 51:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 52:
+                {
+
+#line 105 "compressed_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::DIRECTIVE;
+    
+#line 613 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 53:
+                {
+
+#line 111 "compressed_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::STRING;
+    
+#line 626 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 54:
+                {
+
+#line 118 "compressed_scanner.reflex"
+
+        KeepString();
+        SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
+    
+#line 639 "compressed_scanner.cpp"
+
+                }
+                break;
+
+                case 55:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 50 "compressed_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 660 "compressed_scanner.cpp"
+}
+
+std::size_t CompressedScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::uint32_t CompressedScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 6)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 63];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const CompressedScanner::ms_state_machine_start_state_index_[] =
+{
+    0,
+    8,
+    25,
+    65,
+    82,
+};
+std::uint8_t const CompressedScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+    0,
+    1,
+    2,
+    0,
+};
+std::uint32_t const CompressedScanner::ms_state_machine_count_ = 5;
+
+// the order of the states indicates priority (only for accept states).
+// the lower the state's index in this array, the higher its priority.
+ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::DfaState_ const CompressedScanner::ms_state_table_[] =
+{
+    { 0, 99, 56, 2, 0 },
+    { 31, 99, 56, 0, 0 },
+    { 0, 0, 56, 2, 0 },
+    { 0, 1, 1, 0, 0 },
+    { 64, 99, 56, 2, 0 },
+    { 313, 1, 56, 0, 0 },
+    { 0, 99, 0, 0, 0 },
+    { 0, 5, 1, 0, 0 },
+    { 96, 99, 56, 6, 0 },
+    { 381, 99, 56, 0, 0 },
+    { 536, 9, 13, 0, 1 },
+    { 383, 99, 15, 0, 2 },
+    { 369, 99, 56, 0, 0 },
+    { 0, 99, 11, 0, 0 },
+    { 375, 99, 14, 0, 3 },
+    { 0, 99, 12, 0, 0 },
+    { 395, 10, 13, 0, 0 },
+    { 128, 99, 13, 8, 0 },
+    { 0, 10, 5, 0, 0 },
+    { 0, 9, 16, 0, 0 },
+    { 440, 9, 56, 0, 0 },
+    { 470, 10, 13, 0, 0 },
+    { 481, 10, 13, 0, 0 },
+    { 0, 10, 6, 0, 0 },
+    { 0, 20, 16, 0, 0 },
+    { 160, 99, 56, 6, 0 },
+    { 413, 99, 56, 0, 0 },
+    { 492, 26, 28, 0, 0 },
+    { 497, 27, 28, 0, 1 },
+    { 397, 27, 28, 0, 0 },
+    { 501, 27, 24, 0, 0 },
+    { 387, 99, 30, 0, 2 },
+    { 524, 99, 56, 0, 0 },
+    { 0, 99, 26, 0, 0 },
+    { 407, 99, 29, 0, 0 },
+    { 539, 34, 29, 0, 3 },
+    { 0, 35, 25, 0, 0 },
+    { 0, 99, 27, 0, 0 },
+    { 334, 27, 28, 0, 0 },
+    { 192, 99, 19, 8, 0 },
+    { 536, 27, 19, 0, 0 },
+    { 425, 27, 28, 0, 0 },
+    { 401, 27, 28, 0, 0 },
+    { 430, 27, 28, 0, 0 },
+    { 537, 27, 17, 0, 0 },
+    { 472, 27, 28, 0, 0 },
+    { 370, 27, 28, 0, 0 },
+    { 538, 27, 22, 0, 0 },
+    { 539, 27, 28, 0, 0 },
+    { 432, 27, 28, 0, 0 },
+    { 478, 27, 28, 0, 0 },
+    { 479, 27, 28, 0, 0 },
+    { 396, 27, 28, 0, 0 },
+    { 476, 27, 28, 0, 0 },
+    { 545, 27, 18, 0, 0 },
+    { 433, 27, 28, 0, 0 },
+    { 342, 27, 28, 0, 0 },
+    { 493, 27, 28, 0, 0 },
+    { 500, 27, 28, 0, 0 },
+    { 0, 26, 31, 0, 0 },
+    { 547, 26, 56, 0, 0 },
+    { 507, 27, 28, 0, 0 },
+    { 489, 27, 28, 0, 0 },
+    { 548, 27, 21, 0, 0 },
+    { 0, 60, 31, 0, 0 },
+    { 224, 99, 56, 6, 0 },
+    { 445, 99, 56, 0, 0 },
+    { 551, 66, 43, 0, 0 },
+    { 538, 99, 45, 0, 0 },
+    { 558, 99, 56, 0, 0 },
+    { 0, 99, 41, 0, 0 },
+    { 530, 99, 44, 0, 0 },
+    { 0, 99, 42, 0, 0 },
+    { 546, 67, 43, 0, 0 },
+    { 256, 99, 43, 8, 0 },
+    { 0, 67, 35, 0, 0 },
+    { 0, 66, 46, 0, 0 },
+    { 552, 66, 56, 0, 0 },
+    { 548, 67, 43, 0, 0 },
+    { 548, 67, 43, 0, 0 },
+    { 0, 67, 36, 0, 0 },
+    { 0, 77, 46, 0, 0 },
+    { 288, 99, 56, 6, 0 },
+    { 349, 99, 56, 0, 0 },
+    { 542, 99, 51, 0, 2 },
+    { 563, 99, 56, 0, 0 },
+    { 0, 99, 50, 0, 0 },
+    { 319, 99, 56, 0, 4 },
+    { 0, 99, 53, 0, 0 },
+    { 551, 87, 56, 0, 0 },
+    { 569, 99, 50, 0, 0 },
+    { 0, 99, 54, 0, 0 },
+    { 568, 99, 49, 0, 5 },
+    { 0, 85, 50, 0, 0 },
+    { 522, 83, 48, 0, 1 },
+    { 0, 83, 55, 0, 0 },
+    { 573, 83, 56, 0, 0 },
+    { 460, 99, 52, 0, 6 },
+    { 0, 96, 55, 0, 0 }
+};
+std::size_t const CompressedScanner::ms_state_count_ = sizeof(CompressedScanner::ms_state_table_) / sizeof(*CompressedScanner::ms_state_table_);
+
+// the comb vector of all the states' lookup tables.  each element is
+// { target state, owner state }; an owner of 99 indicates an unused element.
+ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::DfaTransition_ const CompressedScanner::ms_transition_table_[] =
+{
+    { 1, 0 },
+    { 1, 0 },
+    { 3, 0 },
+    { 3, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 3, 0 },
+    { 3, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 3, 0 },
+    { 3, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 3, 0 },
+    { 3, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 3, 0 },
+    { 3, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 3, 0 },
+    { 3, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 3, 0 },
+    { 3, 0 },
+    { 1, 0 },
+    { 1, 0 },
+    { 3, 0 },
+    { 3, 0 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 4, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 2, 1 },
+    { 5, 4 },
+    { 5, 4 },
+    { 7, 4 },
+    { 7, 4 },
+    { 5, 4 },
+    { 5, 4 },
+    { 7, 4 },
+    { 7, 4 },
+    { 5, 4 },
+    { 5, 4 },
+    { 7, 4 },
+    { 7, 4 },
+    { 5, 4 },
+    { 5, 4 },
+    { 7, 4 },
+    { 7, 4 },
+    { 5, 4 },
+    { 5, 4 },
+    { 7, 4 },
+    { 7, 4 },
+    { 5, 4 },
+    { 5, 4 },
+    { 7, 4 },
+    { 7, 4 },
+    { 5, 4 },
+    { 5, 4 },
+    { 7, 4 },
+    { 7, 4 },
+    { 5, 4 },
+    { 5, 4 },
+    { 7, 4 },
+    { 7, 4 },
+    { 9, 8 },
+    { 9, 8 },
+    { 19, 8 },
+    { 19, 8 },
+    { 20, 8 },
+    { 20, 8 },
+    { 24, 8 },
+    { 24, 8 },
+    { 9, 8 },
+    { 9, 8 },
+    { 19, 8 },
+    { 19, 8 },
+    { 20, 8 },
+    { 20, 8 },
+    { 24, 8 },
+    { 24, 8 },
+    { 9, 8 },
+    { 9, 8 },
+    { 19, 8 },
+    { 19, 8 },
+    { 20, 8 },
+    { 20, 8 },
+    { 24, 8 },
+    { 24, 8 },
+    { 9, 8 },
+    { 9, 8 },
+    { 19, 8 },
+    { 19, 8 },
+    { 20, 8 },
+    { 20, 8 },
+    { 24, 8 },
+    { 24, 8 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 10, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 18, 17 },
+    { 26, 25 },
+    { 26, 25 },
+    { 59, 25 },
+    { 59, 25 },
+    { 60, 25 },
+    { 60, 25 },
+    { 64, 25 },
+    { 64, 25 },
+    { 26, 25 },
+    { 26, 25 },
+    { 59, 25 },
+    { 59, 25 },
+    { 60, 25 },
+    { 60, 25 },
+    { 64, 25 },
+    { 64, 25 },
+    { 26, 25 },
+    { 26, 25 },
+    { 59, 25 },
+    { 59, 25 },
+    { 60, 25 },
+    { 60, 25 },
+    { 64, 25 },
+    { 64, 25 },
+    { 26, 25 },
+    { 26, 25 },
+    { 59, 25 },
+    { 59, 25 },
+    { 60, 25 },
+    { 60, 25 },
+    { 64, 25 },
+    { 64, 25 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 40, 39 },
+    { 66, 65 },
+    { 66, 65 },
+    { 76, 65 },
+    { 76, 65 },
+    { 77, 65 },
+    { 77, 65 },
+    { 81, 65 },
+    { 81, 65 },
+    { 66, 65 },
+    { 66, 65 },
+    { 76, 65 },
+    { 76, 65 },
+    { 77, 65 },
+    { 77, 65 },
+    { 81, 65 },
+    { 81, 65 },
+    { 66, 65 },
+    { 66, 65 },
+    { 76, 65 },
+    { 76, 65 },
+    { 77, 65 },
+    { 77, 65 },
+    { 81, 65 },
+    { 81, 65 },
+    { 66, 65 },
+    { 66, 65 },
+    { 76, 65 },
+    { 76, 65 },
+    { 77, 65 },
+    { 77, 65 },
+    { 81, 65 },
+    { 81, 65 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 67, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 75, 74 },
+    { 83, 82 },
+    { 83, 82 },
+    { 95, 82 },
+    { 95, 82 },
+    { 96, 82 },
+    { 96, 82 },
+    { 98, 82 },
+    { 98, 82 },
+    { 83, 82 },
+    { 83, 82 },
+    { 95, 82 },
+    { 95, 82 },
+    { 96, 82 },
+    { 96, 82 },
+    { 98, 82 },
+    { 98, 82 },
+    { 83, 82 },
+    { 83, 82 },
+    { 95, 82 },
+    { 95, 82 },
+    { 96, 82 },
+    { 96, 82 },
+    { 98, 82 },
+    { 98, 82 },
+    { 83, 82 },
+    { 83, 82 },
+    { 95, 82 },
+    { 95, 82 },
+    { 96, 82 },
+    { 96, 82 },
+    { 98, 82 },
+    { 98, 82 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 6, 5 },
+    { 87, 87 },
+    { 88, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 89, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 87, 87 },
+    { 84, 83 },
+    { 84, 83 },
+    { 85, 83 },
+    { 87, 83 },
+    { 28, 38 },
+    { 86, 83 },
+    { 86, 83 },
+    { 90, 83 },
+    { 92, 83 },
+    { 39, 38 },
+    { 93, 83 },
+    { 93, 83 },
+    { 28, 56 },
+    { 94, 83 },
+    { 57, 56 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 94, 83 },
+    { 10, 9 },
+    { 13, 12 },
+    { 11, 9 },
+    { 11, 9 },
+    { 11, 11 },
+    { 11, 11 },
+    { 14, 14 },
+    { 14, 14 },
+    { 31, 31 },
+    { 31, 31 },
+    { 28, 46 },
+    { 12, 9 },
+    { 14, 9 },
+    { 14, 9 },
+    { 15, 9 },
+    { 10, 9 },
+    { 47, 46 },
+    { 10, 9 },
+    { 10, 9 },
+    { 16, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 10, 9 },
+    { 27, 26 },
+    { 30, 29 },
+    { 31, 26 },
+    { 31, 26 },
+    { 28, 52 },
+    { 28, 29 },
+    { 35, 34 },
+    { 36, 34 },
+    { 17, 16 },
+    { 28, 42 },
+    { 53, 52 },
+    { 32, 26 },
+    { 34, 26 },
+    { 34, 26 },
+    { 37, 26 },
+    { 28, 26 },
+    { 43, 42 },
+    { 28, 26 },
+    { 28, 26 },
+    { 38, 26 },
+    { 41, 26 },
+    { 45, 26 },
+    { 28, 26 },
+    { 48, 26 },
+    { 28, 26 },
+    { 28, 26 },
+    { 28, 26 },
+    { 49, 26 },
+    { 28, 26 },
+    { 28, 26 },
+    { 28, 26 },
+    { 55, 26 },
+    { 67, 66 },
+    { 28, 41 },
+    { 68, 66 },
+    { 68, 66 },
+    { 42, 41 },
+    { 44, 43 },
+    { 28, 43 },
+    { 50, 49 },
+    { 28, 49 },
+    { 28, 55 },
+    { 56, 55 },
+    { 69, 66 },
+    { 71, 66 },
+    { 71, 66 },
+    { 72, 66 },
+    { 67, 66 },
+    { 21, 20 },
+    { 67, 66 },
+    { 67, 66 },
+    { 73, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 67, 66 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 97, 97 },
+    { 99, 27 },
+    { 28, 45 },
+    { 99, 27 },
+    { 99, 27 },
+    { 22, 21 },
+    { 28, 53 },
+    { 46, 45 },
+    { 28, 50 },
+    { 28, 51 },
+    { 54, 53 },
+    { 28, 27 },
+    { 99, 27 },
+    { 99, 27 },
+    { 99, 27 },
+    { 99, 27 },
+    { 51, 50 },
+    { 23, 22 },
+    { 52, 51 },
+    { 28, 62 },
+    { 28, 27 },
+    { 28, 27 },
+    { 29, 27 },
+    { 28, 57 },
+    { 28, 27 },
+    { 63, 62 },
+    { 58, 57 },
+    { 28, 28 },
+    { 28, 27 },
+    { 47, 58 },
+    { 28, 58 },
+    { 28, 30 },
+    { 28, 27 },
+    { 99, 94 },
+    { 99, 94 },
+    { 99, 94 },
+    { 99, 94 },
+    { 28, 61 },
+    { 99, 94 },
+    { 99, 94 },
+    { 99, 94 },
+    { 94, 94 },
+    { 62, 61 },
+    { 99, 94 },
+    { 99, 94 },
+    { 99, 10 },
+    { 33, 32 },
+    { 99, 10 },
+    { 99, 10 },
+    { 68, 68 },
+    { 68, 68 },
+    { 71, 71 },
+    { 71, 71 },
+    { 84, 84 },
+    { 84, 84 },
+    { 10, 10 },
+    { 99, 10 },
+    { 99, 10 },
+    { 99, 10 },
+    { 99, 10 },
+    { 99, 67 },
+    { 35, 35 },
+    { 99, 67 },
+    { 99, 67 },
+    { 10, 10 },
+    { 87, 89 },
+    { 28, 40 },
+    { 28, 44 },
+    { 28, 47 },
+    { 44, 48 },
+    { 67, 67 },
+    { 99, 67 },
+    { 99, 67 },
+    { 99, 67 },
+    { 99, 67 },
+    { 28, 54 },
+    { 87, 89 },
+    { 61, 60 },
+    { 28, 63 },
+    { 67, 67 },
+    { 70, 69 },
+    { 74, 73 },
+    { 78, 77 },
+    { 79, 78 },
+    { 80, 79 },
+    { 86, 85 },
+    { 91, 90 },
+    { 92, 92 },
+    { 97, 96 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 },
+    { 99, 99 }
+};
+std::size_t const CompressedScanner::ms_transition_count_ = sizeof(CompressedScanner::ms_transition_table_) / sizeof(*CompressedScanner::ms_transition_table_);
+
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 33 atom classes.
+std::uint8_t const CompressedScanner::ms_atom_class_table_[256] =
+{
+    0, 1, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 5, 6, 7, 2, 2, 2, 2, 8, 8, 9, 8, 8, 8, 2, 10,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 8, 13, 14, 13, 2,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 2, 17, 2, 2, 16,
+    2, 18, 19, 19, 20, 21, 22, 19, 23, 24, 19, 19, 25, 19, 26, 27,
+    19, 19, 28, 29, 30, 31, 19, 32, 19, 19, 19, 8, 2, 8, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const CompressedScanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 60, 0, 0, 0 },
+        { 62, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 251, 255, 255, 255, 255, 255, 255, 239, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        4, false,
+        { 1, 11, 35, 93 },
+        { 9, 33, 91, 255 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 97, 0, 0, 0 },
+        { 122, 0, 0, 0 }
+    }
+};
+std::size_t const CompressedScanner::ms_skip_set_count_ = sizeof(CompressedScanner::ms_skip_set_table_) / sizeof(*CompressedScanner::ms_skip_set_table_);
+
+std::uint32_t const CompressedScanner::ms_accept_handler_count_ = 56;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const CompressedScanner::ms_accept_handler_is_token_only_[] =
+{
+    false,
+    false,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    false,
+    false,
+    false,
+    true
+};
+CompressedScanner::TokenId const CompressedScanner::ms_accept_handler_token_id_[] =
+{
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const CompressedScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    3,
+    -1,
+    -1,
+    -1,
+    4,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const CompressedScanner::ms_keyword_slot_table_[] =
+{
+    { ">=", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "<=", 2, 3, 40 },
+    { "do", 2, 1, 4 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { ">=", 2, 1, 10 },
+    { "==", 2, 1, 10 },
+    { "<=", 2, 1, 10 },
+    { "for", 3, 1, 7 },
+    { "if", 2, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 4, 47 },
+    { "return", 6, 3, 33 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "do", 2, 3, 34 },
+    { "\x01\x66\x61", 3, 1, 9 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "==", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 3, 32 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 1, 3 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 4, 47 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "while", 5, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 4, 47 },
+    { "", 0, 0, 56 },
+    { "while", 5, 1, 7 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "\x01\x66\x61", 3, 3, 39 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 3, 32 },
+    { "while", 5, 4, 47 },
+    { "", 0, 0, 56 },
+    { "for", 3, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 }
+};
+std::uint16_t const CompressedScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    1,
+    0,
+    3,
+    2,
+    1,
+    3,
+    0
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
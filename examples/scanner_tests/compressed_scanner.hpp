@@ -0,0 +1,1005 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// compressed_scanner.hpp generated by reflex
+// from compressed_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.header.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+// runs of atoms which leave the DFA in the same state are skipped over (and
+// newlines are counted, if the input position is tracked) using SIMD
+// instructions where available.  define REFLEX_CPP_DISABLE_SIMD to use the
+// portable implementation.
+#if !defined(REFLEX_CPP_DISABLE_SIMD) && defined(__GNUC__) && defined(__AVX2__)
+#include <immintrin.h>
+#define REFLEX_CPP_USING_AVX2_
+#elif !defined(REFLEX_CPP_DISABLE_SIMD) && defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#define REFLEX_CPP_USING_SSE2_
+#endif
+
+namespace ReflexCpp_ {
+
+// each apparatus class is guarded separately, so that scanners generated
+// with different interactivity, track_input_position and size_and_speed
+// settings (and, for the table-driven AutomatonApparatus, different DFA table
+// index widths) can be used in the same translation unit.
+
+#if !defined(ReflexCpp_AtomSkipSet_defined_)
+#define ReflexCpp_AtomSkipSet_defined_
+
+// /////////////////////////////////////////////////////////////////////////////
+// a set of input atoms on which a DFA state transitions to itself, so that a
+// run of them can be skipped over at once.  the SIMD implementation of Skip
+// uses the set's ranges (if it can be described by few enough of them), and
+// the portable implementation uses its bitmap.
+// /////////////////////////////////////////////////////////////////////////////
+
+struct AtomSkipSet_
+{
+    // bit atom%8 of m_bitmap[atom/8] is set iff atom is in the set.
+    std::uint8_t m_bitmap[32];
+    // the number of inclusive ranges [m_range_lower[i], m_range_upper[i]]
+    // which give the atoms in the set (or the atoms not in the set, if
+    // m_ranges_are_complement is true).  if this is 0, only m_bitmap is used.
+    std::uint8_t m_range_count;
+    bool m_ranges_are_complement;
+    std::uint8_t m_range_lower[4];
+    std::uint8_t m_range_upper[4];
+
+    bool Contains (std::uint8_t atom) const
+    {
+        return (m_bitmap[atom >> 3] & (1 << (atom & 7))) != 0;
+    }
+    // returns the first position in [begin, end) whose atom is not in the
+    // set, or end if there is none.
+    std::uint8_t const *Skip (std::uint8_t const *begin, std::uint8_t const *end) const
+    {
+        assert(begin <= end);
+        assert(m_range_count <= 4);
+#if defined(REFLEX_CPP_USING_AVX2_)
+        if (m_range_count > 0 && end - begin >= 32)
+        {
+            __m256i lower[4];
+            __m256i width[4];
+            for (std::uint8_t r = 0; r < m_range_count; ++r)
+            {
+                lower[r] = _mm256_set1_epi8(char(m_range_lower[r]));
+                width[r] = _mm256_set1_epi8(char(m_range_upper[r] - m_range_lower[r]));
+            }
+            do
+            {
+                __m256i atoms = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(begin));
+                // an atom is in a range iff its (unsigned, wrapped-around)
+                // offset from the range's lower bound is at most its width.
+                __m256i in_ranges = _mm256_setzero_si256();
+                for (std::uint8_t r = 0; r < m_range_count; ++r)
+                {
+                    __m256i offset = _mm256_sub_epi8(atoms, lower[r]);
+                    in_ranges = _mm256_or_si256(in_ranges, _mm256_cmpeq_epi8(_mm256_min_epu8(offset, width[r]), offset));
+                }
+                std::uint32_t stop_mask = std::uint32_t(_mm256_movemask_epi8(in_ranges));
+                if (!m_ranges_are_complement)
+                    stop_mask = ~stop_mask;
+                if (stop_mask != 0)
+                    return begin + __builtin_ctz(stop_mask);
+                begin += 32;
+            }
+            while (end - begin >= 32);
+        }
+#elif defined(REFLEX_CPP_USING_SSE2_)
+        if (m_range_count > 0 && end - begin >= 16)
+        {
+            __m128i lower[4];
+            __m128i width[4];
+            for (std::uint8_t r = 0; r < m_range_count; ++r)
+            {
+                lower[r] = _mm_set1_epi8(char(m_range_lower[r]));
+                width[r] = _mm_set1_epi8(char(m_range_upper[r] - m_range_lower[r]));
+            }
+            do
+            {
+                __m128i atoms = _mm_loadu_si128(reinterpret_cast<__m128i const *>(begin));
+                // an atom is in a range iff its (unsigned, wrapped-around)
+                // offset from the range's lower bound is at most its width.
+                __m128i in_ranges = _mm_setzero_si128();
+                for (std::uint8_t r = 0; r < m_range_count; ++r)
+                {
+                    __m128i offset = _mm_sub_epi8(atoms, lower[r]);
+                    in_ranges = _mm_or_si128(in_ranges, _mm_cmpeq_epi8(_mm_min_epu8(offset, width[r]), offset));
+                }
+                std::uint32_t stop_mask = std::uint32_t(_mm_movemask_epi8(in_ranges));
+                if (!m_ranges_are_complement)
+                    stop_mask = ~stop_mask & 0xFFFF;
+                if (stop_mask != 0)
+                    return begin + __builtin_ctz(stop_mask);
+                begin += 16;
+            }
+            while (end - begin >= 16);
+        }
+#endif
+        while (begin != end && Contains(*begin))
+            ++begin;
+        return begin;
+    }
+}; // end of struct ReflexCpp_::AtomSkipSet_
+
+// the skip set tables are aggregate-initialized from constants, which is only
+// guaranteed to be static (not dynamic, and therefore not racy) initialization
+// for trivial standard-layout types.
+static_assert(std::is_trivial<AtomSkipSet_>::value && std::is_standard_layout<AtomSkipSet_>::value, "AtomSkipSet_ must be constant-initializable");
+
+#endif // !defined(ReflexCpp_AtomSkipSet_defined_)
+
+#if !defined(ReflexCpp_KeywordTable_defined_)
+#define ReflexCpp_KeywordTable_defined_
+
+// /////////////////////////////////////////////////////////////////////////////
+// a slot in the perfect hash table of keywords -- the literal strings of rules
+// which reflex left out of the DFA because later rules (e.g. an identifier
+// rule) match them too.  the strings accepted by those later rules are looked
+// up in the table to recover the keyword's (higher-priority) accept handler.
+// an unused slot has an empty keyword.
+// /////////////////////////////////////////////////////////////////////////////
+
+struct KeywordSlot_
+{
+    char const *m_keyword;
+    std::uint32_t m_length;
+    std::uint32_t m_state_machine;
+    std::uint32_t m_accept_handler_index;
+}; // end of struct ReflexCpp_::KeywordSlot_
+
+// the keyword tables are aggregate-initialized from constants, which is only
+// guaranteed to be static (not dynamic, and therefore not racy) initialization
+// for trivial standard-layout types.
+static_assert(std::is_trivial<KeywordSlot_>::value && std::is_standard_layout<KeywordSlot_>::value, "KeywordSlot_ must be constant-initializable");
+
+// the keyword hash of the string [begin, end) in the given state machine.
+// this must be kept in sync with Reflex::KeywordHash in reflex_automaton.cpp.
+inline std::uint64_t KeywordHash_ (std::uint32_t seed, std::uint32_t state_machine, std::uint8_t const *begin, std::uint8_t const *end)
+{
+    std::uint64_t hash = 14695981039346656037ull ^ seed;
+    for (std::uint32_t i = 0; i < 4; ++i)
+        hash = (hash ^ ((state_machine >> (8*i)) & 0xFF)) * 1099511628211ull;
+    for ( ; begin != end; ++begin)
+        hash = (hash ^ *begin) * 1099511628211ull;
+    hash ^= hash >> 32;
+    hash *= 0xD6E8FEB86659FD93ull;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+#endif // !defined(ReflexCpp_KeywordTable_defined_)
+
+#if !defined(ReflexCpp_InputApparatus_InMemory_defined_)
+#define ReflexCpp_InputApparatus_InMemory_defined_
+
+// /////////////////////////////////////////////////////////////////////////////
+// implements the InputApparatus interface as described in the documentation
+// /////////////////////////////////////////////////////////////////////////////
+
+class InputApparatus_InMemory_
+{
+protected:
+
+    InputApparatus_InMemory_ ()
+        :
+        m_input_begin(NULL),
+        m_input_end(NULL)
+    {
+        // subclasses must call InputApparatus_InMemory_::ResetForNewInput_ in their constructors.
+    }
+
+    bool IsAtEndOfInput () { return IsConditionalMet(CF_END_OF_INPUT, CF_END_OF_INPUT); }
+
+    // the input is scanned in place (without being copied), so the range
+    // [begin, end) must remain valid and unmodified until the scanning is
+    // done.  scanning starts over from begin.  end of input is indicated
+    // by reaching end, so the range may contain '\0' chars.
+    void InputSpan (char const *begin, char const *end)
+    {
+        assert(begin <= end);
+        // the cursors must not be NULL (the accept cursor uses NULL to
+        // indicate that it is unset), so substitute an empty string.
+        if (begin == NULL)
+        {
+            assert(end == NULL);
+            begin = end = "";
+        }
+        m_input_begin = reinterpret_cast<std::uint8_t const *>(begin);
+        m_input_end = reinterpret_cast<std::uint8_t const *>(end);
+        m_token_start = m_input_begin;
+        m_start_cursor = m_input_begin;
+        m_read_cursor = m_input_begin;
+        m_kept_string_cursor = m_input_begin;
+        m_kept_string_length = 0;
+        m_accept_cursor = NULL;
+        m_keep_string_has_been_called = false;
+    }
+    char const *InputSpanBegin () const { return reinterpret_cast<char const *>(m_input_begin); }
+    char const *InputSpanEnd () const { return reinterpret_cast<char const *>(m_input_end); }
+
+    void KeepString ()
+    {
+        assert(m_accept_cursor != NULL && "may only KeepString within accept or reject handler code");
+        // reset the start cursor, so that the entire accepted string is
+        // "put back in the already-read buffer", but we'll keep reading
+        // from the same read cursor.
+        m_start_cursor = m_token_start;
+        // save the accepted string's end position at the time of KeepString
+        m_kept_string_cursor = m_accept_cursor;
+        // leave the accept cursor to be reset in the next loop
+    }
+    void Unaccept (std::uint32_t unaccept_char_count)
+    {
+        assert(m_accept_cursor != NULL && "may only Unaccept within accept handler code");
+        UnacceptUnrejectCommon(unaccept_char_count);
+    }
+    void Unreject (std::uint32_t unreject_char_count)
+    {
+        assert(m_accept_cursor == m_start_cursor && "may only Unreject within accept handler code");
+        UnacceptUnrejectCommon(unreject_char_count);
+    }
+
+    // the scan position recorded by TakeInputCheckpoint_.  the cursors are
+    // stored as offsets from the beginning of the input.
+    struct InputCheckpoint
+    {
+        std::size_t m_token_start_offset;
+        std::size_t m_start_cursor_offset;
+        std::size_t m_read_cursor_offset;
+        std::size_t m_kept_string_cursor_offset;
+        // NO_OFFSET indicates that the accept cursor was NULL
+        std::size_t m_accept_cursor_offset;
+        bool m_keep_string_has_been_called;
+
+        enum { NO_OFFSET = ~std::size_t(0) };
+    }; // end of struct ReflexCpp_::InputApparatus_InMemory_::InputCheckpoint
+
+    // records the scan position, which may only be done between scans (not
+    // from handler code).  the previous atom (which the conditional flags
+    // depend on) and everything after it stays in the buffer until the
+    // checkpoint is passed to ReleaseInputCheckpoint_.
+    InputCheckpoint TakeInputCheckpoint_ ()
+    {
+        InputCheckpoint checkpoint;
+        checkpoint.m_token_start_offset = CursorOffset(m_token_start);
+        checkpoint.m_start_cursor_offset = CursorOffset(m_start_cursor);
+        checkpoint.m_read_cursor_offset = CursorOffset(m_read_cursor);
+        checkpoint.m_kept_string_cursor_offset = CursorOffset(m_kept_string_cursor);
+        checkpoint.m_accept_cursor_offset = m_accept_cursor != NULL ? CursorOffset(m_accept_cursor) : std::size_t(InputCheckpoint::NO_OFFSET);
+        checkpoint.m_keep_string_has_been_called = m_keep_string_has_been_called;
+        return checkpoint;
+    }
+    // returns to the scan position recorded by TakeInputCheckpoint_.  the
+    // checkpoint must not have been released.
+    void RestoreInputCheckpoint_ (InputCheckpoint const &checkpoint)
+    {
+        m_token_start = CursorAt(checkpoint.m_token_start_offset);
+        m_start_cursor = CursorAt(checkpoint.m_start_cursor_offset);
+        m_read_cursor = CursorAt(checkpoint.m_read_cursor_offset);
+        m_kept_string_cursor = CursorAt(checkpoint.m_kept_string_cursor_offset);
+        m_accept_cursor = checkpoint.m_accept_cursor_offset != std::size_t(InputCheckpoint::NO_OFFSET) ? CursorAt(checkpoint.m_accept_cursor_offset) : NULL;
+        m_keep_string_has_been_called = checkpoint.m_keep_string_has_been_called;
+    }
+    // unpins the buffered input kept for the checkpoint.  each checkpoint
+    // must be released exactly once, but not necessarily in order.
+    void ReleaseInputCheckpoint_ (InputCheckpoint const &checkpoint)
+    {
+        // the input span is not owned, so nothing is pinned.
+        static_cast<void>(checkpoint);
+    }
+
+    void PrepareToScan_ ()
+    {
+        assert(m_start_cursor <= m_read_cursor);
+        // the next string starts at the start cursor.  if KeepString was
+        // called, this does nothing, since in that case, m_start_cursor will
+        // be m_token_start;  if Unaccept was called, it should have
+        // postcondition m_read_cursor == m_start_cursor.  the consumed atoms
+        // before the new m_token_start are left in the buffer, and are only
+        // discarded (in bulk) when FillBuffer next needs to make room.
+        m_token_start = m_start_cursor;
+        // reset the accept cursor
+        m_accept_cursor = NULL;
+        m_keep_string_has_been_called = false;
+        assert(m_kept_string_cursor >= m_start_cursor);
+        // this is an offset, since FillBuffer may move the buffer.
+        m_kept_string_length = m_kept_string_cursor - m_token_start;
+    }
+    void ResetForNewInput_ ()
+    {
+        InputSpan(NULL, NULL);
+    }
+
+    // for use in AutomatonApparatus_Compressed_InMemory_S8_T16_A8_ only
+    std::uint8_t CurrentConditionalFlags_ (std::uint8_t conditional_mask)
+    {
+        return ConditionalFlags(conditional_mask);
+    }
+    std::uint8_t InputAtom_ ()
+    {
+        assert(m_read_cursor >= m_token_start);
+        assert(m_read_cursor <= m_input_end);
+        // there are no transitions on '\0', so it serves to halt the DFA at
+        // the end of input.
+        return m_read_cursor < m_input_end ? *m_read_cursor : '\0';
+    }
+    void AdvanceReadCursor_ ()
+    {
+        assert(m_start_cursor == m_token_start);
+        assert(m_read_cursor >= m_token_start);
+        assert(m_read_cursor <= m_input_end);
+        if (m_read_cursor < m_input_end)
+            ++m_read_cursor;
+    }
+    // advances the read cursor past the run of atoms in skip_set, as if by
+    // calling AdvanceReadCursor_ once for each of them.
+    void AdvanceReadCursorPast_ (AtomSkipSet_ const &skip_set)
+    {
+        assert(m_start_cursor == m_token_start);
+        assert(m_read_cursor >= m_token_start);
+        assert(m_read_cursor <= m_input_end);
+        m_read_cursor = skip_set.Skip(m_read_cursor, m_input_end);
+    }
+    void SetAcceptCursor_ ()
+    {
+        assert(m_start_cursor == m_token_start);
+        assert(m_read_cursor >= m_token_start);
+        assert(m_read_cursor <= m_input_end);
+        m_accept_cursor = m_read_cursor;
+    }
+    void Accept_ ()
+    {
+        assert(m_accept_cursor != NULL && "can't Accept_ if the accept cursor is not set");
+        assert(m_accept_cursor <= m_read_cursor);
+        AcceptRejectCommon();
+    }
+    void Reject_ ()
+    {
+        assert(m_accept_cursor == NULL && "can't Reject_ if the accept cursor was set");
+        // must set the accept cursor to indicate the rejected string
+        // (which is the kept string plus the rejected atom)
+        m_accept_cursor = m_kept_string_cursor;
+        if (m_accept_cursor < m_input_end)
+            ++m_accept_cursor;
+        AcceptRejectCommon();
+    }
+
+    // for use in the scanner subclass only -- these indicate the string most
+    // recently accepted/rejected by RunDfa_, and must be retrieved before
+    // the accept/reject handler code is executed.
+    std::uint8_t const *AcceptedStringBegin_ () const
+    {
+        assert(m_accept_cursor != NULL);
+        return m_token_start;
+    }
+    std::uint8_t const *AcceptedStringEnd_ () const
+    {
+        assert(m_accept_cursor != NULL);
+        return m_accept_cursor;
+    }
+    // the beginning of the part of the accepted string which was scanned by
+    // the most recent RunDfa_ (i.e. the accepted string without the kept
+    // string it started with, if any).
+    std::uint8_t const *ScannedStringBegin_ () const
+    {
+        assert(m_accept_cursor != NULL);
+        return m_token_start + m_kept_string_length;
+    }
+    // returns the offset (from the beginning of the input) of position,
+    // which must be between the previous atom and the read cursor.
+    std::size_t InputOffset_ (std::uint8_t const *position) const
+    {
+        assert(position >= m_input_begin && position <= m_input_end);
+        return position - m_input_begin;
+    }
+    // returns true iff the next scan starts with a string kept by KeepString.
+    bool HasKeptString_ () const
+    {
+        return m_kept_string_cursor != m_start_cursor;
+    }
+    // undoes the Accept_ or Reject_ done by the most recent RunDfa_, so that
+    // the next scan starts over from the same place.  this may not be used if
+    // the scan started with a kept string (see HasKeptString_).
+    void Unscan_ ()
+    {
+        assert(m_accept_cursor != NULL && "can only Unscan_ after RunDfa_");
+        assert(!m_keep_string_has_been_called);
+        m_start_cursor = m_token_start;
+        m_read_cursor = m_token_start;
+        m_kept_string_cursor = m_token_start;
+        m_accept_cursor = NULL;
+    }
+    // returns the offset (from the beginning of the input span) at which the
+    // next scan starts.
+    std::size_t ScanOffset_ () const
+    {
+        return m_start_cursor - m_input_begin;
+    }
+    // moves the scan position to offset (discarding any kept string), as if
+    // the input before it had been scanned.
+    void SeekTo_ (std::size_t offset)
+    {
+        assert(offset <= std::size_t(m_input_end - m_input_begin));
+        m_token_start = m_input_begin + offset;
+        m_start_cursor = m_token_start;
+        m_read_cursor = m_token_start;
+        m_kept_string_cursor = m_token_start;
+        m_kept_string_length = 0;
+        m_accept_cursor = NULL;
+        m_keep_string_has_been_called = false;
+    }
+
+private:
+
+    // the cursors point into the input span, which is not owned, so copying
+    // would be of dubious value.
+    InputApparatus_InMemory_ (InputApparatus_InMemory_ const &);
+    void operator = (InputApparatus_InMemory_ const &);
+
+    // converts between cursors and the offsets used by InputCheckpoint.
+    std::size_t CursorOffset (std::uint8_t const *cursor) const
+    {
+        assert(cursor >= m_input_begin && cursor <= m_input_end);
+        return cursor - m_input_begin;
+    }
+    std::uint8_t const *CursorAt (std::size_t offset) const
+    {
+        assert(offset <= std::size_t(m_input_end - m_input_begin));
+        return m_input_begin + offset;
+    }
+    void UnacceptUnrejectCommon (std::uint32_t char_count)
+    {
+        assert(!m_keep_string_has_been_called && "may only Unaccept/Unreject before KeepString");
+        assert(char_count <= std::size_t(m_start_cursor - m_token_start) && "can't Unaccept/Unreject more characters than were rejected");
+        if (char_count == 0)
+            return; // nothing to do
+        // update the cursors
+        m_start_cursor -= char_count;
+        m_read_cursor = m_start_cursor;
+        m_kept_string_cursor = m_start_cursor;
+        m_accept_cursor -= char_count;
+    }
+    void AcceptRejectCommon ()
+    {
+        assert(m_start_cursor == m_token_start);
+        // the accept cursor indicates the end of the string to accept/reject
+        assert(m_accept_cursor != NULL && m_accept_cursor >= m_token_start && m_accept_cursor <= m_input_end);
+        // the accepted/rejected string is the range [m_token_start,m_accept_cursor)
+        // of the input span.
+        // the next scan starts at the end of the string (the last atom in
+        // the string becomes the previous atom)
+        m_start_cursor = m_accept_cursor;
+        // reset the other cursors
+        m_read_cursor = m_accept_cursor;
+        m_kept_string_cursor = m_accept_cursor;
+    }
+
+    enum ConditionalFlag
+    {
+        CF_BEGINNING_OF_INPUT = (1 << 0),
+        CF_END_OF_INPUT       = (1 << 1),
+        CF_BEGINNING_OF_LINE  = (1 << 2),
+        CF_END_OF_LINE        = (1 << 3),
+        CF_WORD_BOUNDARY      = (1 << 4)
+    }; // end of enum ReflexCpp_::InputApparatus_InMemory_::ConditionalFlag
+
+    bool IsConditionalMet (std::uint8_t conditional_mask, std::uint8_t conditional_flags)
+    {
+        // return true iff no bits indicated by conditional_mask differ between
+        // conditional_flags and the current conditional flags.
+        return ((conditional_flags ^ ConditionalFlags(conditional_mask)) & conditional_mask) == 0;
+    }
+    // given the atoms surrounding the read cursor, calculates the conditional
+    // flags indicated by conditional_mask; the others are returned as 0.
+    std::uint8_t ConditionalFlags (std::uint8_t conditional_mask)
+    {
+        assert(m_read_cursor >= m_input_begin);
+        assert(m_read_cursor <= m_input_end);
+        // the beginning and end of the input span are indicated by position,
+        // not by '\0' atoms, and are treated as non-word atoms.
+        bool is_at_beginning_of_input = m_read_cursor == m_input_begin;
+        bool is_at_end_of_input = m_read_cursor == m_input_end;
+        std::uint8_t conditional_flags = 0;
+        if (is_at_beginning_of_input)                                     conditional_flags |= CF_BEGINNING_OF_INPUT;
+        if (is_at_end_of_input)                                           conditional_flags |= CF_END_OF_INPUT;
+        if (is_at_beginning_of_input || m_read_cursor[-1] == '\n')        conditional_flags |= CF_BEGINNING_OF_LINE;
+        if (is_at_end_of_input || m_read_cursor[0] == '\n')               conditional_flags |= CF_END_OF_LINE;
+        if ((!is_at_beginning_of_input && IsWordChar(m_read_cursor[-1])) !=
+            (!is_at_end_of_input && IsWordChar(m_read_cursor[0])))        conditional_flags |= CF_WORD_BOUNDARY;
+        return conditional_flags & conditional_mask;
+    }
+    static bool IsWordChar (std::uint8_t c)
+    {
+        // the return value should be
+        // (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_'
+        static std::uint8_t const s_is_word_char_table[256] =
+        {
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            1, 1, 1, 1, 1, 1, 1, 1,     1, 1, 0, 0, 0, 0, 0, 0, // '0' through '9'
+            0, 1, 1, 1, 1, 1, 1, 1,     1, 1, 1, 1, 1, 1, 1, 1, // 'A' through 'O'
+            1, 1, 1, 1, 1, 1, 1, 1,     1, 1, 1, 0, 0, 0, 0, 1, // 'P' through 'Z', then '_'
+            0, 1, 1, 1, 1, 1, 1, 1,     1, 1, 1, 1, 1, 1, 1, 1, // 'a' through 'o'
+            1, 1, 1, 1, 1, 1, 1, 1,     1, 1, 1, 0, 0, 0, 0, 0, // 'p' through 'z'
+
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0,     0, 0, 0, 0, 0, 0, 0, 0,
+        };
+        return s_is_word_char_table[c] != 0;
+    }
+
+    // indicates the beginning of the (caller-owned) input span
+    std::uint8_t const *m_input_begin;
+    // indicates the end of the input span
+    std::uint8_t const *m_input_end;
+    // indicates the first atom of the string currently being scanned
+    std::uint8_t const *m_token_start;
+    // indicates where the next scan will start (the first atom of the kept string)
+    std::uint8_t const *m_start_cursor;
+    // indicates how far the scanner has read
+    std::uint8_t const *m_read_cursor;
+    // indicates the end of the kept string
+    std::uint8_t const *m_kept_string_cursor;
+    // if not NULL, indicates the end of the most recent, longest accepted string
+    std::uint8_t const *m_accept_cursor;
+    // the length of the kept string the current scan started with
+    std::size_t m_kept_string_length;
+    // indicates if KeepString has been called during the accept/reject handler
+    bool m_keep_string_has_been_called;
+}; // end of class ReflexCpp_::InputApparatus_InMemory_
+
+#endif // !defined(ReflexCpp_InputApparatus_InMemory_defined_)
+
+#if !defined(ReflexCpp_AutomatonApparatus_Compressed_InMemory_S8_T16_A8_defined_)
+#define ReflexCpp_AutomatonApparatus_Compressed_InMemory_S8_T16_A8_defined_
+
+// /////////////////////////////////////////////////////////////////////////////
+// implements the AutomatonApparatus interface as described in the documentation
+// -- it contains all the generalized state machinery for running a reflex DFA.
+// /////////////////////////////////////////////////////////////////////////////
+
+class AutomatonApparatus_Compressed_InMemory_S8_T16_A8_ : protected InputApparatus_InMemory_
+{
+protected:
+
+    // state machine mode flags
+    enum
+    {
+        MF_CASE_INSENSITIVE_ = (1 << 0),
+        MF_UNGREEDY_         = (1 << 1)
+    };
+
+    // the narrowest integer types which can hold each kind of index used
+    // in the DFA tables, including the sentinel values -- the state count
+    // (indicating no state), the transition table size and the accept
+    // handler count (indicating no accept handler).
+    typedef std::uint8_t DfaStateIndex_;
+    typedef std::uint16_t DfaTransitionIndex_;
+    typedef std::uint8_t AcceptHandlerIndex_;
+
+    // the fields are ordered so as to minimize padding.
+    struct DfaState_
+    {
+        DfaTransitionIndex_ m_transition_base;
+        DfaStateIndex_ m_default_dfa_state_offset;
+        AcceptHandlerIndex_ m_accept_handler_index;
+        // the mask of the conditional flags tested by this state's transitions
+        // (which are then CONDITIONAL), or 0 if its transitions are INPUT_ATOM.
+        std::uint8_t m_conditional_mask;
+        // index into the skip set table, or 0 if this state has no skip set.
+        std::uint8_t m_skip_set_index;
+    }; // end of struct ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::DfaState_
+    struct DfaTransition_
+    {
+        enum Type
+        {
+            INPUT_ATOM = 0, INPUT_ATOM_RANGE, CONDITIONAL
+        }; // end of enum ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::DfaTransition_::Type
+
+        DfaStateIndex_ m_target_dfa_state_offset;
+        DfaStateIndex_ m_owner_dfa_state_offset;
+    }; // end of struct ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::DfaTransition_
+
+    static_assert(std::is_trivial<DfaState_>::value && std::is_standard_layout<DfaState_>::value, "DfaState_ must be constant-initializable");
+    static_assert(std::is_trivial<DfaTransition_>::value && std::is_standard_layout<DfaTransition_>::value, "DfaTransition_ must be constant-initializable");
+
+    AutomatonApparatus_Compressed_InMemory_S8_T16_A8_ (
+        DfaState_ const *state_table,
+        std::size_t state_count,
+        DfaTransition_ const *transition_table,
+        std::size_t transition_count,
+        std::uint8_t const *atom_class_table,
+        AtomSkipSet_ const *skip_set_table,
+        std::size_t skip_set_count,
+        std::uint32_t accept_handler_count)
+        :
+        InputApparatus_InMemory_(),
+        m_accept_handler_count(accept_handler_count),
+        m_state_table(state_table),
+        m_state_count(state_count),
+        m_transition_table(transition_table),
+        m_atom_class_table(atom_class_table),
+        m_skip_set_table(skip_set_table)
+    {
+        CheckDfa(state_table, state_count, transition_table, transition_count, atom_class_table, skip_set_table, skip_set_count);
+        // subclasses must call ReflexCpp_::InputApparatus_InMemory_::ResetForNewInput_ in their constructors.
+    }
+
+    DfaState_ const *InitialState_ () const
+    {
+        return m_initial_state;
+    }
+    void InitialState_ (DfaState_ const *initial_state)
+    {
+        assert(initial_state != NULL);
+        m_initial_state = initial_state;
+    }
+    void ModeFlags_ (std::uint8_t mode_flags)
+    {
+        m_mode_flags = mode_flags;
+    }
+    void ResetForNewInput_ (DfaState_ const *initial_state, std::uint8_t mode_flags)
+    {
+        InputApparatus_InMemory_::ResetForNewInput_();
+        if (initial_state != NULL)
+            InitialState_(initial_state);
+        m_current_state = NULL;
+        m_accept_state = NULL;
+        m_mode_flags = mode_flags;
+    }
+    std::uint32_t RunDfa_ ()
+    {
+        // reset the current state to the initial state.
+        assert(m_initial_state != NULL);
+        m_current_state = m_initial_state;
+        assert(m_accept_state == NULL);
+        // loop until there are no valid transitions from the current state.
+        while (m_current_state != NULL)
+        {
+            // if the current state transitions to itself on a set of atoms,
+            // advance past any run of them at once, since doing so doesn't
+            // change the current state.
+            if (m_current_state->m_skip_set_index != 0)
+                AdvanceReadCursorPast_(m_skip_set_table[m_current_state->m_skip_set_index]);
+            // if the current state is an accept state, save it
+            if (IsAcceptState(m_current_state))
+            {
+                m_accept_state = m_current_state;
+                SetAcceptCursor_();
+                // if we're in ungreedy mode, accept the shortest string
+                // possible; don't process any more input.
+                if ((m_mode_flags & MF_UNGREEDY_) != 0)
+                {
+                    assert(m_accept_state != NULL);
+                    m_current_state = NULL;
+                    break;
+                }
+            }
+            // turn the crank on the state machine, exercising the appropriate
+            // conditional (using the conditional flags at the read cursor) or atomic
+            // transition (using the atom at the read cursor in the buffer).
+            // m_current_state will be set to the transitioned-to state, or
+            // NULL if no transition was possible.
+            m_current_state = ProcessInputAtom();
+        }
+        // if we have a most recent accept state, accept the accumulated input
+        // using the accept handler indicated by the most recent accept state.
+        if (m_accept_state != NULL)
+        {
+            // delimit the accepted string in the buffer
+            Accept_();
+            // save off the accept handler index
+            std::uint32_t accept_handler_index = m_accept_state->m_accept_handler_index;
+            // clear the accept state for next time
+            m_accept_state = NULL;
+            // return accept_handler_index to indicate which handler to call
+            return accept_handler_index;
+        }
+        // otherwise the input atom went unhandled; delimit the rejected string.
+        else
+        {
+            // delimit the rejected string in the buffer and indicate that no
+            // accept handler should be called.
+            Reject_();
+            return m_accept_handler_count;
+        }
+    }
+
+private:
+
+    // these InputApparatus_InMemory_ methods should not be accessable to CompressedScanner
+    using InputApparatus_InMemory_::CurrentConditionalFlags_;
+    using InputApparatus_InMemory_::InputAtom_;
+    using InputApparatus_InMemory_::AdvanceReadCursor_;
+    using InputApparatus_InMemory_::AdvanceReadCursorPast_;
+    using InputApparatus_InMemory_::SetAcceptCursor_;
+    using InputApparatus_InMemory_::Accept_;
+    using InputApparatus_InMemory_::Reject_;
+
+    DfaState_ const *ProcessInputAtom ()
+    {
+        assert(m_current_state != NULL);
+        std::uint32_t value;
+        if (m_current_state->m_conditional_mask != 0)
+            value = CurrentConditionalFlags_(m_current_state->m_conditional_mask);
+        else
+            value = m_atom_class_table[InputAtom_()];
+        // look up the transition for value in the current state's lookup table,
+        // falling back to the lookup tables of its chain of default states for
+        // the transitions it doesn't own.
+        std::uint32_t dfa_state_offset = static_cast<std::uint32_t>(m_current_state - m_state_table);
+        while (m_transition_table[m_state_table[dfa_state_offset].m_transition_base + value].m_owner_dfa_state_offset != dfa_state_offset)
+        {
+            dfa_state_offset = m_state_table[dfa_state_offset].m_default_dfa_state_offset;
+            // if there is no default state, no transition was possible.
+            if (dfa_state_offset == m_state_count)
+                return NULL;
+        }
+        std::uint32_t target_dfa_state_offset = m_transition_table[m_state_table[dfa_state_offset].m_transition_base + value].m_target_dfa_state_offset;
+        if (target_dfa_state_offset == m_state_count)
+            return NULL;
+        // only advance the read cursor if input was actually eaten
+        if (m_current_state->m_conditional_mask == 0)
+            AdvanceReadCursor_();
+        return m_state_table + target_dfa_state_offset;
+    }
+    bool IsAcceptState (DfaState_ const *state) const
+    {
+        assert(state != NULL);
+        return state->m_accept_handler_index < m_accept_handler_count;
+    }
+    static void CheckDfa (
+        DfaState_ const *state_table,
+        std::size_t state_count,
+        DfaTransition_ const *transition_table,
+        std::size_t transition_count,
+        std::uint8_t const *atom_class_table,
+        AtomSkipSet_ const *skip_set_table,
+        std::size_t skip_set_count)
+    {
+        // if any assertions in this method fail, the state and/or
+        // transition tables were created incorrectly.
+        assert(state_table != NULL && "must have a state table");
+        assert(state_count > 0 && "must have at least one state");
+        assert(transition_table != NULL && "must have a transition table");
+        assert(skip_set_table != NULL && "must have a skip set table");
+        for (DfaState_ const *s = state_table, *s_end = state_table + state_count;
+             s != s_end;
+             ++s)
+        {
+            assert(s->m_skip_set_index < skip_set_count &&
+                   "skip set index out of range (does not point to a valid skip set)");
+        }
+        for (std::size_t i = 1; i < skip_set_count; ++i)
+        {
+            assert(!skip_set_table[i].Contains('\0') &&
+                   "'\\0' may not be in a skip set, since it marks the end of input");
+            assert(skip_set_table[i].m_range_count <= 4 &&
+                   "a skip set may not have more than 4 ranges");
+        }
+        assert(atom_class_table != NULL && "must have an atom class table");
+        std::size_t atom_class_count = 0;
+        for (std::size_t i = 0; i < 256; ++i)
+            if (atom_class_table[i] >= atom_class_count)
+                atom_class_count = atom_class_table[i] + 1;
+        for (DfaState_ const *s = state_table, *s_end = state_table + state_count;
+             s != s_end;
+             ++s)
+        {
+            assert(s->m_conditional_mask < 32 &&
+                   "a conditional mask may only contain the 5 conditional flags");
+            // a CONDITIONAL state's lookup table has an element for each of the
+            // 32 combinations of the 5 conditional flags.
+            assert(s->m_transition_base + (s->m_conditional_mask == 0 ? atom_class_count : 32) <= transition_count &&
+                   "a state's lookup table must be within the transition table");
+            assert(s->m_default_dfa_state_offset <= state_count &&
+                   "default state out of range (highest acceptable value is state count)");
+            assert((s->m_default_dfa_state_offset == state_count ||
+                    (state_table[s->m_default_dfa_state_offset].m_conditional_mask == 0) == (s->m_conditional_mask == 0)) &&
+                   "a state's default state must have the same transition type");
+        }
+        for (DfaTransition_ const *t = transition_table,
+                                  *t_end = transition_table + transition_count;
+             t != t_end;
+             ++t)
+        {
+            assert(t->m_target_dfa_state_offset <= state_count &&
+                   "transition target state out of range (highest acceptable value is state count)");
+            assert(t->m_owner_dfa_state_offset <= state_count &&
+                   "transition owner state out of range (highest acceptable value is state count)");
+        }
+    }
+
+    std::uint32_t const m_accept_handler_count;
+    DfaState_ const *const m_state_table;
+    std::size_t const m_state_count;
+    DfaTransition_ const *const m_transition_table;
+    std::uint8_t const *const m_atom_class_table;
+    AtomSkipSet_ const *const m_skip_set_table;
+    DfaState_ const *m_initial_state;
+    DfaState_ const *m_current_state;
+    DfaState_ const *m_accept_state;
+    std::uint8_t m_mode_flags;
+}; // end of class ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_
+
+#endif // !defined(ReflexCpp_AutomatonApparatus_Compressed_InMemory_S8_T16_A8_defined_)
+
+} // end of namespace ReflexCpp_
+
+
+#line 18 "compressed_scanner.reflex"
+
+#pragma once
+
+#include <string>
+
+#include "scanner_tests.hpp"
+
+#line 854 "compressed_scanner.hpp"
+
+class CompressedScanner : private ReflexCpp_::AutomatonApparatus_Compressed_InMemory_S8_T16_A8_
+{
+public:
+
+    struct StateMachine
+    {
+        enum Name
+        {
+            BLOCK_COMMENT,
+            KEYWORDS,
+            KEYWORDS_CASE_INSENSITIVE,
+            KEYWORDS_UNGREEDY,
+            MAIN,
+            // default starting state machine
+            START_ = MAIN
+        }; // end of enum CompressedScanner::StateMachine::Name
+    }; // end of struct CompressedScanner::StateMachine
+
+    // the type of the token ids given by %target.cpp.token_id
+    typedef Token::Type TokenId;
+
+    // a scan position and state machine recorded by Checkpoint (its contents
+    // are internal)
+    struct ScannerCheckpoint
+    {
+        InputApparatus_InMemory_::InputCheckpoint m_input;
+        StateMachine::Name m_state_machine;
+    }; // end of struct CompressedScanner::ScannerCheckpoint
+
+
+#line 26 "compressed_scanner.reflex"
+
+    // the string accepted (or rejected) by the most recent call to Scan, if
+    // it was handled by rule handler code (token-only rules leave it empty).
+    std::string m_text;
+
+    // records the string accepted by a rule of the KEYWORDS* state machines,
+    // prefixed by the name of the rule, since several of their rules accept
+    // the same strings.
+    Token::Type Keyword (char const *rule_name, char const *data, std::size_t length)
+    {
+        m_text.assign(rule_name);
+        m_text += ':';
+        m_text.append(data, length);
+        return Token::KEYWORD;
+    }
+
+#line 903 "compressed_scanner.hpp"
+
+public:
+
+    CompressedScanner ();
+    ~CompressedScanner ();
+
+    /// Returns the currently active state machine.
+    StateMachine::Name CurrentStateMachine () const;
+    /// Switches the current state machine to the specified one.
+    void SwitchToStateMachine (StateMachine::Name state_machine);
+
+    using AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::IsAtEndOfInput;
+    using AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::InputSpan;
+    using AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::InputSpanBegin;
+    using AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::InputSpanEnd;
+
+    /// Records the current scan position (including what the conditional
+    /// flags such as ^ and \b depend on) and the current state machine, so
+    /// that Restore can later return to them -- e.g. to scan ahead
+    /// speculatively and then rewind -- without copying the input.  The input
+    /// from the checkpoint on stays in the buffer until ReleaseCheckpoint is
+    /// called, so checkpoints should be released promptly.  May only be
+    /// called between scans (not from handler code).
+    ScannerCheckpoint Checkpoint ();
+    /// Returns to the scan position and state machine recorded by checkpoint,
+    /// which must not have been released.  Checkpoints are invalidated by
+    /// ResetForNewInput and InputSpan.  May only be called between scans.
+    void Restore (ScannerCheckpoint const &checkpoint);
+    /// Allows the input buffered for checkpoint to be discarded.  Each
+    /// checkpoint must be released exactly once, in any order.
+    void ReleaseCheckpoint (ScannerCheckpoint const &checkpoint);
+
+    void ResetForNewInput ();
+
+    /// Scans consecutive tokens matched by token-only rules (those whose rule
+    /// handler is %target.cpp.token_id), without executing any handler code.
+    /// The token id, input offset and length of each token are stored in the
+    /// corresponding elements of token_ids, token_offsets and token_lengths.
+    /// Stops when token_capacity tokens have been stored, or just before input
+    /// which Scan must handle instead -- a token matched by a rule with
+    /// handler code, an empty token, rejected input or the end of input.
+    /// Returns the number of tokens stored, so a return value less than
+    /// token_capacity indicates that Scan should be called next.
+    std::size_t ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw();
+
+    Token::Type Scan () throw();
+
+private:
+
+    using InputApparatus_InMemory_::KeepString;
+    using InputApparatus_InMemory_::Unaccept;
+    using InputApparatus_InMemory_::Unreject;
+
+    // ///////////////////////////////////////////////////////////////////////
+    // begin internal reflex-generated parser guts -- don't use
+    // ///////////////////////////////////////////////////////////////////////
+
+    using InputApparatus_InMemory_::PrepareToScan_;
+    using InputApparatus_InMemory_::ResetForNewInput_;
+    using InputApparatus_InMemory_::AcceptedStringBegin_;
+    using InputApparatus_InMemory_::AcceptedStringEnd_;
+    using InputApparatus_InMemory_::InputOffset_;
+    using InputApparatus_InMemory_::HasKeptString_;
+    using InputApparatus_InMemory_::Unscan_;
+    using InputApparatus_InMemory_::ScannedStringBegin_;
+
+    using AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::InitialState_;
+    using AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::ResetForNewInput_;
+    using AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::RunDfa_;
+
+    // returns the accept handler index of the keyword (of a higher-priority
+    // rule which was left out of the DFA) which the string just accepted by
+    // accept_handler_index is, if any, and otherwise accept_handler_index.
+    std::uint32_t KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const;
+
+    // state machine and automaton data.  these are the only static members
+    // of the scanner and of the ReflexCpp_ apparatus classes, and they are
+    // const and constant-initialized (they live in read-only data and are
+    // never written), so any number of scanner instances may run concurrently
+    // in different threads, as long as each instance is used by one thread
+    // at a time.
+    static std::uint32_t const ms_state_machine_start_state_index_[];
+    static std::uint8_t const ms_state_machine_mode_flags_[];
+    static std::uint32_t const ms_state_machine_count_;
+    static AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::DfaState_ const ms_state_table_[];
+    static std::size_t const ms_state_count_;
+    static AutomatonApparatus_Compressed_InMemory_S8_T16_A8_::DfaTransition_ const ms_transition_table_[];
+    static std::size_t const ms_transition_count_;
+    static std::uint8_t const ms_atom_class_table_[256];
+    static ReflexCpp_::AtomSkipSet_ const ms_skip_set_table_[];
+    static std::size_t const ms_skip_set_count_;
+    static std::uint32_t const ms_accept_handler_count_;
+    static bool const ms_accept_handler_is_token_only_[];
+    static TokenId const ms_accept_handler_token_id_[];
+    static std::int32_t const ms_accept_handler_keyword_state_machine_[];
+    static ReflexCpp_::KeywordSlot_ const ms_keyword_slot_table_[];
+    static std::uint16_t const ms_keyword_bucket_displacement_[];
+
+    // ///////////////////////////////////////////////////////////////////////
+    // end of internal reflex-generated parser guts
+    // ///////////////////////////////////////////////////////////////////////
+}; // end of class CompressedScanner
+
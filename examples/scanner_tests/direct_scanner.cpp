@@ -0,0 +1,3040 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// direct_scanner.cpp generated by reflex
+// from direct_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "direct_scanner.hpp"
+
+
+DirectScanner::DirectScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_DirectCoded_InMemory_()
+{
+
+    ResetForNewInput();
+}
+
+DirectScanner::~DirectScanner ()
+{
+}
+
+DirectScanner::StateMachine::Name DirectScanner::CurrentStateMachine () const
+{
+    std::size_t initial_node_index = InitialState_();
+    switch (initial_node_index)
+    {
+        default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
+        case 0: return StateMachine::BLOCK_COMMENT;
+        case 8: return StateMachine::KEYWORDS;
+        case 25: return StateMachine::KEYWORDS_CASE_INSENSITIVE;
+        case 65: return StateMachine::KEYWORDS_UNGREEDY;
+        case 82: return StateMachine::MAIN;
+    }
+}
+
+void DirectScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::BLOCK_COMMENT ||
+        state_machine == StateMachine::KEYWORDS ||
+        state_machine == StateMachine::KEYWORDS_CASE_INSENSITIVE ||
+        state_machine == StateMachine::KEYWORDS_UNGREEDY ||
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(ms_state_machine_start_state_index_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+DirectScanner::ScannerCheckpoint DirectScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void DirectScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void DirectScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void DirectScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_DirectCoded_InMemory_::ResetForNewInput_(ms_state_machine_start_state_index_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type DirectScanner::Scan () throw()
+{
+
+#line 47 "direct_scanner.reflex"
+
+    m_text.clear();
+
+#line 82 "direct_scanner.cpp"
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 59 "direct_scanner.reflex"
+
+    m_text.assign(rejected_string_data, rejected_string_length);
+    return Token::BAD_TOKEN;
+
+#line 127 "direct_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+
+#line 129 "direct_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::COMMENT;
+    
+#line 155 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 1:
+                {
+
+#line 136 "direct_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::UNTERMINATED_COMMENT;
+    
+#line 169 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 2:
+                {
+
+#line 150 "direct_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 179 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 4:
+                {
+
+#line 154 "direct_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 195 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 5:
+                {
+
+#line 157 "direct_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 205 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 6:
+                {
+
+#line 159 "direct_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 215 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 7:
+                {
+
+#line 161 "direct_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 225 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 8:
+                {
+
+#line 164 "direct_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 235 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 9:
+                {
+
+#line 167 "direct_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 245 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 10:
+                {
+
+#line 169 "direct_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 255 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 11:
+                {
+
+#line 172 "direct_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 265 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 12:
+                {
+
+#line 176 "direct_scanner.reflex"
+ KeepString(); 
+#line 275 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 13:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 14:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 15:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 16:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 17:
+                {
+
+#line 228 "direct_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 309 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 18:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 19:
+                {
+
+#line 232 "direct_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 325 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 20:
+                {
+
+#line 235 "direct_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 335 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 21:
+                {
+
+#line 237 "direct_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 345 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 22:
+                {
+
+#line 239 "direct_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 355 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 23:
+                {
+
+#line 242 "direct_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 365 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 24:
+                {
+
+#line 245 "direct_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 375 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 25:
+                {
+
+#line 247 "direct_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 385 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 26:
+                {
+
+#line 250 "direct_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 395 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 27:
+                {
+
+#line 254 "direct_scanner.reflex"
+ KeepString(); 
+#line 405 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 28:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 29:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 30:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 31:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 32:
+                {
+
+#line 189 "direct_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 439 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 33:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 34:
+                {
+
+#line 193 "direct_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 455 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 35:
+                {
+
+#line 196 "direct_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 465 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 36:
+                {
+
+#line 198 "direct_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 475 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 37:
+                {
+
+#line 200 "direct_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 485 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 38:
+                {
+
+#line 203 "direct_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 495 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 39:
+                {
+
+#line 206 "direct_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 505 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 40:
+                {
+
+#line 208 "direct_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 515 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 41:
+                {
+
+#line 211 "direct_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 525 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 42:
+                {
+
+#line 215 "direct_scanner.reflex"
+ KeepString(); 
+#line 535 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 43:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 44:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 45:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 46:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 47:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 48:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 49:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 50:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 51:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 52:
+                {
+
+#line 105 "direct_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::DIRECTIVE;
+    
+#line 602 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 53:
+                {
+
+#line 111 "direct_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::STRING;
+    
+#line 615 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 54:
+                {
+
+#line 118 "direct_scanner.reflex"
+
+        KeepString();
+        SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
+    
+#line 628 "direct_scanner.cpp"
+
+                }
+                break;
+
+                case 55:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 50 "direct_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 649 "direct_scanner.cpp"
+}
+
+std::size_t DirectScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::uint32_t DirectScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 6)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 63];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const DirectScanner::ms_state_machine_start_state_index_[] =
+{
+    0,
+    8,
+    25,
+    65,
+    82,
+};
+std::uint8_t const DirectScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+    0,
+    1,
+    2,
+    0,
+};
+std::uint32_t const DirectScanner::ms_state_machine_count_ = 5;
+
+// this is the direct-coded DFA.  each DFA state is a block of code labeled
+// with the state's index, which switches on the input atom (or on the
+// conditional flags) and jumps directly to the target state's block.  if
+// there is no valid transition, the most recent accept state's accept
+// handler index is returned (or ms_accept_handler_count_ if there was none).
+std::uint32_t DirectScanner::RunDfa_ ()
+{
+    std::uint32_t accept_handler_index_ = ms_accept_handler_count_;
+
+    switch (InitialState_())
+    {
+        case 0: goto dfa_state_0;
+        case 8: goto dfa_state_8;
+        case 25: goto dfa_state_25;
+        case 65: goto dfa_state_65;
+        case 82: goto dfa_state_82;
+        default: assert(false && "invalid initial state -- this should never happen"); goto dfa_halt;
+    }
+
+dfa_state_0:
+    switch (CurrentConditionalFlags_(2))
+    {
+        case 0: case 1:
+        case 4: case 5:
+        case 8: case 9:
+        case 12: case 13:
+        case 16: case 17:
+        case 20: case 21:
+        case 24: case 25:
+        case 28: case 29:
+            goto dfa_state_1;
+        case 2: case 3:
+        case 6: case 7:
+        case 10: case 11:
+        case 14: case 15:
+        case 18: case 19:
+        case 22: case 23:
+        case 26: case 27:
+        case 30: case 31:
+            goto dfa_state_3;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_1:
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+        case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+        case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41:
+        case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+        case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+        case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106:
+        case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+        case 123: case 124: case 125: case 126: case 127: case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138:
+        case 139: case 140: case 141: case 142: case 143: case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154:
+        case 155: case 156: case 157: case 158: case 159: case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170:
+        case 171: case 172: case 173: case 174: case 175: case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186:
+        case 187: case 188: case 189: case 190: case 191: case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202:
+        case 203: case 204: case 205: case 206: case 207: case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218:
+        case 219: case 220: case 221: case 222: case 223: case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234:
+        case 235: case 236: case 237: case 238: case 239: case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250:
+        case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_2;
+        case 42:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_2:
+    switch (CurrentConditionalFlags_(2))
+    {
+        case 0: case 1:
+        case 4: case 5:
+        case 8: case 9:
+        case 12: case 13:
+        case 16: case 17:
+        case 20: case 21:
+        case 24: case 25:
+        case 28: case 29:
+            goto dfa_state_1;
+        case 2: case 3:
+        case 6: case 7:
+        case 10: case 11:
+        case 14: case 15:
+        case 18: case 19:
+        case 22: case 23:
+        case 26: case 27:
+        case 30: case 31:
+            goto dfa_state_3;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_3:
+    accept_handler_index_ = 1;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+        case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+        case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41:
+        case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+        case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+        case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106:
+        case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+        case 123: case 124: case 125: case 126: case 127: case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138:
+        case 139: case 140: case 141: case 142: case 143: case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154:
+        case 155: case 156: case 157: case 158: case 159: case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170:
+        case 171: case 172: case 173: case 174: case 175: case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186:
+        case 187: case 188: case 189: case 190: case 191: case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202:
+        case 203: case 204: case 205: case 206: case 207: case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218:
+        case 219: case 220: case 221: case 222: case 223: case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234:
+        case 235: case 236: case 237: case 238: case 239: case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250:
+        case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_2;
+        case 42:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_4:
+    switch (CurrentConditionalFlags_(2))
+    {
+        case 0: case 1:
+        case 4: case 5:
+        case 8: case 9:
+        case 12: case 13:
+        case 16: case 17:
+        case 20: case 21:
+        case 24: case 25:
+        case 28: case 29:
+            goto dfa_state_5;
+        case 2: case 3:
+        case 6: case 7:
+        case 10: case 11:
+        case 14: case 15:
+        case 18: case 19:
+        case 22: case 23:
+        case 26: case 27:
+        case 30: case 31:
+            goto dfa_state_7;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_5:
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+        case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+        case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41:
+        case 43: case 44: case 45: case 46:
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+        case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+        case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+        case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111:
+        case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: case 123: case 124: case 125: case 126: case 127:
+        case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138: case 139: case 140: case 141: case 142: case 143:
+        case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154: case 155: case 156: case 157: case 158: case 159:
+        case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170: case 171: case 172: case 173: case 174: case 175:
+        case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186: case 187: case 188: case 189: case 190: case 191:
+        case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202: case 203: case 204: case 205: case 206: case 207:
+        case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218: case 219: case 220: case 221: case 222: case 223:
+        case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234: case 235: case 236: case 237: case 238: case 239:
+        case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250: case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_2;
+        case 42:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_6;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_6:
+    accept_handler_index_ = 0;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_7:
+    accept_handler_index_ = 1;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15: case 16:
+        case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31: case 32:
+        case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41:
+        case 43: case 44: case 45: case 46:
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63:
+        case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79:
+        case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 91: case 92: case 93: case 94: case 95:
+        case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111:
+        case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: case 123: case 124: case 125: case 126: case 127:
+        case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138: case 139: case 140: case 141: case 142: case 143:
+        case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154: case 155: case 156: case 157: case 158: case 159:
+        case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170: case 171: case 172: case 173: case 174: case 175:
+        case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186: case 187: case 188: case 189: case 190: case 191:
+        case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202: case 203: case 204: case 205: case 206: case 207:
+        case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218: case 219: case 220: case 221: case 222: case 223:
+        case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234: case 235: case 236: case 237: case 238: case 239:
+        case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250: case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_2;
+        case 42:
+            AdvanceReadCursor_();
+            goto dfa_state_4;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_6;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_8:
+    switch (CurrentConditionalFlags_(6))
+    {
+        case 0: case 1:
+        case 8: case 9:
+        case 16: case 17:
+        case 24: case 25:
+            goto dfa_state_9;
+        case 2: case 3:
+        case 10: case 11:
+        case 18: case 19:
+        case 26: case 27:
+            goto dfa_state_19;
+        case 4: case 5:
+        case 12: case 13:
+        case 20: case 21:
+        case 28: case 29:
+            goto dfa_state_20;
+        case 6: case 7:
+        case 14: case 15:
+        case 22: case 23:
+        case 30: case 31:
+            goto dfa_state_24;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_9:
+    switch (InputAtom_())
+    {
+        case 1:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+        case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_11;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_12;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_14;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_15;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_16;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_10:
+    AdvanceReadCursorPast_(ms_skip_set_table_[1]);
+    accept_handler_index_ = 13;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_11:
+    AdvanceReadCursorPast_(ms_skip_set_table_[2]);
+    accept_handler_index_ = 15;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_11;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_12:
+    switch (InputAtom_())
+    {
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_13;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_13:
+    accept_handler_index_ = 11;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_14:
+    AdvanceReadCursorPast_(ms_skip_set_table_[3]);
+    accept_handler_index_ = 14;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_14;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_15:
+    accept_handler_index_ = 12;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_16:
+    accept_handler_index_ = 13;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110:
+        case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 111:
+            AdvanceReadCursor_();
+            goto dfa_state_17;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_17:
+    accept_handler_index_ = 13;
+    SetAcceptCursor_();
+    switch (CurrentConditionalFlags_(8))
+    {
+        case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7:
+        case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23:
+            goto dfa_state_10;
+        case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15:
+        case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+            goto dfa_state_18;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_18:
+    accept_handler_index_ = 5;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_19:
+    accept_handler_index_ = 16;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 1:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+        case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_11;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_12;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_14;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_15;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_16;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_20:
+    switch (InputAtom_())
+    {
+        case 1:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 101:
+        case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118:
+        case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_11;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_12;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_14;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_15;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_16;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_21;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_21:
+    accept_handler_index_ = 13;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110:
+        case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 111:
+            AdvanceReadCursor_();
+            goto dfa_state_22;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_22:
+    accept_handler_index_ = 13;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113:
+        case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 114:
+            AdvanceReadCursor_();
+            goto dfa_state_23;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_23:
+    accept_handler_index_ = 6;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_24:
+    accept_handler_index_ = 16;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 1:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 101:
+        case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118:
+        case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_10;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_11;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_12;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_14;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_15;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_16;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_21;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_25:
+    switch (CurrentConditionalFlags_(6))
+    {
+        case 0: case 1:
+        case 8: case 9:
+        case 16: case 17:
+        case 24: case 25:
+            goto dfa_state_26;
+        case 2: case 3:
+        case 10: case 11:
+        case 18: case 19:
+        case 26: case 27:
+            goto dfa_state_59;
+        case 4: case 5:
+        case 12: case 13:
+        case 20: case 21:
+        case 28: case 29:
+            goto dfa_state_60;
+        case 6: case 7:
+        case 14: case 15:
+        case 22: case 23:
+        case 30: case 31:
+            goto dfa_state_64;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_26:
+    switch (InputAtom_())
+    {
+        case 1:
+            AdvanceReadCursor_();
+            goto dfa_state_27;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_31;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_32;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_34;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_37;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 103: case 104:
+        case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113:
+        case 115: case 116: case 117: case 118:
+        case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_38;
+        case 101:
+            AdvanceReadCursor_();
+            goto dfa_state_41;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_45;
+        case 105:
+            AdvanceReadCursor_();
+            goto dfa_state_48;
+        case 114:
+            AdvanceReadCursor_();
+            goto dfa_state_49;
+        case 119:
+            AdvanceReadCursor_();
+            goto dfa_state_55;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_27:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101:
+        case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118:
+        case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_29;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_28:
+    AdvanceReadCursorPast_(ms_skip_set_table_[1]);
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_29:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113:
+        case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 97:
+            AdvanceReadCursor_();
+            goto dfa_state_30;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_30:
+    accept_handler_index_ = 24;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_31:
+    AdvanceReadCursorPast_(ms_skip_set_table_[2]);
+    accept_handler_index_ = 30;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_31;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_32:
+    switch (InputAtom_())
+    {
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_33;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_33:
+    accept_handler_index_ = 26;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_34:
+    accept_handler_index_ = 29;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 60:
+        case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_35;
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_36;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_35:
+    AdvanceReadCursorPast_(ms_skip_set_table_[3]);
+    accept_handler_index_ = 29;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_35;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_36:
+    accept_handler_index_ = 25;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_35;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_37:
+    accept_handler_index_ = 27;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_38:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110:
+        case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 111:
+            AdvanceReadCursor_();
+            goto dfa_state_39;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_39:
+    accept_handler_index_ = 19;
+    SetAcceptCursor_();
+    switch (CurrentConditionalFlags_(8))
+    {
+        case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9: case 10: case 11: case 12: case 13: case 14: case 15:
+        case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27: case 28: case 29: case 30: case 31:
+            goto dfa_state_40;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_40:
+    accept_handler_index_ = 19;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_41:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107:
+        case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 108:
+            AdvanceReadCursor_();
+            goto dfa_state_42;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_42:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114:
+        case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 115:
+            AdvanceReadCursor_();
+            goto dfa_state_43;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_43:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100:
+        case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117:
+        case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 101:
+            AdvanceReadCursor_();
+            goto dfa_state_44;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_44:
+    accept_handler_index_ = 17;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_45:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110:
+        case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 111:
+            AdvanceReadCursor_();
+            goto dfa_state_46;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_46:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113:
+        case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 114:
+            AdvanceReadCursor_();
+            goto dfa_state_47;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_47:
+    accept_handler_index_ = 22;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_48:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101:
+        case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118:
+        case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_44;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_49:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100:
+        case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117:
+        case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 101:
+            AdvanceReadCursor_();
+            goto dfa_state_50;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_50:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115:
+        case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 116:
+            AdvanceReadCursor_();
+            goto dfa_state_51;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_51:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116:
+        case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 117:
+            AdvanceReadCursor_();
+            goto dfa_state_52;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_52:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113:
+        case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 114:
+            AdvanceReadCursor_();
+            goto dfa_state_53;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_53:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109:
+        case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 110:
+            AdvanceReadCursor_();
+            goto dfa_state_54;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_54:
+    accept_handler_index_ = 18;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_55:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103:
+        case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120:
+        case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 104:
+            AdvanceReadCursor_();
+            goto dfa_state_56;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_56:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104:
+        case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121:
+        case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 105:
+            AdvanceReadCursor_();
+            goto dfa_state_57;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_57:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107:
+        case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 108:
+            AdvanceReadCursor_();
+            goto dfa_state_58;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_58:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100:
+        case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117:
+        case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 101:
+            AdvanceReadCursor_();
+            goto dfa_state_47;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_59:
+    accept_handler_index_ = 31;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 1:
+            AdvanceReadCursor_();
+            goto dfa_state_27;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_31;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_32;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_34;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_37;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 103: case 104:
+        case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113:
+        case 115: case 116: case 117: case 118:
+        case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_38;
+        case 101:
+            AdvanceReadCursor_();
+            goto dfa_state_41;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_45;
+        case 105:
+            AdvanceReadCursor_();
+            goto dfa_state_48;
+        case 114:
+            AdvanceReadCursor_();
+            goto dfa_state_49;
+        case 119:
+            AdvanceReadCursor_();
+            goto dfa_state_55;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_60:
+    switch (InputAtom_())
+    {
+        case 1:
+            AdvanceReadCursor_();
+            goto dfa_state_27;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_31;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_32;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_34;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_37;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 103: case 104:
+        case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113:
+        case 115: case 116: case 117: case 118:
+        case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_38;
+        case 101:
+            AdvanceReadCursor_();
+            goto dfa_state_41;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_61;
+        case 105:
+            AdvanceReadCursor_();
+            goto dfa_state_48;
+        case 114:
+            AdvanceReadCursor_();
+            goto dfa_state_49;
+        case 119:
+            AdvanceReadCursor_();
+            goto dfa_state_55;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_61:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110:
+        case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 111:
+            AdvanceReadCursor_();
+            goto dfa_state_62;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_62:
+    accept_handler_index_ = 28;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113:
+        case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 114:
+            AdvanceReadCursor_();
+            goto dfa_state_63;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_63:
+    accept_handler_index_ = 21;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_64:
+    accept_handler_index_ = 31;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 1:
+            AdvanceReadCursor_();
+            goto dfa_state_27;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_31;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_32;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_34;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_37;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 103: case 104:
+        case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113:
+        case 115: case 116: case 117: case 118:
+        case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_28;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_38;
+        case 101:
+            AdvanceReadCursor_();
+            goto dfa_state_41;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_61;
+        case 105:
+            AdvanceReadCursor_();
+            goto dfa_state_48;
+        case 114:
+            AdvanceReadCursor_();
+            goto dfa_state_49;
+        case 119:
+            AdvanceReadCursor_();
+            goto dfa_state_55;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_65:
+    switch (CurrentConditionalFlags_(6))
+    {
+        case 0: case 1:
+        case 8: case 9:
+        case 16: case 17:
+        case 24: case 25:
+            goto dfa_state_66;
+        case 2: case 3:
+        case 10: case 11:
+        case 18: case 19:
+        case 26: case 27:
+            goto dfa_state_76;
+        case 4: case 5:
+        case 12: case 13:
+        case 20: case 21:
+        case 28: case 29:
+            goto dfa_state_77;
+        case 6: case 7:
+        case 14: case 15:
+        case 22: case 23:
+        case 30: case 31:
+            goto dfa_state_81;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_66:
+    switch (InputAtom_())
+    {
+        case 1:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116:
+        case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_67;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_68;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_69;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_71;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_72;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_73;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_67:
+    accept_handler_index_ = 43;
+    SetAcceptCursor_();
+    // ungreedy, so accept the shortest string possible
+    goto dfa_halt;
+
+dfa_state_68:
+    accept_handler_index_ = 45;
+    SetAcceptCursor_();
+    // ungreedy, so accept the shortest string possible
+    goto dfa_halt;
+
+dfa_state_69:
+    switch (InputAtom_())
+    {
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_70;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_70:
+    accept_handler_index_ = 41;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_71:
+    accept_handler_index_ = 44;
+    SetAcceptCursor_();
+    // ungreedy, so accept the shortest string possible
+    goto dfa_halt;
+
+dfa_state_72:
+    accept_handler_index_ = 42;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_73:
+    accept_handler_index_ = 43;
+    SetAcceptCursor_();
+    // ungreedy, so accept the shortest string possible
+    goto dfa_halt;
+
+dfa_state_76:
+    accept_handler_index_ = 46;
+    SetAcceptCursor_();
+    // ungreedy, so accept the shortest string possible
+    goto dfa_halt;
+
+dfa_state_77:
+    switch (InputAtom_())
+    {
+        case 1:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99:
+        case 101:
+        case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118:
+        case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_67;
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_68;
+        case 58:
+            AdvanceReadCursor_();
+            goto dfa_state_69;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_71;
+        case 64:
+            AdvanceReadCursor_();
+            goto dfa_state_72;
+        case 100:
+            AdvanceReadCursor_();
+            goto dfa_state_73;
+        case 102:
+            AdvanceReadCursor_();
+            goto dfa_state_78;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_78:
+    accept_handler_index_ = 43;
+    SetAcceptCursor_();
+    // ungreedy, so accept the shortest string possible
+    goto dfa_halt;
+
+dfa_state_81:
+    accept_handler_index_ = 46;
+    SetAcceptCursor_();
+    // ungreedy, so accept the shortest string possible
+    goto dfa_halt;
+
+dfa_state_82:
+    switch (CurrentConditionalFlags_(6))
+    {
+        case 0: case 1:
+        case 8: case 9:
+        case 16: case 17:
+        case 24: case 25:
+            goto dfa_state_83;
+        case 2: case 3:
+        case 10: case 11:
+        case 18: case 19:
+        case 26: case 27:
+            goto dfa_state_95;
+        case 4: case 5:
+        case 12: case 13:
+        case 20: case 21:
+        case 28: case 29:
+            goto dfa_state_96;
+        case 6: case 7:
+        case 14: case 15:
+        case 22: case 23:
+        case 30: case 31:
+            goto dfa_state_98;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_83:
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_84;
+        case 33:
+            AdvanceReadCursor_();
+            goto dfa_state_85;
+        case 34:
+            AdvanceReadCursor_();
+            goto dfa_state_87;
+        case 40: case 41: case 42: case 43: case 44: case 45:
+        case 59:
+        case 123:
+        case 125:
+            AdvanceReadCursor_();
+            goto dfa_state_86;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_90;
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_92;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_93;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_94;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_84:
+    AdvanceReadCursorPast_(ms_skip_set_table_[2]);
+    accept_handler_index_ = 51;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_84;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_85:
+    switch (InputAtom_())
+    {
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_86;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_86:
+    accept_handler_index_ = 50;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_87:
+    AdvanceReadCursorPast_(ms_skip_set_table_[4]);
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9:
+        case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+        case 27: case 28: case 29: case 30: case 31: case 32: case 33:
+        case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50:
+        case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58: case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66:
+        case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82:
+        case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90: case 91:
+        case 93: case 94: case 95: case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108:
+        case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122: case 123: case 124:
+        case 125: case 126: case 127: case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138: case 139: case 140:
+        case 141: case 142: case 143: case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154: case 155: case 156:
+        case 157: case 158: case 159: case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170: case 171: case 172:
+        case 173: case 174: case 175: case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186: case 187: case 188:
+        case 189: case 190: case 191: case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202: case 203: case 204:
+        case 205: case 206: case 207: case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218: case 219: case 220:
+        case 221: case 222: case 223: case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234: case 235: case 236:
+        case 237: case 238: case 239: case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250: case 251: case 252:
+        case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_87;
+        case 34:
+            AdvanceReadCursor_();
+            goto dfa_state_88;
+        case 92:
+            AdvanceReadCursor_();
+            goto dfa_state_89;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_88:
+    accept_handler_index_ = 53;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_89:
+    switch (InputAtom_())
+    {
+        case 1: case 2: case 3: case 4: case 5: case 6: case 7: case 8: case 9:
+        case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26:
+        case 27: case 28: case 29: case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42:
+        case 43: case 44: case 45: case 46: case 47: case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57: case 58:
+        case 59: case 60: case 61: case 62: case 63: case 64: case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74:
+        case 75: case 76: case 77: case 78: case 79: case 80: case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 91: case 92: case 93: case 94: case 95: case 96: case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106:
+        case 107: case 108: case 109: case 110: case 111: case 112: case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+        case 123: case 124: case 125: case 126: case 127: case 128: case 129: case 130: case 131: case 132: case 133: case 134: case 135: case 136: case 137: case 138:
+        case 139: case 140: case 141: case 142: case 143: case 144: case 145: case 146: case 147: case 148: case 149: case 150: case 151: case 152: case 153: case 154:
+        case 155: case 156: case 157: case 158: case 159: case 160: case 161: case 162: case 163: case 164: case 165: case 166: case 167: case 168: case 169: case 170:
+        case 171: case 172: case 173: case 174: case 175: case 176: case 177: case 178: case 179: case 180: case 181: case 182: case 183: case 184: case 185: case 186:
+        case 187: case 188: case 189: case 190: case 191: case 192: case 193: case 194: case 195: case 196: case 197: case 198: case 199: case 200: case 201: case 202:
+        case 203: case 204: case 205: case 206: case 207: case 208: case 209: case 210: case 211: case 212: case 213: case 214: case 215: case 216: case 217: case 218:
+        case 219: case 220: case 221: case 222: case 223: case 224: case 225: case 226: case 227: case 228: case 229: case 230: case 231: case 232: case 233: case 234:
+        case 235: case 236: case 237: case 238: case 239: case 240: case 241: case 242: case 243: case 244: case 245: case 246: case 247: case 248: case 249: case 250:
+        case 251: case 252: case 253: case 254: case 255:
+            AdvanceReadCursor_();
+            goto dfa_state_87;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_90:
+    accept_handler_index_ = 50;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 42:
+            AdvanceReadCursor_();
+            goto dfa_state_91;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_91:
+    accept_handler_index_ = 54;
+    SetAcceptCursor_();
+    // no transitions
+    goto dfa_halt;
+
+dfa_state_92:
+    AdvanceReadCursorPast_(ms_skip_set_table_[5]);
+    accept_handler_index_ = 49;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_92;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_93:
+    accept_handler_index_ = 50;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 61:
+            AdvanceReadCursor_();
+            goto dfa_state_86;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_94:
+    AdvanceReadCursorPast_(ms_skip_set_table_[1]);
+    accept_handler_index_ = 48;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_94;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_95:
+    accept_handler_index_ = 55;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_84;
+        case 33:
+            AdvanceReadCursor_();
+            goto dfa_state_85;
+        case 34:
+            AdvanceReadCursor_();
+            goto dfa_state_87;
+        case 40: case 41: case 42: case 43: case 44: case 45:
+        case 59:
+        case 123:
+        case 125:
+            AdvanceReadCursor_();
+            goto dfa_state_86;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_90;
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_92;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_93;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_94;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_96:
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_84;
+        case 33:
+            AdvanceReadCursor_();
+            goto dfa_state_85;
+        case 34:
+            AdvanceReadCursor_();
+            goto dfa_state_87;
+        case 35:
+            AdvanceReadCursor_();
+            goto dfa_state_97;
+        case 40: case 41: case 42: case 43: case 44: case 45:
+        case 59:
+        case 123:
+        case 125:
+            AdvanceReadCursor_();
+            goto dfa_state_86;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_90;
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_92;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_93;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_94;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_97:
+    AdvanceReadCursorPast_(ms_skip_set_table_[6]);
+    accept_handler_index_ = 52;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_97;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_state_98:
+    accept_handler_index_ = 55;
+    SetAcceptCursor_();
+    switch (InputAtom_())
+    {
+        case 9: case 10:
+        case 32:
+            AdvanceReadCursor_();
+            goto dfa_state_84;
+        case 33:
+            AdvanceReadCursor_();
+            goto dfa_state_85;
+        case 34:
+            AdvanceReadCursor_();
+            goto dfa_state_87;
+        case 35:
+            AdvanceReadCursor_();
+            goto dfa_state_97;
+        case 40: case 41: case 42: case 43: case 44: case 45:
+        case 59:
+        case 123:
+        case 125:
+            AdvanceReadCursor_();
+            goto dfa_state_86;
+        case 47:
+            AdvanceReadCursor_();
+            goto dfa_state_90;
+        case 48: case 49: case 50: case 51: case 52: case 53: case 54: case 55: case 56: case 57:
+            AdvanceReadCursor_();
+            goto dfa_state_92;
+        case 60: case 61: case 62:
+            AdvanceReadCursor_();
+            goto dfa_state_93;
+        case 65: case 66: case 67: case 68: case 69: case 70: case 71: case 72: case 73: case 74: case 75: case 76: case 77: case 78: case 79: case 80:
+        case 81: case 82: case 83: case 84: case 85: case 86: case 87: case 88: case 89: case 90:
+        case 95:
+        case 97: case 98: case 99: case 100: case 101: case 102: case 103: case 104: case 105: case 106: case 107: case 108: case 109: case 110: case 111: case 112:
+        case 113: case 114: case 115: case 116: case 117: case 118: case 119: case 120: case 121: case 122:
+            AdvanceReadCursor_();
+            goto dfa_state_94;
+        default:
+            goto dfa_halt;
+    }
+
+dfa_halt:
+    if (accept_handler_index_ < ms_accept_handler_count_)
+        Accept_();
+    else
+        Reject_();
+    return accept_handler_index_;
+}
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const DirectScanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 60, 0, 0, 0 },
+        { 62, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 251, 255, 255, 255, 255, 255, 255, 239, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        4, false,
+        { 1, 11, 35, 93 },
+        { 9, 33, 91, 255 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 97, 0, 0, 0 },
+        { 122, 0, 0, 0 }
+    }
+};
+
+std::uint32_t const DirectScanner::ms_accept_handler_count_ = 56;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const DirectScanner::ms_accept_handler_is_token_only_[] =
+{
+    false,
+    false,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    false,
+    false,
+    false,
+    true
+};
+DirectScanner::TokenId const DirectScanner::ms_accept_handler_token_id_[] =
+{
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const DirectScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    3,
+    -1,
+    -1,
+    -1,
+    4,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const DirectScanner::ms_keyword_slot_table_[] =
+{
+    { ">=", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "<=", 2, 3, 40 },
+    { "do", 2, 1, 4 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { ">=", 2, 1, 10 },
+    { "==", 2, 1, 10 },
+    { "<=", 2, 1, 10 },
+    { "for", 3, 1, 7 },
+    { "if", 2, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 4, 47 },
+    { "return", 6, 3, 33 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "do", 2, 3, 34 },
+    { "\x01\x66\x61", 3, 1, 9 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "==", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 3, 32 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 1, 3 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 4, 47 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "while", 5, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 4, 47 },
+    { "", 0, 0, 56 },
+    { "while", 5, 1, 7 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "\x01\x66\x61", 3, 3, 39 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 3, 32 },
+    { "while", 5, 4, 47 },
+    { "", 0, 0, 56 },
+    { "for", 3, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 }
+};
+std::uint16_t const DirectScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    1,
+    0,
+    3,
+    2,
+    1,
+    3,
+    0
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,103 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that after each of a series of random edits, the token stream kept
+// up to date by RescanTokenStream is the same as the one ScanTokenStream
+// records by scanning the edited input from scratch, and that the latter has
+// the same tokens as plain Scan, with contiguous offsets and lengths.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "incremental_scanner.hpp"
+#include "reference_scanner.hpp"
+
+// Returns the record of the token stream -- each token's id and (unlike the
+// record made by ScanTokens) its offset and length, and how it was scanned.
+// The read extent isn't included, since it depends on how far back the scan
+// that produced the token began.
+std::string TokenStreamRecord (std::vector<IncrementalScanner::ScannedToken> const &token_stream)
+{
+    std::string token_record;
+    for (IncrementalScanner::ScannedToken const &token : token_stream)
+    {
+        token_record += std::to_string(token.m_token) + "@" + std::to_string(token.m_offset) + ":" + std::to_string(token.m_length);
+        token_record += "(" + std::to_string(token.m_scan_offset) + "," + std::to_string(token.m_state_machine) + (token.m_scan_began_with_kept_string ? ",kept) " : ") ");
+    }
+    return token_record;
+}
+
+// Returns the token ids of the token stream, followed by any gap or overlap
+// between consecutive tokens.
+std::string TokenIds (std::vector<IncrementalScanner::ScannedToken> const &token_stream, std::size_t input_size)
+{
+    std::string token_ids;
+    std::size_t offset = 0;
+    for (IncrementalScanner::ScannedToken const &token : token_stream)
+    {
+        if (token.m_offset != offset)
+            token_ids += "<token at offset " + std::to_string(token.m_offset) + ">";
+        token_ids += std::to_string(token.m_token) + " ";
+        offset = token.m_offset + token.m_length;
+    }
+    if (offset != input_size)
+        token_ids += "<ended at offset " + std::to_string(offset) + ">";
+    return token_ids;
+}
+
+// Returns the token ids returned by plain Scan.
+std::string ReferenceTokenIds (std::string const &input)
+{
+    ReferenceScanner scanner;
+    scanner.InputSpan(input.data(), input.data() + input.size());
+    std::string token_ids;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        Token::Type token = scanner.Scan();
+        token_ids += std::to_string(token) + " ";
+        if (token == Token::END_OF_INPUT)
+            break;
+    }
+    return token_ids;
+}
+
+int main ()
+{
+    InputGenerator generator;
+    int failure_count = 0;
+    for (int i = 0; i < 200 && failure_count < 10; ++i)
+    {
+        std::string input(generator.Input(60));
+        IncrementalScanner scanner;
+        scanner.InputSpan(input.data(), input.data() + input.size());
+        scanner.ScanTokenStream();
+
+        for (int e = 0; e < 50 && failure_count < 10; ++e)
+        {
+            // replace up to 3 atoms with up to 2 fragments.
+            std::size_t edit_offset = generator.Next(input.size() + 1);
+            std::size_t removed_length = std::min(generator.Next(4), input.size() - edit_offset);
+            std::string inserted(generator.Input(2));
+            std::string edited_input(input.substr(0, edit_offset) + inserted + input.substr(edit_offset + removed_length));
+
+            std::size_t old_token_count = scanner.TokenStream().size();
+            IncrementalScanner::TokenStreamChange change(scanner.RescanTokenStream(edited_input.data(), edited_input.data() + edited_input.size(), edit_offset, removed_length, inserted.size()));
+            input.swap(edited_input);
+
+            IncrementalScanner full_scanner;
+            full_scanner.InputSpan(input.data(), input.data() + input.size());
+            full_scanner.ScanTokenStream();
+
+            std::string expected(TokenStreamRecord(full_scanner.TokenStream()));
+            std::string actual(TokenStreamRecord(scanner.TokenStream()));
+            if (change.m_token_index + change.m_inserted_token_count > scanner.TokenStream().size() ||
+                old_token_count - change.m_removed_token_count + change.m_inserted_token_count != scanner.TokenStream().size())
+            {
+                actual += "<replaced " + std::to_string(change.m_removed_token_count) + " tokens at index " + std::to_string(change.m_token_index) +
+                          " with " + std::to_string(change.m_inserted_token_count) + ">";
+            }
+            failure_count += CheckTokenRecord("RescanTokenStream", input, expected, actual);
+            failure_count += CheckTokenRecord("ScanTokenStream", input, ReferenceTokenIds(input), TokenIds(full_scanner.TokenStream(), input.size()));
+        }
+    }
+    return failure_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that scanners with track_input_position produce the same tokens as
+// plain Scan, and that AcceptedStringBeginPosition and
+// AcceptedStringEndPosition of each token agree with the offsets, lines and
+// columns counted directly from the input -- each token beginning where the
+// previous one ended, including the comments that begin with a kept string.
+
+#include <sstream>
+#include <string>
+#include "memory_position_scanner.hpp"
+#include "reference_scanner.hpp"
+#include "streambuf_position_scanner.hpp"
+
+// Returns the position of offset within input, counted directly.
+std::string ExpectedPosition (std::string const &input, std::size_t offset)
+{
+    std::size_t line = 1;
+    std::size_t line_begin = 0;
+    for (std::size_t i = 0; i < offset; ++i)
+    {
+        if (input[i] == '\n')
+        {
+            ++line;
+            line_begin = i + 1;
+        }
+    }
+    return std::to_string(offset) + ":" + std::to_string(line) + ":" + std::to_string(offset - line_begin + 1);
+}
+
+template <typename Position_>
+std::string ActualPosition (Position_ const &position)
+{
+    return std::to_string(position.m_offset) + ":" + std::to_string(position.m_line) + ":" + std::to_string(position.m_column);
+}
+
+template <typename Scanner_>
+std::string ScanTokensCheckingPositions (Scanner_ &scanner, std::string const &input)
+{
+    std::string token_record;
+    // the offset of the end of the previous token
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        Token::Type token = scanner.Scan();
+        RecordToken(token_record, token, scanner.m_text);
+
+        std::string expected_begin(ExpectedPosition(input, offset));
+        std::string actual_begin(ActualPosition(scanner.AcceptedStringBeginPosition()));
+        if (actual_begin != expected_begin)
+            return token_record + "<begins at " + actual_begin + " instead of " + expected_begin + ">";
+        offset = scanner.AcceptedStringEndPosition().m_offset;
+        if (offset < scanner.AcceptedStringBeginPosition().m_offset || offset > input.size())
+            return token_record + "<ends at offset " + std::to_string(offset) + ">";
+        std::string expected_end(ExpectedPosition(input, offset));
+        std::string actual_end(ActualPosition(scanner.AcceptedStringEndPosition()));
+        if (actual_end != expected_end)
+            return token_record + "<ends at " + actual_end + " instead of " + expected_end + ">";
+
+        if (token == Token::END_OF_INPUT)
+            break;
+    }
+    if (offset != input.size())
+        token_record += "<ended at offset " + std::to_string(offset) + ">";
+    return token_record;
+}
+
+int main ()
+{
+    InputGenerator generator;
+    int failure_count = 0;
+    for (int i = 0; i < 2000 && failure_count < 10; ++i)
+    {
+        std::string input(generator.Input(24));
+
+        ReferenceScanner reference_scanner;
+        reference_scanner.InputSpan(input.data(), input.data() + input.size());
+        std::string expected(ScanTokens(reference_scanner));
+
+        {
+            MemoryPositionScanner scanner;
+            scanner.InputSpan(input.data(), input.data() + input.size());
+            failure_count += CheckTokenRecord("in-memory input position", input, expected, ScanTokensCheckingPositions(scanner, input));
+        }
+        {
+            std::istringstream in(input);
+            StreambufPositionScanner scanner;
+            scanner.InputStreambuf(in.rdbuf());
+            failure_count += CheckTokenRecord("streambuf input position", input, expected, ScanTokensCheckingPositions(scanner, input));
+        }
+    }
+    return failure_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that the scanners whose keywords reflex extracts into a perfect hash
+// table produce the same tokens as reference_scanner, which leaves them in
+// the DFA, for each DFA implementation.  The inputs are scanned in each of
+// the KEYWORDS* state machines, whose rules mix literal rules which are
+// extracted with ones which must stay in the DFA (conditional rules, a rule
+// no later rule covers, and the rules of the case-insensitive state machine),
+// along with a duplicate keyword and a kept string preceding a keyword.
+
+#include <string>
+#include "compressed_scanner.hpp"
+#include "direct_scanner.hpp"
+#include "lazy_scanner.hpp"
+#include "reference_scanner.hpp"
+#include "small_scanner.hpp"
+#include "table_scanner.hpp"
+
+// Returns an input of at most max_fragment_count fragments, which are chosen
+// to exercise the rules of the KEYWORDS* state machines -- keywords, near
+// misses and differently-cased keywords.
+std::string KeywordInput (InputGenerator &generator, std::size_t max_fragment_count)
+{
+    static char const *const FRAGMENTS[] = {
+        "if", "else", "return", "do", "for", "while", "iff", "fo", "dox", "x",
+        "IF", "Do", "FOR", "While", "\x01", "\x01" "fa", "\x01" "FA", "fa",
+        "<", "=", "<=", "==", ">=", ":=", ":", "@", " ", "\n", "\t",
+    };
+    static std::size_t const FRAGMENT_COUNT = sizeof(FRAGMENTS) / sizeof(FRAGMENTS[0]);
+
+    std::string retval;
+    for (std::size_t i = 0, fragment_count = generator.Next(max_fragment_count + 1); i < fragment_count; ++i)
+        retval += FRAGMENTS[generator.Next(FRAGMENT_COUNT)];
+    return retval;
+}
+
+// Scans input with a new Scanner_ in the state machine with the given index
+// among the KEYWORDS* state machines.
+template <typename Scanner_>
+std::string ScanKeywordTokens (std::string const &input, int state_machine_index)
+{
+    static typename Scanner_::StateMachine::Name const STATE_MACHINES[] = {
+        Scanner_::StateMachine::KEYWORDS,
+        Scanner_::StateMachine::KEYWORDS_UNGREEDY,
+        Scanner_::StateMachine::KEYWORDS_CASE_INSENSITIVE,
+    };
+
+    Scanner_ scanner;
+    scanner.InputSpan(input.data(), input.data() + input.size());
+    scanner.SwitchToStateMachine(STATE_MACHINES[state_machine_index]);
+    return ScanTokens(scanner);
+}
+
+int main ()
+{
+    static char const *const STATE_MACHINE_NAMES[] = { "KEYWORDS", "KEYWORDS_UNGREEDY", "KEYWORDS_CASE_INSENSITIVE" };
+
+    InputGenerator generator;
+    int failure_count = 0;
+    for (int i = 0; i < 2000 && failure_count < 10; ++i)
+    {
+        std::string input(KeywordInput(generator, 16));
+        for (int state_machine_index = 0; state_machine_index < 3; ++state_machine_index)
+        {
+            std::string const name(STATE_MACHINE_NAMES[state_machine_index]);
+            std::string expected(ScanKeywordTokens<ReferenceScanner>(input, state_machine_index));
+            failure_count += CheckTokenRecord((name + " table").c_str(), input, expected, ScanKeywordTokens<TableScanner>(input, state_machine_index));
+            failure_count += CheckTokenRecord((name + " small_and_slow").c_str(), input, expected, ScanKeywordTokens<SmallScanner>(input, state_machine_index));
+            failure_count += CheckTokenRecord((name + " compressed_tables").c_str(), input, expected, ScanKeywordTokens<CompressedScanner>(input, state_machine_index));
+            failure_count += CheckTokenRecord((name + " direct_coded").c_str(), input, expected, ScanKeywordTokens<DirectScanner>(input, state_machine_index));
+            failure_count += CheckTokenRecord((name + " lazy_dfa").c_str(), input, expected, ScanKeywordTokens<LazyScanner>(input, state_machine_index));
+        }
+    }
+    return failure_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,1467 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// lazy_scanner.cpp generated by reflex
+// from lazy_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "lazy_scanner.hpp"
+
+
+LazyScanner::LazyScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_(
+        ms_nfa_state_table_,
+        ms_nfa_state_count_,
+        ms_nfa_transition_table_,
+        ms_nfa_transition_count_,
+        ms_state_machine_start_state_index_,
+        ms_state_machine_count_,
+        4096,
+        ms_accept_handler_count_)
+{
+
+    ResetForNewInput();
+}
+
+LazyScanner::~LazyScanner ()
+{
+}
+
+LazyScanner::StateMachine::Name LazyScanner::CurrentStateMachine () const
+{
+    assert(InitialState_() < ms_state_machine_count_);
+    return StateMachine::Name(InitialState_());
+}
+
+void LazyScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::BLOCK_COMMENT ||
+        state_machine == StateMachine::KEYWORDS ||
+        state_machine == StateMachine::KEYWORDS_CASE_INSENSITIVE ||
+        state_machine == StateMachine::KEYWORDS_UNGREEDY ||
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(state_machine);
+    ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+LazyScanner::ScannerCheckpoint LazyScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void LazyScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void LazyScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void LazyScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::ResetForNewInput_(StateMachine::START_, ms_state_machine_mode_flags_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type LazyScanner::Scan () throw()
+{
+
+#line 47 "lazy_scanner.reflex"
+
+    m_text.clear();
+
+#line 83 "lazy_scanner.cpp"
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 59 "lazy_scanner.reflex"
+
+    m_text.assign(rejected_string_data, rejected_string_length);
+    return Token::BAD_TOKEN;
+
+#line 128 "lazy_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+
+#line 129 "lazy_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::COMMENT;
+    
+#line 156 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 1:
+                {
+
+#line 136 "lazy_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::UNTERMINATED_COMMENT;
+    
+#line 170 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 2:
+                {
+
+#line 150 "lazy_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 180 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 4:
+                {
+
+#line 154 "lazy_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 196 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 5:
+                {
+
+#line 157 "lazy_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 206 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 6:
+                {
+
+#line 159 "lazy_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 216 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 7:
+                {
+
+#line 161 "lazy_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 226 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 8:
+                {
+
+#line 164 "lazy_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 236 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 9:
+                {
+
+#line 167 "lazy_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 246 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 10:
+                {
+
+#line 169 "lazy_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 256 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 11:
+                {
+
+#line 172 "lazy_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 266 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 12:
+                {
+
+#line 176 "lazy_scanner.reflex"
+ KeepString(); 
+#line 276 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 13:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 14:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 15:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 16:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 17:
+                {
+
+#line 228 "lazy_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 310 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 18:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 19:
+                {
+
+#line 232 "lazy_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 326 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 20:
+                {
+
+#line 235 "lazy_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 336 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 21:
+                {
+
+#line 237 "lazy_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 346 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 22:
+                {
+
+#line 239 "lazy_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 356 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 23:
+                {
+
+#line 242 "lazy_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 366 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 24:
+                {
+
+#line 245 "lazy_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 376 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 25:
+                {
+
+#line 247 "lazy_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 386 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 26:
+                {
+
+#line 250 "lazy_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 396 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 27:
+                {
+
+#line 254 "lazy_scanner.reflex"
+ KeepString(); 
+#line 406 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 28:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 29:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 30:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 31:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 32:
+                {
+
+#line 189 "lazy_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 440 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 33:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 34:
+                {
+
+#line 193 "lazy_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 456 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 35:
+                {
+
+#line 196 "lazy_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 466 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 36:
+                {
+
+#line 198 "lazy_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 476 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 37:
+                {
+
+#line 200 "lazy_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 486 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 38:
+                {
+
+#line 203 "lazy_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 496 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 39:
+                {
+
+#line 206 "lazy_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 506 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 40:
+                {
+
+#line 208 "lazy_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 516 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 41:
+                {
+
+#line 211 "lazy_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 526 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 42:
+                {
+
+#line 215 "lazy_scanner.reflex"
+ KeepString(); 
+#line 536 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 43:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 44:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 45:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 46:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 47:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 48:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 49:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 50:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 51:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 52:
+                {
+
+#line 105 "lazy_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::DIRECTIVE;
+    
+#line 603 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 53:
+                {
+
+#line 111 "lazy_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::STRING;
+    
+#line 616 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 54:
+                {
+
+#line 118 "lazy_scanner.reflex"
+
+        KeepString();
+        SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
+    
+#line 629 "lazy_scanner.cpp"
+
+                }
+                break;
+
+                case 55:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 50 "lazy_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 650 "lazy_scanner.cpp"
+}
+
+std::size_t LazyScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::uint32_t LazyScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 6)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 63];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const LazyScanner::ms_state_machine_start_state_index_[] =
+{
+    56,
+    73,
+    93,
+    142,
+    162,
+};
+std::uint8_t const LazyScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+    0,
+    1,
+    2,
+    0,
+};
+std::uint32_t const LazyScanner::ms_state_machine_count_ = 5;
+
+// the NFA which the DFA states are made from.  the first
+// ms_accept_handler_count_ states are the accept states, and the order of
+// those indicates priority (the lower the index, the higher the priority).
+ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaState_ const LazyScanner::ms_nfa_state_table_[] =
+{
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 2 },
+    { 2, 1 },
+    { 3, 1 },
+    { 4, 2 },
+    { 6, 3 },
+    { 9, 3 },
+    { 12, 2 },
+    { 14, 1 },
+    { 15, 2 },
+    { 17, 1 },
+    { 18, 1 },
+    { 19, 2 },
+    { 21, 3 },
+    { 24, 3 },
+    { 27, 2 },
+    { 29, 1 },
+    { 30, 2 },
+    { 32, 8 },
+    { 40, 1 },
+    { 41, 1 },
+    { 42, 1 },
+    { 43, 1 },
+    { 44, 1 },
+    { 45, 1 },
+    { 46, 1 },
+    { 47, 1 },
+    { 48, 1 },
+    { 49, 1 },
+    { 50, 4 },
+    { 54, 1 },
+    { 55, 5 },
+    { 60, 1 },
+    { 61, 2 },
+    { 63, 1 },
+    { 64, 2 },
+    { 66, 3 },
+    { 69, 1 },
+    { 70, 15 },
+    { 85, 2 },
+    { 87, 1 },
+    { 88, 1 },
+    { 89, 1 },
+    { 90, 1 },
+    { 91, 1 },
+    { 92, 1 },
+    { 93, 1 },
+    { 94, 1 },
+    { 95, 1 },
+    { 96, 1 },
+    { 97, 1 },
+    { 98, 1 },
+    { 99, 1 },
+    { 100, 1 },
+    { 101, 1 },
+    { 102, 1 },
+    { 103, 1 },
+    { 104, 1 },
+    { 105, 1 },
+    { 106, 2 },
+    { 108, 1 },
+    { 109, 1 },
+    { 110, 1 },
+    { 111, 1 },
+    { 112, 1 },
+    { 113, 1 },
+    { 114, 1 },
+    { 115, 1 },
+    { 116, 1 },
+    { 117, 1 },
+    { 118, 1 },
+    { 119, 3 },
+    { 122, 1 },
+    { 123, 1 },
+    { 124, 1 },
+    { 125, 1 },
+    { 126, 1 },
+    { 127, 1 },
+    { 128, 4 },
+    { 132, 1 },
+    { 133, 5 },
+    { 138, 1 },
+    { 139, 2 },
+    { 141, 1 },
+    { 142, 2 },
+    { 144, 3 },
+    { 147, 1 },
+    { 148, 8 },
+    { 156, 1 },
+    { 157, 1 },
+    { 158, 1 },
+    { 159, 1 },
+    { 160, 1 },
+    { 161, 1 },
+    { 162, 1 },
+    { 163, 1 },
+    { 164, 1 },
+    { 165, 1 },
+    { 166, 4 },
+    { 170, 1 },
+    { 171, 5 },
+    { 176, 1 },
+    { 177, 2 },
+    { 179, 1 },
+    { 180, 2 },
+    { 182, 3 },
+    { 185, 1 },
+    { 186, 8 },
+    { 194, 1 },
+    { 195, 3 },
+    { 198, 1 },
+    { 199, 5 },
+    { 204, 1 },
+    { 205, 1 },
+    { 206, 2 },
+    { 208, 1 },
+    { 209, 9 },
+    { 218, 1 },
+    { 219, 1 },
+    { 220, 1 },
+    { 221, 1 },
+    { 222, 1 },
+    { 223, 2 },
+    { 225, 3 },
+    { 228, 1 },
+    { 229, 1 },
+    { 230, 1 },
+    { 231, 2 },
+    { 233, 1 },
+    { 234, 1 },
+    { 235, 1 },
+    { 236, 1 },
+    { 237, 2 },
+    { 239, 5 },
+    { 244, 2 },
+    { 246, 1 },
+    { 247, 1 },
+    { 248, 1 }
+};
+std::size_t const LazyScanner::ms_nfa_state_count_ = sizeof(LazyScanner::ms_nfa_state_table_) / sizeof(*LazyScanner::ms_nfa_state_table_);
+
+ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_ const LazyScanner::ms_nfa_transition_table_[] =
+{
+    { 57, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 65, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 59, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 64, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 58, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 60, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 62, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 59, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 59, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 43, 255 },
+    { 59, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 59, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 43, 46 },
+    { 59, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 255 },
+    { 62, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 61, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 0, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 47, 47 },
+    { 64, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 63, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 72, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 66, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 68, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 70, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 67, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 67, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 43, 255 },
+    { 67, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 67, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 43, 46 },
+    { 67, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 255 },
+    { 70, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 69, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 1, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 2, 2 },
+    { 72, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 71, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 74, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 77, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 81, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 83, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 84, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 87, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 89, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 92, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 75, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 100, 100 },
+    { 76, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 111, 111 },
+    { 5, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 6, 6 },
+    { 78, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 4, 4 },
+    { 79, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 102, 102 },
+    { 80, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 111, 111 },
+    { 6, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 114, 114 },
+    { 82, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 58, 58 },
+    { 11, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 12, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 64, 64 },
+    { 85, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 1 },
+    { 85, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 85, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 85, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 86, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 86, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 86, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 86, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 13, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 88, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 88, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 14, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 90, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 91, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 91, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 91, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 91, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 15, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 16, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 2, 2 },
+    { 94, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 99, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 105, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 107, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 110, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 114, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 121, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 123, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 126, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 130, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 132, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 133, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 136, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 138, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 141, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 96, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 101, 101 },
+    { 95, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 105, 105 },
+    { 17, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 102, 102 },
+    { 97, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 108, 108 },
+    { 98, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 115, 115 },
+    { 17, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 101, 101 },
+    { 100, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 114, 114 },
+    { 101, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 101, 101 },
+    { 102, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 116, 116 },
+    { 103, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 117, 117 },
+    { 104, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 114, 114 },
+    { 18, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 110, 110 },
+    { 106, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 100, 100 },
+    { 19, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 111, 111 },
+    { 108, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 100, 100 },
+    { 109, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 111, 111 },
+    { 20, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 6, 6 },
+    { 111, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 4, 4 },
+    { 112, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 102, 102 },
+    { 113, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 111, 111 },
+    { 21, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 114, 114 },
+    { 115, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 102, 102 },
+    { 117, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 119, 119 },
+    { 116, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 111, 111 },
+    { 22, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 114, 114 },
+    { 118, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 104, 104 },
+    { 119, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 105, 105 },
+    { 120, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 108, 108 },
+    { 22, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 101, 101 },
+    { 122, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 105, 105 },
+    { 23, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 102, 102 },
+    { 124, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 1, 1 },
+    { 125, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 102, 102 },
+    { 24, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 97, 97 },
+    { 127, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 60, 60 },
+    { 129, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 128, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 62, 62 },
+    { 25, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 25, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 25, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 131, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 58, 58 },
+    { 26, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 27, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 64, 64 },
+    { 134, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 1 },
+    { 134, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 134, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 134, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 135, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 135, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 135, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 135, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 135, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 137, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 137, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 29, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 139, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 140, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 140, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 140, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 140, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 30, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 31, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 2, 2 },
+    { 143, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 146, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 150, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 152, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 153, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 156, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 158, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 161, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 144, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 100, 100 },
+    { 145, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 111, 111 },
+    { 35, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 6, 6 },
+    { 147, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 4, 4 },
+    { 148, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 102, 102 },
+    { 149, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 111, 111 },
+    { 36, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 114, 114 },
+    { 151, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 58, 58 },
+    { 41, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 42, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 64, 64 },
+    { 154, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 1 },
+    { 154, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 154, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 154, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 155, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 155, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 155, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 155, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 155, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 43, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 157, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 157, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 44, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 159, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 160, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 160, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 160, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 160, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 45, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 46, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 2, 2 },
+    { 163, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 167, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 170, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 176, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 179, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 183, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 190, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 192, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 164, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 165, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 165, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 165, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 166, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 166, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 166, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 166, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 95, 95 },
+    { 166, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 48, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 168, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 169, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 169, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 49, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 171, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 173, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 33, 33 },
+    { 174, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 60, 60 },
+    { 172, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 175, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 62, 62 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 40, 45 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 47, 47 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 59, 62 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 123, 123 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 125, 125 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 50, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 61, 61 },
+    { 177, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 178, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 178, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 178, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 178, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 32, 32 },
+    { 51, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 180, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 4, 4 },
+    { 181, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 35, 35 },
+    { 182, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 182, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 52, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 184, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 185, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 34, 34 },
+    { 187, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 53, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 34, 34 },
+    { 186, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 188, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::EPSILON, 0, 0 },
+    { 189, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 92, 92 },
+    { 187, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 9 },
+    { 187, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 11, 33 },
+    { 187, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 35, 91 },
+    { 187, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 93, 255 },
+    { 187, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 1, 9 },
+    { 187, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM_RANGE, 11, 255 },
+    { 191, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 47, 47 },
+    { 54, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::INPUT_ATOM, 42, 42 },
+    { 55, ReflexCpp_::AutomatonApparatus_Lazy_InMemory_S8_T8_::NfaTransition_::CONDITIONAL, 2, 2 }
+};
+std::size_t const LazyScanner::ms_nfa_transition_count_ = sizeof(LazyScanner::ms_nfa_transition_table_) / sizeof(*LazyScanner::ms_nfa_transition_table_);
+
+std::uint32_t const LazyScanner::ms_accept_handler_count_ = 56;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const LazyScanner::ms_accept_handler_is_token_only_[] =
+{
+    false,
+    false,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    false,
+    false,
+    false,
+    true
+};
+LazyScanner::TokenId const LazyScanner::ms_accept_handler_token_id_[] =
+{
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const LazyScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    3,
+    -1,
+    -1,
+    -1,
+    4,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const LazyScanner::ms_keyword_slot_table_[] =
+{
+    { ">=", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "<=", 2, 3, 40 },
+    { "do", 2, 1, 4 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { ">=", 2, 1, 10 },
+    { "==", 2, 1, 10 },
+    { "<=", 2, 1, 10 },
+    { "for", 3, 1, 7 },
+    { "if", 2, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 4, 47 },
+    { "return", 6, 3, 33 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "do", 2, 3, 34 },
+    { "\x01\x66\x61", 3, 1, 9 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "==", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 3, 32 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 1, 3 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 4, 47 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "while", 5, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 4, 47 },
+    { "", 0, 0, 56 },
+    { "while", 5, 1, 7 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "\x01\x66\x61", 3, 3, 39 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 3, 32 },
+    { "while", 5, 4, 47 },
+    { "", 0, 0, 56 },
+    { "for", 3, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 }
+};
+std::uint16_t const LazyScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    1,
+    0,
+    3,
+    2,
+    1,
+    3,
+    0
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
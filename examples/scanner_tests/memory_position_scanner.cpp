@@ -0,0 +1,4154 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// memory_position_scanner.cpp generated by reflex
+// from memory_position_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "memory_position_scanner.hpp"
+
+
+MemoryPositionScanner::MemoryPositionScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_TrackingPosition_S8_T16_A8_(
+        ms_state_table_,
+        ms_state_count_,
+        ms_transition_table_,
+        ms_transition_count_,
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_)
+{
+
+    ResetForNewInput();
+}
+
+MemoryPositionScanner::~MemoryPositionScanner ()
+{
+}
+
+MemoryPositionScanner::StateMachine::Name MemoryPositionScanner::CurrentStateMachine () const
+{
+    assert(InitialState_() != NULL);
+    std::size_t initial_node_index = InitialState_() - ms_state_table_;
+    assert(initial_node_index < ms_state_count_);
+    switch (initial_node_index)
+    {
+        default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
+        case 0: return StateMachine::BLOCK_COMMENT;
+        case 8: return StateMachine::KEYWORDS;
+        case 25: return StateMachine::KEYWORDS_CASE_INSENSITIVE;
+        case 65: return StateMachine::KEYWORDS_UNGREEDY;
+        case 82: return StateMachine::MAIN;
+    }
+}
+
+void MemoryPositionScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::BLOCK_COMMENT ||
+        state_machine == StateMachine::KEYWORDS ||
+        state_machine == StateMachine::KEYWORDS_CASE_INSENSITIVE ||
+        state_machine == StateMachine::KEYWORDS_UNGREEDY ||
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(ms_state_table_ + ms_state_machine_start_state_index_[state_machine]);
+    ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+MemoryPositionScanner::ScannerCheckpoint MemoryPositionScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_TrackingPosition_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void MemoryPositionScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_TrackingPosition_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void MemoryPositionScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_TrackingPosition_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void MemoryPositionScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_TrackingPosition_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type MemoryPositionScanner::Scan () throw()
+{
+
+#line 47 "memory_position_scanner.reflex"
+
+    m_text.clear();
+
+#line 93 "memory_position_scanner.cpp"
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 59 "memory_position_scanner.reflex"
+
+    m_text.assign(rejected_string_data, rejected_string_length);
+    return Token::BAD_TOKEN;
+
+#line 138 "memory_position_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+
+#line 129 "memory_position_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::COMMENT;
+    
+#line 166 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 1:
+                {
+
+#line 136 "memory_position_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::UNTERMINATED_COMMENT;
+    
+#line 180 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 2:
+                {
+
+#line 150 "memory_position_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 190 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 4:
+                {
+
+#line 154 "memory_position_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 206 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 5:
+                {
+
+#line 157 "memory_position_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 216 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 6:
+                {
+
+#line 159 "memory_position_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 226 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 7:
+                {
+
+#line 161 "memory_position_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 236 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 8:
+                {
+
+#line 164 "memory_position_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 246 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 9:
+                {
+
+#line 167 "memory_position_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 256 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 10:
+                {
+
+#line 169 "memory_position_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 266 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 11:
+                {
+
+#line 172 "memory_position_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 276 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 12:
+                {
+
+#line 176 "memory_position_scanner.reflex"
+ KeepString(); 
+#line 286 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 13:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 14:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 15:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 16:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 17:
+                {
+
+#line 228 "memory_position_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 320 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 18:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 19:
+                {
+
+#line 232 "memory_position_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 336 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 20:
+                {
+
+#line 235 "memory_position_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 346 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 21:
+                {
+
+#line 237 "memory_position_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 356 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 22:
+                {
+
+#line 239 "memory_position_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 366 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 23:
+                {
+
+#line 242 "memory_position_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 376 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 24:
+                {
+
+#line 245 "memory_position_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 386 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 25:
+                {
+
+#line 247 "memory_position_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 396 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 26:
+                {
+
+#line 250 "memory_position_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 406 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 27:
+                {
+
+#line 254 "memory_position_scanner.reflex"
+ KeepString(); 
+#line 416 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 28:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 29:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 30:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 31:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 32:
+                {
+
+#line 189 "memory_position_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 450 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 33:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 34:
+                {
+
+#line 193 "memory_position_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 466 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 35:
+                {
+
+#line 196 "memory_position_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 476 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 36:
+                {
+
+#line 198 "memory_position_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 486 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 37:
+                {
+
+#line 200 "memory_position_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 496 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 38:
+                {
+
+#line 203 "memory_position_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 506 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 39:
+                {
+
+#line 206 "memory_position_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 516 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 40:
+                {
+
+#line 208 "memory_position_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 526 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 41:
+                {
+
+#line 211 "memory_position_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 536 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 42:
+                {
+
+#line 215 "memory_position_scanner.reflex"
+ KeepString(); 
+#line 546 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 43:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 44:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 45:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 46:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 47:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 48:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 49:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 50:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 51:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 52:
+                {
+
+#line 105 "memory_position_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::DIRECTIVE;
+    
+#line 613 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 53:
+                {
+
+#line 111 "memory_position_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::STRING;
+    
+#line 626 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 54:
+                {
+
+#line 118 "memory_position_scanner.reflex"
+
+        KeepString();
+        SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
+    
+#line 639 "memory_position_scanner.cpp"
+
+                }
+                break;
+
+                case 55:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 50 "memory_position_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 660 "memory_position_scanner.cpp"
+}
+
+std::size_t MemoryPositionScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::uint32_t MemoryPositionScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 6)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 63];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const MemoryPositionScanner::ms_state_machine_start_state_index_[] =
+{
+    0,
+    8,
+    25,
+    65,
+    82,
+};
+std::uint8_t const MemoryPositionScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+    0,
+    1,
+    2,
+    0,
+};
+std::uint32_t const MemoryPositionScanner::ms_state_machine_count_ = 5;
+
+// the order of the states indicates priority (only for accept states).
+// the lower the state's index in this array, the higher its priority.
+ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_TrackingPosition_S8_T16_A8_::DfaState_ const MemoryPositionScanner::ms_state_table_[] =
+{
+    { 0, 56, 32, 2, 0 },
+    { 32, 56, 33, 0, 0 },
+    { 65, 56, 32, 2, 0 },
+    { 97, 1, 33, 0, 0 },
+    { 130, 56, 32, 2, 0 },
+    { 162, 56, 33, 0, 0 },
+    { 195, 0, 0, 0, 0 },
+    { 195, 1, 33, 0, 0 },
+    { 228, 56, 32, 6, 0 },
+    { 260, 56, 33, 0, 0 },
+    { 293, 13, 33, 0, 1 },
+    { 326, 15, 33, 0, 2 },
+    { 359, 56, 33, 0, 0 },
+    { 392, 11, 0, 0, 0 },
+    { 392, 14, 33, 0, 3 },
+    { 425, 12, 0, 0, 0 },
+    { 425, 13, 33, 0, 0 },
+    { 458, 13, 32, 8, 0 },
+    { 490, 5, 33, 0, 0 },
+    { 523, 16, 33, 0, 0 },
+    { 556, 56, 33, 0, 0 },
+    { 589, 13, 33, 0, 0 },
+    { 622, 13, 33, 0, 0 },
+    { 655, 6, 33, 0, 0 },
+    { 688, 16, 33, 0, 0 },
+    { 721, 56, 32, 6, 0 },
+    { 753, 56, 33, 0, 0 },
+    { 786, 28, 33, 0, 0 },
+    { 819, 28, 33, 0, 1 },
+    { 852, 28, 33, 0, 0 },
+    { 885, 24, 33, 0, 0 },
+    { 918, 30, 33, 0, 2 },
+    { 951, 56, 33, 0, 0 },
+    { 984, 26, 0, 0, 0 },
+    { 984, 29, 33, 0, 0 },
+    { 1017, 29, 33, 0, 3 },
+    { 1050, 25, 33, 0, 0 },
+    { 1083, 27, 0, 0, 0 },
+    { 1083, 28, 33, 0, 0 },
+    { 1116, 19, 32, 8, 0 },
+    { 1148, 19, 33, 0, 0 },
+    { 1181, 28, 33, 0, 0 },
+    { 1214, 28, 33, 0, 0 },
+    { 1247, 28, 33, 0, 0 },
+    { 1280, 17, 33, 0, 0 },
+    { 1313, 28, 33, 0, 0 },
+    { 1346, 28, 33, 0, 0 },
+    { 1379, 22, 33, 0, 0 },
+    { 1412, 28, 33, 0, 0 },
+    { 1445, 28, 33, 0, 0 },
+    { 1478, 28, 33, 0, 0 },
+    { 1511, 28, 33, 0, 0 },
+    { 1544, 28, 33, 0, 0 },
+    { 1577, 28, 33, 0, 0 },
+    { 1610, 18, 33, 0, 0 },
+    { 1643, 28, 33, 0, 0 },
+    { 1676, 28, 33, 0, 0 },
+    { 1709, 28, 33, 0, 0 },
+    { 1742, 28, 33, 0, 0 },
+    { 1775, 31, 33, 0, 0 },
+    { 1808, 56, 33, 0, 0 },
+    { 1841, 28, 33, 0, 0 },
+    { 1874, 28, 33, 0, 0 },
+    { 1907, 21, 33, 0, 0 },
+    { 1940, 31, 33, 0, 0 },
+    { 1973, 56, 32, 6, 0 },
+    { 2005, 56, 33, 0, 0 },
+    { 2038, 43, 33, 0, 0 },
+    { 2071, 45, 33, 0, 0 },
+    { 2104, 56, 33, 0, 0 },
+    { 2137, 41, 0, 0, 0 },
+    { 2137, 44, 33, 0, 0 },
+    { 2170, 42, 0, 0, 0 },
+    { 2170, 43, 33, 0, 0 },
+    { 2203, 43, 32, 8, 0 },
+    { 2235, 35, 33, 0, 0 },
+    { 2268, 46, 33, 0, 0 },
+    { 2301, 56, 33, 0, 0 },
+    { 2334, 43, 33, 0, 0 },
+    { 2367, 43, 33, 0, 0 },
+    { 2400, 36, 33, 0, 0 },
+    { 2433, 46, 33, 0, 0 },
+    { 2466, 56, 32, 6, 0 },
+    { 2498, 56, 33, 0, 0 },
+    { 2531, 51, 33, 0, 2 },
+    { 2564, 56, 33, 0, 0 },
+    { 2597, 50, 0, 0, 0 },
+    { 2597, 56, 33, 0, 4 },
+    { 2630, 53, 0, 0, 0 },
+    { 2630, 56, 33, 0, 0 },
+    { 2663, 50, 33, 0, 0 },
+    { 2696, 54, 0, 0, 0 },
+    { 2696, 49, 33, 0, 5 },
+    { 2729, 50, 33, 0, 0 },
+    { 2762, 48, 33, 0, 1 },
+    { 2795, 55, 33, 0, 0 },
+    { 2828, 56, 33, 0, 0 },
+    { 2861, 52, 33, 0, 6 },
+    { 2894, 55, 33, 0, 0 }
+};
+std::size_t const MemoryPositionScanner::ms_state_count_ = sizeof(MemoryPositionScanner::ms_state_table_) / sizeof(*MemoryPositionScanner::ms_state_table_);
+
+ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_TrackingPosition_S8_T16_A8_::DfaTransition_ const MemoryPositionScanner::ms_transition_table_[] =
+{
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 99 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 4 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 99 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 4 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 99 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 4 },
+    { 6 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 99 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 4 },
+    { 6 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 9 },
+    { 9 },
+    { 19 },
+    { 19 },
+    { 20 },
+    { 20 },
+    { 24 },
+    { 24 },
+    { 9 },
+    { 9 },
+    { 19 },
+    { 19 },
+    { 20 },
+    { 20 },
+    { 24 },
+    { 24 },
+    { 9 },
+    { 9 },
+    { 19 },
+    { 19 },
+    { 20 },
+    { 20 },
+    { 24 },
+    { 24 },
+    { 9 },
+    { 9 },
+    { 19 },
+    { 19 },
+    { 20 },
+    { 20 },
+    { 24 },
+    { 24 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 11 },
+    { 11 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 12 },
+    { 14 },
+    { 14 },
+    { 15 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 16 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 11 },
+    { 11 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 13 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 14 },
+    { 14 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 17 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 11 },
+    { 11 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 12 },
+    { 14 },
+    { 14 },
+    { 15 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 16 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 11 },
+    { 11 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 12 },
+    { 14 },
+    { 14 },
+    { 15 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 16 },
+    { 10 },
+    { 21 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 22 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 23 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 99 },
+    { 11 },
+    { 11 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 12 },
+    { 14 },
+    { 14 },
+    { 15 },
+    { 10 },
+    { 99 },
+    { 10 },
+    { 10 },
+    { 16 },
+    { 10 },
+    { 21 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 10 },
+    { 26 },
+    { 26 },
+    { 59 },
+    { 59 },
+    { 60 },
+    { 60 },
+    { 64 },
+    { 64 },
+    { 26 },
+    { 26 },
+    { 59 },
+    { 59 },
+    { 60 },
+    { 60 },
+    { 64 },
+    { 64 },
+    { 26 },
+    { 26 },
+    { 59 },
+    { 59 },
+    { 60 },
+    { 60 },
+    { 64 },
+    { 64 },
+    { 26 },
+    { 26 },
+    { 59 },
+    { 59 },
+    { 60 },
+    { 60 },
+    { 64 },
+    { 64 },
+    { 99 },
+    { 27 },
+    { 99 },
+    { 31 },
+    { 31 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 32 },
+    { 34 },
+    { 34 },
+    { 37 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 38 },
+    { 41 },
+    { 45 },
+    { 28 },
+    { 48 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 49 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 55 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 29 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 30 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 31 },
+    { 31 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 33 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 35 },
+    { 36 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 35 },
+    { 35 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 35 },
+    { 35 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 39 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 40 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 42 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 43 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 44 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 46 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 47 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 44 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 50 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 51 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 52 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 53 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 54 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 56 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 57 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 58 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 47 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 27 },
+    { 99 },
+    { 31 },
+    { 31 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 32 },
+    { 34 },
+    { 34 },
+    { 37 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 38 },
+    { 41 },
+    { 45 },
+    { 28 },
+    { 48 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 49 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 55 },
+    { 99 },
+    { 27 },
+    { 99 },
+    { 31 },
+    { 31 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 32 },
+    { 34 },
+    { 34 },
+    { 37 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 38 },
+    { 41 },
+    { 61 },
+    { 28 },
+    { 48 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 49 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 55 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 62 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 63 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 99 },
+    { 27 },
+    { 99 },
+    { 31 },
+    { 31 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 32 },
+    { 34 },
+    { 34 },
+    { 37 },
+    { 28 },
+    { 99 },
+    { 28 },
+    { 28 },
+    { 38 },
+    { 41 },
+    { 61 },
+    { 28 },
+    { 48 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 49 },
+    { 28 },
+    { 28 },
+    { 28 },
+    { 55 },
+    { 66 },
+    { 66 },
+    { 76 },
+    { 76 },
+    { 77 },
+    { 77 },
+    { 81 },
+    { 81 },
+    { 66 },
+    { 66 },
+    { 76 },
+    { 76 },
+    { 77 },
+    { 77 },
+    { 81 },
+    { 81 },
+    { 66 },
+    { 66 },
+    { 76 },
+    { 76 },
+    { 77 },
+    { 77 },
+    { 81 },
+    { 81 },
+    { 66 },
+    { 66 },
+    { 76 },
+    { 76 },
+    { 77 },
+    { 77 },
+    { 81 },
+    { 81 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 68 },
+    { 68 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 69 },
+    { 71 },
+    { 71 },
+    { 72 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 73 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 68 },
+    { 68 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 70 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 71 },
+    { 71 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 74 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 75 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 68 },
+    { 68 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 69 },
+    { 71 },
+    { 71 },
+    { 72 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 73 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 68 },
+    { 68 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 69 },
+    { 71 },
+    { 71 },
+    { 72 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 73 },
+    { 67 },
+    { 78 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 79 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 80 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 99 },
+    { 68 },
+    { 68 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 69 },
+    { 71 },
+    { 71 },
+    { 72 },
+    { 67 },
+    { 99 },
+    { 67 },
+    { 67 },
+    { 73 },
+    { 67 },
+    { 78 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 67 },
+    { 83 },
+    { 83 },
+    { 95 },
+    { 95 },
+    { 96 },
+    { 96 },
+    { 98 },
+    { 98 },
+    { 83 },
+    { 83 },
+    { 95 },
+    { 95 },
+    { 96 },
+    { 96 },
+    { 98 },
+    { 98 },
+    { 83 },
+    { 83 },
+    { 95 },
+    { 95 },
+    { 96 },
+    { 96 },
+    { 98 },
+    { 98 },
+    { 83 },
+    { 83 },
+    { 95 },
+    { 95 },
+    { 96 },
+    { 96 },
+    { 98 },
+    { 98 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 84 },
+    { 84 },
+    { 85 },
+    { 87 },
+    { 99 },
+    { 86 },
+    { 86 },
+    { 90 },
+    { 92 },
+    { 99 },
+    { 93 },
+    { 93 },
+    { 99 },
+    { 94 },
+    { 99 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 84 },
+    { 84 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 86 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 99 },
+    { 87 },
+    { 88 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 89 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 99 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 99 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 87 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 91 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 92 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 86 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 94 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 94 },
+    { 99 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 84 },
+    { 84 },
+    { 85 },
+    { 87 },
+    { 99 },
+    { 86 },
+    { 86 },
+    { 90 },
+    { 92 },
+    { 99 },
+    { 93 },
+    { 93 },
+    { 99 },
+    { 94 },
+    { 99 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 84 },
+    { 84 },
+    { 85 },
+    { 87 },
+    { 97 },
+    { 86 },
+    { 86 },
+    { 90 },
+    { 92 },
+    { 99 },
+    { 93 },
+    { 93 },
+    { 99 },
+    { 94 },
+    { 99 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 97 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 84 },
+    { 84 },
+    { 85 },
+    { 87 },
+    { 97 },
+    { 86 },
+    { 86 },
+    { 90 },
+    { 92 },
+    { 99 },
+    { 93 },
+    { 93 },
+    { 99 },
+    { 94 },
+    { 99 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 },
+    { 94 }
+};
+std::size_t const MemoryPositionScanner::ms_transition_count_ = sizeof(MemoryPositionScanner::ms_transition_table_) / sizeof(*MemoryPositionScanner::ms_transition_table_);
+
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 33 atom classes.
+std::uint8_t const MemoryPositionScanner::ms_atom_class_table_[256] =
+{
+    0, 1, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 5, 6, 7, 2, 2, 2, 2, 8, 8, 9, 8, 8, 8, 2, 10,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 8, 13, 14, 13, 2,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 2, 17, 2, 2, 16,
+    2, 18, 19, 19, 20, 21, 22, 19, 23, 24, 19, 19, 25, 19, 26, 27,
+    19, 19, 28, 29, 30, 31, 19, 32, 19, 19, 19, 8, 2, 8, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const MemoryPositionScanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 60, 0, 0, 0 },
+        { 62, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 251, 255, 255, 255, 255, 255, 255, 239, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        4, false,
+        { 1, 11, 35, 93 },
+        { 9, 33, 91, 255 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 97, 0, 0, 0 },
+        { 122, 0, 0, 0 }
+    }
+};
+std::size_t const MemoryPositionScanner::ms_skip_set_count_ = sizeof(MemoryPositionScanner::ms_skip_set_table_) / sizeof(*MemoryPositionScanner::ms_skip_set_table_);
+
+std::uint32_t const MemoryPositionScanner::ms_accept_handler_count_ = 56;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const MemoryPositionScanner::ms_accept_handler_is_token_only_[] =
+{
+    false,
+    false,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    false,
+    false,
+    false,
+    true
+};
+MemoryPositionScanner::TokenId const MemoryPositionScanner::ms_accept_handler_token_id_[] =
+{
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const MemoryPositionScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    3,
+    -1,
+    -1,
+    -1,
+    4,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const MemoryPositionScanner::ms_keyword_slot_table_[] =
+{
+    { ">=", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "<=", 2, 3, 40 },
+    { "do", 2, 1, 4 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { ">=", 2, 1, 10 },
+    { "==", 2, 1, 10 },
+    { "<=", 2, 1, 10 },
+    { "for", 3, 1, 7 },
+    { "if", 2, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 4, 47 },
+    { "return", 6, 3, 33 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "do", 2, 3, 34 },
+    { "\x01\x66\x61", 3, 1, 9 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "==", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 3, 32 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 1, 3 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 4, 47 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "while", 5, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 4, 47 },
+    { "", 0, 0, 56 },
+    { "while", 5, 1, 7 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "\x01\x66\x61", 3, 3, 39 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 3, 32 },
+    { "while", 5, 4, 47 },
+    { "", 0, 0, 56 },
+    { "for", 3, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 }
+};
+std::uint16_t const MemoryPositionScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    1,
+    0,
+    3,
+    2,
+    1,
+    3,
+    0
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
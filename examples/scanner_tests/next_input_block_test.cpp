@@ -0,0 +1,39 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that an interactive scanner reading its input with
+// return_next_input_block produces the same tokens as plain Scan, when the
+// input source returns fewer atoms than asked for (blocks of at most 1 to 5
+// atoms), for a block capacity of 1, of 4, and of the size of the buffer.
+
+#include <string>
+#include "block_scanner.hpp"
+#include "reference_scanner.hpp"
+
+int main ()
+{
+    static std::size_t const INPUT_READAHEADS[] = { 1, 4, 0 };
+
+    InputGenerator generator;
+    int failure_count = 0;
+    for (int i = 0; i < 2000 && failure_count < 10; ++i)
+    {
+        std::string input(generator.Input(24));
+
+        ReferenceScanner reference_scanner;
+        reference_scanner.InputSpan(input.data(), input.data() + input.size());
+        std::string expected(ScanTokens(reference_scanner));
+
+        for (std::size_t input_readahead : INPUT_READAHEADS)
+        {
+            for (std::size_t max_block_size = 1; max_block_size <= 5; ++max_block_size)
+            {
+                BlockScanner scanner;
+                scanner.InputReadahead(input_readahead);
+                scanner.m_block_input = input;
+                scanner.m_max_block_size = max_block_size;
+                failure_count += CheckTokenRecord("return_next_input_block", input, expected, ScanTokens(scanner));
+            }
+        }
+    }
+    return failure_count == 0 ? 0 : 1;
+}
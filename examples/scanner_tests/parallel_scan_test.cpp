@@ -0,0 +1,103 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that alternating ScanParallel with Scan (wherever ScanParallel stops
+// short) produces the same tokens as Scan alone, for 1, 2, 4 and 7 threads,
+// and that ScanParallel reports contiguous offsets and lengths.  The inputs
+// are large enough to be split into several chunks, and have directives and
+// comments placed across the chunk boundaries, so that the speculative scan
+// of a chunk begins in the middle of a token.  Each call to ScanParallel
+// after Scan has handled a token reuses the chunks of the first call.
+
+#include <string>
+#include <vector>
+#include "parallel_scanner.hpp"
+#include "reference_scanner.hpp"
+
+// the size of the chunks ScanParallel doesn't split the input below.
+static std::size_t const MIN_CHUNK_SIZE = 64*1024;
+static std::size_t const THREAD_COUNTS[] = { 1, 2, 4, 7 };
+
+// Overwrites the input around each of the chunk boundaries ScanParallel would
+// use for thread_count threads (when called at the start of input) with a
+// directive or a comment, so that the boundary falls inside it.
+void PlaceAcrossChunkBoundaries (std::string &input, std::size_t thread_count)
+{
+    static char const *const FRAGMENTS[] = { "\n#directive ", "/* crosses a chunk boundary */" };
+
+    std::size_t chunk_count = thread_count;
+    if (chunk_count > input.size() / MIN_CHUNK_SIZE)
+        chunk_count = input.size() / MIN_CHUNK_SIZE;
+    for (std::size_t i = 1; i < chunk_count; ++i)
+    {
+        std::string fragment(FRAGMENTS[i % 2]);
+        input.replace(input.size() / chunk_count * i - fragment.size() / 2, fragment.size(), fragment);
+    }
+}
+
+std::string ScanTokensInParallel (ParallelScanner &scanner, std::size_t input_size, std::size_t thread_count)
+{
+    std::vector<ParallelScanner::TokenId> token_ids;
+    std::vector<std::size_t> token_offsets;
+    std::vector<std::size_t> token_lengths;
+    std::string token_record;
+    // the offset of the next token
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < 10000000; ++i)
+    {
+        token_ids.clear();
+        token_offsets.clear();
+        token_lengths.clear();
+        std::size_t token_count = scanner.ScanParallel(token_ids, token_offsets, token_lengths, thread_count);
+        if (token_count != token_ids.size() || token_count != token_offsets.size() || token_count != token_lengths.size())
+            return token_record + "<" + std::to_string(token_count) + " tokens appended>";
+        for (std::size_t t = 0; t < token_count; ++t)
+        {
+            if (token_offsets[t] != offset || token_lengths[t] == 0)
+                return token_record + "<token at offset " + std::to_string(token_offsets[t]) + " with length " + std::to_string(token_lengths[t]) + ">";
+            RecordToken(token_record, token_ids[t], std::string());
+            offset += token_lengths[t];
+        }
+
+        // Every token Scan must handle instead records the string it handled,
+        // except the end of input.
+        Token::Type token = scanner.Scan();
+        RecordToken(token_record, token, scanner.m_text);
+        offset += scanner.m_text.size();
+        if (token == Token::END_OF_INPUT)
+            break;
+    }
+    if (offset != input_size)
+        token_record += "<ended at offset " + std::to_string(offset) + ">";
+    return token_record;
+}
+
+int main ()
+{
+    InputGenerator generator;
+    int failure_count = 0;
+    // The inputs are large, so the test stops at the first failure, rather
+    // than printing several of them.
+    for (int i = 0; i < 8 && failure_count == 0; ++i)
+    {
+        // at least two chunks, and up to 7 at the minimum chunk size.
+        std::size_t const input_size = 2*MIN_CHUNK_SIZE + generator.Next(5*MIN_CHUNK_SIZE);
+        std::string input;
+        while (input.size() < input_size)
+            input += generator.Input(64);
+        input.resize(input_size);
+        // (one thread makes no boundaries)
+        PlaceAcrossChunkBoundaries(input, THREAD_COUNTS[1 + i % 3]);
+
+        ReferenceScanner reference_scanner;
+        reference_scanner.InputSpan(input.data(), input.data() + input.size());
+        std::string expected(ScanTokens(reference_scanner));
+
+        for (std::size_t thread_count : THREAD_COUNTS)
+        {
+            ParallelScanner scanner;
+            scanner.InputSpan(input.data(), input.data() + input.size());
+            failure_count += CheckTokenRecord("ScanParallel", input, expected, ScanTokensInParallel(scanner, input.size(), thread_count));
+        }
+    }
+    return failure_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that a scanner with generate_profiling_code produces the same tokens
+// as plain Scan, and that the counts in its ProfileReport agree with those
+// tokens -- the number of atoms scanned, and the number of accepts of each
+// rule (and of rejections), which are matched to the tokens they produce.
+// ResetProfile is called before each input, so the counts are per input.
+
+#include <map>
+#include <sstream>
+#include <string>
+#include "profiling_scanner.hpp"
+#include "reference_scanner.hpp"
+
+// The token produced by each rule, as named in ProfileReport.  "MAIN (/\*)"
+// produces no token of its own, and is checked against the comment tokens.
+static struct { char const *m_rule; Token::Type m_token; } const RULE_TOKENS[] = {
+    { R"rule(MAIN (if|else|while|return))rule", Token::KEYWORD },
+    { R"rule(MAIN ({IDENTIFIER}))rule", Token::IDENTIFIER },
+    { R"rule(MAIN ({INTEGER}))rule", Token::INTEGER },
+    { R"rule(MAIN ({OPERATOR}))rule", Token::OPERATOR },
+    { R"rule(MAIN ({WHITESPACE}))rule", Token::WHITESPACE },
+    { R"rule(MAIN (^#[a-z]*))rule", Token::DIRECTIVE },
+    { R"rule(MAIN ({STRING_LITERAL}))rule", Token::STRING },
+    { R"rule(BLOCK_COMMENT (([^*]|\*+[^*/])*\*+/))rule", Token::COMMENT },
+    { R"rule(BLOCK_COMMENT (([^*]|\*+[^*/])*\**\z))rule", Token::UNTERMINATED_COMMENT },
+    { R"rule(MAIN (\z))rule", Token::END_OF_INPUT },
+    { "rejected", Token::BAD_TOKEN },
+};
+
+// Returns the counts of ProfileReport, keyed by "scanned atoms" or by the
+// rule (or "rejected") for the accepts per rule.
+std::map<std::string, std::size_t> ParseProfileReport (std::string const &report)
+{
+    std::map<std::string, std::size_t> counts;
+    std::istringstream in(report);
+    std::string line;
+    bool is_in_accepts = false;
+    while (std::getline(in, line))
+    {
+        std::size_t text_begin = line.find_first_not_of(' ');
+        if (text_begin == std::string::npos)
+            continue;
+        std::string text(line.substr(text_begin));
+        if (text.compare(0, 8, "scanned ") == 0)
+            counts["scanned atoms"] = std::stoul(text.substr(8));
+        else if (text == "accepts per rule:")
+            is_in_accepts = true;
+        else if (text == "visits per DFA state:")
+            is_in_accepts = false;
+        else if (is_in_accepts && text.find('\t') != std::string::npos)
+            counts[text.substr(text.find('\t') + 1)] = std::stoul(text);
+    }
+    return counts;
+}
+
+int main ()
+{
+    InputGenerator generator;
+    ProfilingScanner scanner;
+    int failure_count = 0;
+    for (int i = 0; i < 2000 && failure_count < 10; ++i)
+    {
+        std::string input(generator.Input(24));
+
+        ReferenceScanner reference_scanner;
+        reference_scanner.InputSpan(input.data(), input.data() + input.size());
+        std::string expected(ScanTokens(reference_scanner));
+
+        scanner.ResetProfile();
+        scanner.InputSpan(input.data(), input.data() + input.size());
+        std::map<Token::Type, std::size_t> token_counts;
+        std::string actual;
+        for (std::size_t t = 0; t < 100000; ++t)
+        {
+            Token::Type token = scanner.Scan();
+            RecordToken(actual, token, scanner.m_text);
+            ++token_counts[token];
+            if (token == Token::END_OF_INPUT)
+                break;
+        }
+        failure_count += CheckTokenRecord("profiling", input, expected, actual);
+
+        // Make records of the expected and reported counts, to compare them.
+        std::ostringstream report;
+        scanner.ProfileReport(report);
+        std::map<std::string, std::size_t> counts(ParseProfileReport(report.str()));
+        std::string expected_counts("scanned atoms " + std::to_string(input.size()) + ", ");
+        std::string reported_counts("scanned atoms " + std::to_string(counts["scanned atoms"]) + ", ");
+        for (auto const &rule_token : RULE_TOKENS)
+        {
+            expected_counts += std::string(rule_token.m_rule) + " " + std::to_string(token_counts[rule_token.m_token]) + ", ";
+            reported_counts += std::string(rule_token.m_rule) + " " + std::to_string(counts[rule_token.m_rule]) + ", ";
+        }
+        expected_counts += R"rule(MAIN (/\*) )rule" + std::to_string(token_counts[Token::COMMENT] + token_counts[Token::UNTERMINATED_COMMENT]);
+        reported_counts += R"rule(MAIN (/\*) )rule" + std::to_string(counts[R"rule(MAIN (/\*))rule"]);
+        failure_count += CheckTokenRecord("ProfileReport", input, expected_counts, reported_counts);
+    }
+    return failure_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that push-mode scanners produce the same tokens as plain Scan when
+// the input is fed in pieces of 0 to 5 atoms, so that most tokens are split
+// across several calls to Feed.  Each DFA implementation suspends and resumes
+// a partial token differently, so each one is tested.
+
+#include <algorithm>
+#include <string>
+#include "direct_push_scanner.hpp"
+#include "lazy_push_scanner.hpp"
+#include "push_scanner.hpp"
+#include "reference_scanner.hpp"
+
+template <typename Scanner_>
+std::string ScanTokensFedInPieces (Scanner_ &scanner, std::string const &input, InputGenerator &generator)
+{
+    std::string token_record;
+    // the number of atoms of input fed so far
+    std::size_t fed = 0;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        Token::Type token = scanner.Scan();
+        if (token == Token::NEED_MORE_INPUT)
+        {
+            if (scanner.IsAtEndOfInput())
+                return token_record + "<needs more input after the end of input>";
+            if (fed == input.size())
+            {
+                scanner.FeedEndOfInput();
+            }
+            else
+            {
+                std::size_t piece_size = std::min(generator.Next(6), input.size() - fed);
+                scanner.Feed(input.data() + fed, piece_size);
+                fed += piece_size;
+            }
+            continue;
+        }
+        RecordToken(token_record, token, scanner.m_text);
+        if (token == Token::END_OF_INPUT)
+            break;
+    }
+    return token_record;
+}
+
+int main ()
+{
+    InputGenerator generator;
+    int failure_count = 0;
+    for (int i = 0; i < 2000 && failure_count < 10; ++i)
+    {
+        std::string input(generator.Input(24));
+
+        ReferenceScanner reference_scanner;
+        reference_scanner.InputSpan(input.data(), input.data() + input.size());
+        std::string expected(ScanTokens(reference_scanner));
+
+        {
+            PushScanner scanner;
+            failure_count += CheckTokenRecord("table-driven push", input, expected, ScanTokensFedInPieces(scanner, input, generator));
+        }
+        {
+            DirectPushScanner scanner;
+            failure_count += CheckTokenRecord("direct-coded push", input, expected, ScanTokensFedInPieces(scanner, input, generator));
+        }
+        {
+            LazyPushScanner scanner;
+            failure_count += CheckTokenRecord("lazy push", input, expected, ScanTokensFedInPieces(scanner, input, generator));
+        }
+    }
+    return failure_count == 0 ? 0 : 1;
+}
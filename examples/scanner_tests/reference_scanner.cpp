@@ -0,0 +1,5983 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// reference_scanner.cpp generated by reflex
+// from reference_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "reference_scanner.hpp"
+
+
+ReferenceScanner::ReferenceScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_S8_T16_A8_(
+        ms_state_table_,
+        ms_state_count_,
+        ms_transition_table_,
+        ms_transition_count_,
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_)
+{
+
+    ResetForNewInput();
+}
+
+ReferenceScanner::~ReferenceScanner ()
+{
+}
+
+ReferenceScanner::StateMachine::Name ReferenceScanner::CurrentStateMachine () const
+{
+    assert(InitialState_() != NULL);
+    std::size_t initial_node_index = InitialState_() - ms_state_table_;
+    assert(initial_node_index < ms_state_count_);
+    switch (initial_node_index)
+    {
+        default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
+        case 0: return StateMachine::BLOCK_COMMENT;
+        case 8: return StateMachine::KEYWORDS;
+        case 48: return StateMachine::KEYWORDS_CASE_INSENSITIVE;
+        case 88: return StateMachine::KEYWORDS_UNGREEDY;
+        case 128: return StateMachine::MAIN;
+    }
+}
+
+void ReferenceScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::BLOCK_COMMENT ||
+        state_machine == StateMachine::KEYWORDS ||
+        state_machine == StateMachine::KEYWORDS_CASE_INSENSITIVE ||
+        state_machine == StateMachine::KEYWORDS_UNGREEDY ||
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(ms_state_table_ + ms_state_machine_start_state_index_[state_machine]);
+    ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+ReferenceScanner::ScannerCheckpoint ReferenceScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void ReferenceScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void ReferenceScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void ReferenceScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type ReferenceScanner::Scan () throw()
+{
+
+#line 47 "reference_scanner.reflex"
+
+    m_text.clear();
+
+#line 93 "reference_scanner.cpp"
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 59 "reference_scanner.reflex"
+
+    m_text.assign(rejected_string_data, rejected_string_length);
+    return Token::BAD_TOKEN;
+
+#line 137 "reference_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+
+#line 129 "reference_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::COMMENT;
+    
+#line 165 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 1:
+                {
+
+#line 136 "reference_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::UNTERMINATED_COMMENT;
+    
+#line 179 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 2:
+                {
+
+#line 150 "reference_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 189 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 4:
+                {
+
+#line 154 "reference_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 205 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 5:
+                {
+
+#line 157 "reference_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 215 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 6:
+                {
+
+#line 159 "reference_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 225 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 7:
+                {
+
+#line 161 "reference_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 235 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 8:
+                {
+
+#line 164 "reference_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 245 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 9:
+                {
+
+#line 167 "reference_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 255 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 10:
+                {
+
+#line 169 "reference_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 265 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 11:
+                {
+
+#line 172 "reference_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 275 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 12:
+                {
+
+#line 176 "reference_scanner.reflex"
+ KeepString(); 
+#line 285 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 13:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 14:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 15:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 16:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 17:
+                {
+
+#line 228 "reference_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 319 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 18:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 19:
+                {
+
+#line 232 "reference_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 335 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 20:
+                {
+
+#line 235 "reference_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 345 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 21:
+                {
+
+#line 237 "reference_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 355 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 22:
+                {
+
+#line 239 "reference_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 365 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 23:
+                {
+
+#line 242 "reference_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 375 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 24:
+                {
+
+#line 245 "reference_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 385 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 25:
+                {
+
+#line 247 "reference_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 395 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 26:
+                {
+
+#line 250 "reference_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 405 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 27:
+                {
+
+#line 254 "reference_scanner.reflex"
+ KeepString(); 
+#line 415 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 28:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 29:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 30:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 31:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 32:
+                {
+
+#line 189 "reference_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 449 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 33:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 34:
+                {
+
+#line 193 "reference_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 465 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 35:
+                {
+
+#line 196 "reference_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 475 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 36:
+                {
+
+#line 198 "reference_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 485 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 37:
+                {
+
+#line 200 "reference_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 495 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 38:
+                {
+
+#line 203 "reference_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 505 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 39:
+                {
+
+#line 206 "reference_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 515 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 40:
+                {
+
+#line 208 "reference_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 525 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 41:
+                {
+
+#line 211 "reference_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 535 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 42:
+                {
+
+#line 215 "reference_scanner.reflex"
+ KeepString(); 
+#line 545 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 43:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 44:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 45:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 46:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 47:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 48:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 49:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 50:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 51:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 52:
+                {
+
+#line 105 "reference_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::DIRECTIVE;
+    
+#line 612 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 53:
+                {
+
+#line 111 "reference_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::STRING;
+    
+#line 625 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 54:
+                {
+
+#line 118 "reference_scanner.reflex"
+
+        KeepString();
+        SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
+    
+#line 638 "reference_scanner.cpp"
+
+                }
+                break;
+
+                case 55:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 50 "reference_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 659 "reference_scanner.cpp"
+}
+
+std::size_t ReferenceScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const ReferenceScanner::ms_state_machine_start_state_index_[] =
+{
+    0,
+    8,
+    48,
+    88,
+    128,
+};
+std::uint8_t const ReferenceScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+    0,
+    1,
+    2,
+    0,
+};
+std::uint32_t const ReferenceScanner::ms_state_machine_count_ = 5;
+
+// the order of the states indicates priority (only for accept states).
+// the lower the state's index in this array, the higher its priority.
+ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_S8_T16_A8_::DfaState_ const ReferenceScanner::ms_state_table_[] =
+{
+    { 0, 56, 32, 2, 0 },
+    { 32, 56, 33, 0, 0 },
+    { 65, 56, 32, 2, 0 },
+    { 97, 1, 33, 0, 0 },
+    { 130, 56, 32, 2, 0 },
+    { 162, 56, 33, 0, 0 },
+    { 195, 0, 0, 0, 0 },
+    { 195, 1, 33, 0, 0 },
+    { 228, 56, 32, 6, 0 },
+    { 260, 56, 33, 0, 0 },
+    { 293, 13, 33, 0, 0 },
+    { 326, 13, 33, 0, 1 },
+    { 359, 13, 33, 0, 0 },
+    { 392, 9, 33, 0, 0 },
+    { 425, 15, 33, 0, 2 },
+    { 458, 56, 33, 0, 0 },
+    { 491, 11, 0, 0, 0 },
+    { 491, 14, 33, 0, 0 },
+    { 524, 14, 33, 0, 3 },
+    { 557, 10, 33, 0, 0 },
+    { 590, 12, 0, 0, 0 },
+    { 590, 13, 33, 0, 0 },
+    { 623, 4, 32, 8, 0 },
+    { 655, 4, 33, 0, 0 },
+    { 688, 13, 33, 0, 0 },
+    { 721, 13, 33, 0, 0 },
+    { 754, 13, 33, 0, 0 },
+    { 787, 2, 33, 0, 0 },
+    { 820, 13, 33, 0, 0 },
+    { 853, 13, 33, 0, 0 },
+    { 886, 7, 33, 0, 0 },
+    { 919, 13, 33, 0, 0 },
+    { 952, 13, 33, 0, 0 },
+    { 985, 13, 33, 0, 0 },
+    { 1018, 13, 33, 0, 0 },
+    { 1051, 13, 33, 0, 0 },
+    { 1084, 13, 33, 0, 0 },
+    { 1117, 3, 33, 0, 0 },
+    { 1150, 13, 33, 0, 0 },
+    { 1183, 13, 33, 0, 0 },
+    { 1216, 13, 33, 0, 0 },
+    { 1249, 13, 33, 0, 0 },
+    { 1282, 16, 33, 0, 0 },
+    { 1315, 56, 33, 0, 0 },
+    { 1348, 13, 33, 0, 0 },
+    { 1381, 13, 33, 0, 0 },
+    { 1414, 6, 33, 0, 0 },
+    { 1447, 16, 33, 0, 0 },
+    { 1480, 56, 32, 6, 0 },
+    { 1512, 56, 33, 0, 0 },
+    { 1545, 28, 33, 0, 0 },
+    { 1578, 28, 33, 0, 1 },
+    { 1611, 28, 33, 0, 0 },
+    { 1644, 24, 33, 0, 0 },
+    { 1677, 30, 33, 0, 2 },
+    { 1710, 56, 33, 0, 0 },
+    { 1743, 26, 0, 0, 0 },
+    { 1743, 29, 33, 0, 0 },
+    { 1776, 29, 33, 0, 3 },
+    { 1809, 25, 33, 0, 0 },
+    { 1842, 27, 0, 0, 0 },
+    { 1842, 28, 33, 0, 0 },
+    { 1875, 19, 32, 8, 0 },
+    { 1907, 19, 33, 0, 0 },
+    { 1940, 28, 33, 0, 0 },
+    { 1973, 28, 33, 0, 0 },
+    { 2006, 28, 33, 0, 0 },
+    { 2039, 17, 33, 0, 0 },
+    { 2072, 28, 33, 0, 0 },
+    { 2105, 28, 33, 0, 0 },
+    { 2138, 22, 33, 0, 0 },
+    { 2171, 28, 33, 0, 0 },
+    { 2204, 28, 33, 0, 0 },
+    { 2237, 28, 33, 0, 0 },
+    { 2270, 28, 33, 0, 0 },
+    { 2303, 28, 33, 0, 0 },
+    { 2336, 28, 33, 0, 0 },
+    { 2369, 18, 33, 0, 0 },
+    { 2402, 28, 33, 0, 0 },
+    { 2435, 28, 33, 0, 0 },
+    { 2468, 28, 33, 0, 0 },
+    { 2501, 28, 33, 0, 0 },
+    { 2534, 31, 33, 0, 0 },
+    { 2567, 56, 33, 0, 0 },
+    { 2600, 28, 33, 0, 0 },
+    { 2633, 28, 33, 0, 0 },
+    { 2666, 21, 33, 0, 0 },
+    { 2699, 31, 33, 0, 0 },
+    { 2732, 56, 32, 6, 0 },
+    { 2764, 56, 33, 0, 0 },
+    { 2797, 43, 33, 0, 0 },
+    { 2830, 43, 33, 0, 0 },
+    { 2863, 43, 33, 0, 0 },
+    { 2896, 39, 33, 0, 0 },
+    { 2929, 45, 33, 0, 0 },
+    { 2962, 56, 33, 0, 0 },
+    { 2995, 41, 0, 0, 0 },
+    { 2995, 44, 33, 0, 0 },
+    { 3028, 44, 33, 0, 3 },
+    { 3061, 40, 33, 0, 0 },
+    { 3094, 42, 0, 0, 0 },
+    { 3094, 43, 33, 0, 0 },
+    { 3127, 34, 32, 8, 0 },
+    { 3159, 34, 33, 0, 0 },
+    { 3192, 43, 33, 0, 0 },
+    { 3225, 43, 33, 0, 0 },
+    { 3258, 43, 33, 0, 0 },
+    { 3291, 32, 33, 0, 0 },
+    { 3324, 43, 33, 0, 0 },
+    { 3357, 43, 33, 0, 0 },
+    { 3390, 37, 33, 0, 0 },
+    { 3423, 43, 33, 0, 0 },
+    { 3456, 43, 33, 0, 0 },
+    { 3489, 43, 33, 0, 0 },
+    { 3522, 43, 33, 0, 0 },
+    { 3555, 43, 33, 0, 0 },
+    { 3588, 43, 33, 0, 0 },
+    { 3621, 33, 33, 0, 0 },
+    { 3654, 43, 33, 0, 0 },
+    { 3687, 43, 33, 0, 0 },
+    { 3720, 43, 33, 0, 0 },
+    { 3753, 43, 33, 0, 0 },
+    { 3786, 46, 33, 0, 0 },
+    { 3819, 56, 33, 0, 0 },
+    { 3852, 43, 33, 0, 0 },
+    { 3885, 43, 33, 0, 0 },
+    { 3918, 36, 33, 0, 0 },
+    { 3951, 46, 33, 0, 0 },
+    { 3984, 56, 32, 6, 0 },
+    { 4016, 56, 33, 0, 0 },
+    { 4049, 51, 33, 0, 2 },
+    { 4082, 56, 33, 0, 0 },
+    { 4115, 50, 0, 0, 0 },
+    { 4115, 56, 33, 0, 4 },
+    { 4148, 53, 0, 0, 0 },
+    { 4148, 56, 33, 0, 0 },
+    { 4181, 50, 33, 0, 0 },
+    { 4214, 54, 0, 0, 0 },
+    { 4214, 49, 33, 0, 5 },
+    { 4247, 50, 33, 0, 0 },
+    { 4280, 48, 33, 0, 1 },
+    { 4313, 48, 33, 0, 0 },
+    { 4346, 48, 33, 0, 0 },
+    { 4379, 48, 33, 0, 0 },
+    { 4412, 47, 33, 0, 0 },
+    { 4445, 48, 33, 0, 0 },
+    { 4478, 48, 33, 0, 0 },
+    { 4511, 48, 33, 0, 0 },
+    { 4544, 48, 33, 0, 0 },
+    { 4577, 48, 33, 0, 0 },
+    { 4610, 48, 33, 0, 0 },
+    { 4643, 48, 33, 0, 0 },
+    { 4676, 48, 33, 0, 0 },
+    { 4709, 48, 33, 0, 0 },
+    { 4742, 55, 33, 0, 0 },
+    { 4775, 56, 33, 0, 0 },
+    { 4808, 52, 33, 0, 6 },
+    { 4841, 55, 33, 0, 0 }
+};
+std::size_t const ReferenceScanner::ms_state_count_ = sizeof(ReferenceScanner::ms_state_table_) / sizeof(*ReferenceScanner::ms_state_table_);
+
+ReflexCpp_::AutomatonApparatus_FastAndBig_InMemory_S8_T16_A8_::DfaTransition_ const ReferenceScanner::ms_transition_table_[] =
+{
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 158 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 4 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 158 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 4 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 158 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 4 },
+    { 6 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 158 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 4 },
+    { 6 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 2 },
+    { 9 },
+    { 9 },
+    { 42 },
+    { 42 },
+    { 43 },
+    { 43 },
+    { 47 },
+    { 47 },
+    { 9 },
+    { 9 },
+    { 42 },
+    { 42 },
+    { 43 },
+    { 43 },
+    { 47 },
+    { 47 },
+    { 9 },
+    { 9 },
+    { 42 },
+    { 42 },
+    { 43 },
+    { 43 },
+    { 47 },
+    { 47 },
+    { 9 },
+    { 9 },
+    { 42 },
+    { 42 },
+    { 43 },
+    { 43 },
+    { 47 },
+    { 47 },
+    { 158 },
+    { 10 },
+    { 158 },
+    { 14 },
+    { 14 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 15 },
+    { 17 },
+    { 17 },
+    { 20 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 21 },
+    { 24 },
+    { 28 },
+    { 11 },
+    { 31 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 32 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 38 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 12 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 13 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 14 },
+    { 14 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 16 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 18 },
+    { 19 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 18 },
+    { 18 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 18 },
+    { 18 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 22 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 23 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 25 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 26 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 27 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 29 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 30 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 27 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 33 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 34 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 35 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 36 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 37 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 39 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 40 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 41 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 30 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 10 },
+    { 158 },
+    { 14 },
+    { 14 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 15 },
+    { 17 },
+    { 17 },
+    { 20 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 21 },
+    { 24 },
+    { 28 },
+    { 11 },
+    { 31 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 32 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 38 },
+    { 158 },
+    { 10 },
+    { 158 },
+    { 14 },
+    { 14 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 15 },
+    { 17 },
+    { 17 },
+    { 20 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 21 },
+    { 24 },
+    { 44 },
+    { 11 },
+    { 31 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 32 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 38 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 45 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 46 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 158 },
+    { 10 },
+    { 158 },
+    { 14 },
+    { 14 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 15 },
+    { 17 },
+    { 17 },
+    { 20 },
+    { 11 },
+    { 158 },
+    { 11 },
+    { 11 },
+    { 21 },
+    { 24 },
+    { 44 },
+    { 11 },
+    { 31 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 32 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 38 },
+    { 49 },
+    { 49 },
+    { 82 },
+    { 82 },
+    { 83 },
+    { 83 },
+    { 87 },
+    { 87 },
+    { 49 },
+    { 49 },
+    { 82 },
+    { 82 },
+    { 83 },
+    { 83 },
+    { 87 },
+    { 87 },
+    { 49 },
+    { 49 },
+    { 82 },
+    { 82 },
+    { 83 },
+    { 83 },
+    { 87 },
+    { 87 },
+    { 49 },
+    { 49 },
+    { 82 },
+    { 82 },
+    { 83 },
+    { 83 },
+    { 87 },
+    { 87 },
+    { 158 },
+    { 50 },
+    { 158 },
+    { 54 },
+    { 54 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 60 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 61 },
+    { 64 },
+    { 68 },
+    { 51 },
+    { 71 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 72 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 78 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 52 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 53 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 54 },
+    { 54 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 56 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 58 },
+    { 59 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 58 },
+    { 58 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 58 },
+    { 58 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 62 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 65 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 66 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 67 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 69 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 70 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 67 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 73 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 74 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 75 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 76 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 77 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 79 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 80 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 81 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 70 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 50 },
+    { 158 },
+    { 54 },
+    { 54 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 60 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 61 },
+    { 64 },
+    { 68 },
+    { 51 },
+    { 71 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 72 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 78 },
+    { 158 },
+    { 50 },
+    { 158 },
+    { 54 },
+    { 54 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 60 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 61 },
+    { 64 },
+    { 84 },
+    { 51 },
+    { 71 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 72 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 78 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 85 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 86 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 158 },
+    { 50 },
+    { 158 },
+    { 54 },
+    { 54 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 55 },
+    { 57 },
+    { 57 },
+    { 60 },
+    { 51 },
+    { 158 },
+    { 51 },
+    { 51 },
+    { 61 },
+    { 64 },
+    { 84 },
+    { 51 },
+    { 71 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 72 },
+    { 51 },
+    { 51 },
+    { 51 },
+    { 78 },
+    { 89 },
+    { 89 },
+    { 122 },
+    { 122 },
+    { 123 },
+    { 123 },
+    { 127 },
+    { 127 },
+    { 89 },
+    { 89 },
+    { 122 },
+    { 122 },
+    { 123 },
+    { 123 },
+    { 127 },
+    { 127 },
+    { 89 },
+    { 89 },
+    { 122 },
+    { 122 },
+    { 123 },
+    { 123 },
+    { 127 },
+    { 127 },
+    { 89 },
+    { 89 },
+    { 122 },
+    { 122 },
+    { 123 },
+    { 123 },
+    { 127 },
+    { 127 },
+    { 158 },
+    { 90 },
+    { 158 },
+    { 94 },
+    { 94 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 95 },
+    { 97 },
+    { 97 },
+    { 100 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 101 },
+    { 104 },
+    { 108 },
+    { 91 },
+    { 111 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 112 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 118 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 92 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 93 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 94 },
+    { 94 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 96 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 98 },
+    { 99 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 98 },
+    { 98 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 98 },
+    { 98 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 102 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 103 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 105 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 106 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 107 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 109 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 110 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 107 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 113 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 114 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 115 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 116 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 117 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 119 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 120 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 121 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 110 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 90 },
+    { 158 },
+    { 94 },
+    { 94 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 95 },
+    { 97 },
+    { 97 },
+    { 100 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 101 },
+    { 104 },
+    { 108 },
+    { 91 },
+    { 111 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 112 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 118 },
+    { 158 },
+    { 90 },
+    { 158 },
+    { 94 },
+    { 94 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 95 },
+    { 97 },
+    { 97 },
+    { 100 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 101 },
+    { 104 },
+    { 124 },
+    { 91 },
+    { 111 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 112 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 118 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 125 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 126 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 158 },
+    { 90 },
+    { 158 },
+    { 94 },
+    { 94 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 95 },
+    { 97 },
+    { 97 },
+    { 100 },
+    { 91 },
+    { 158 },
+    { 91 },
+    { 91 },
+    { 101 },
+    { 104 },
+    { 124 },
+    { 91 },
+    { 111 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 112 },
+    { 91 },
+    { 91 },
+    { 91 },
+    { 118 },
+    { 129 },
+    { 129 },
+    { 154 },
+    { 154 },
+    { 155 },
+    { 155 },
+    { 157 },
+    { 157 },
+    { 129 },
+    { 129 },
+    { 154 },
+    { 154 },
+    { 155 },
+    { 155 },
+    { 157 },
+    { 157 },
+    { 129 },
+    { 129 },
+    { 154 },
+    { 154 },
+    { 155 },
+    { 155 },
+    { 157 },
+    { 157 },
+    { 129 },
+    { 129 },
+    { 154 },
+    { 154 },
+    { 155 },
+    { 155 },
+    { 157 },
+    { 157 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 130 },
+    { 130 },
+    { 131 },
+    { 133 },
+    { 158 },
+    { 132 },
+    { 132 },
+    { 136 },
+    { 138 },
+    { 158 },
+    { 139 },
+    { 139 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 141 },
+    { 140 },
+    { 140 },
+    { 145 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 146 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 151 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 130 },
+    { 130 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 132 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 158 },
+    { 133 },
+    { 134 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 135 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 158 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 158 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 133 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 137 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 138 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 132 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 142 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 143 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 144 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 144 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 147 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 148 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 149 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 150 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 144 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 152 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 153 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 143 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 130 },
+    { 130 },
+    { 131 },
+    { 133 },
+    { 158 },
+    { 132 },
+    { 132 },
+    { 136 },
+    { 138 },
+    { 158 },
+    { 139 },
+    { 139 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 141 },
+    { 140 },
+    { 140 },
+    { 145 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 146 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 151 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 130 },
+    { 130 },
+    { 131 },
+    { 133 },
+    { 156 },
+    { 132 },
+    { 132 },
+    { 136 },
+    { 138 },
+    { 158 },
+    { 139 },
+    { 139 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 141 },
+    { 140 },
+    { 140 },
+    { 145 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 146 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 151 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 156 },
+    { 158 },
+    { 158 },
+    { 158 },
+    { 130 },
+    { 130 },
+    { 131 },
+    { 133 },
+    { 156 },
+    { 132 },
+    { 132 },
+    { 136 },
+    { 138 },
+    { 158 },
+    { 139 },
+    { 139 },
+    { 158 },
+    { 140 },
+    { 158 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 141 },
+    { 140 },
+    { 140 },
+    { 145 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 146 },
+    { 140 },
+    { 140 },
+    { 140 },
+    { 151 }
+};
+std::size_t const ReferenceScanner::ms_transition_count_ = sizeof(ReferenceScanner::ms_transition_table_) / sizeof(*ReferenceScanner::ms_transition_table_);
+
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 33 atom classes.
+std::uint8_t const ReferenceScanner::ms_atom_class_table_[256] =
+{
+    0, 1, 2, 2, 2, 2, 2, 2, 2, 3, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 5, 6, 7, 2, 2, 2, 2, 8, 8, 9, 8, 8, 8, 2, 10,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 8, 13, 14, 13, 2,
+    15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 2, 17, 2, 2, 16,
+    2, 18, 19, 19, 20, 21, 22, 19, 23, 24, 19, 19, 25, 19, 26, 27,
+    19, 19, 28, 29, 30, 31, 19, 32, 19, 19, 19, 8, 2, 8, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const ReferenceScanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 60, 0, 0, 0 },
+        { 62, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 251, 255, 255, 255, 255, 255, 255, 239, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        4, false,
+        { 1, 11, 35, 93 },
+        { 9, 33, 91, 255 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 97, 0, 0, 0 },
+        { 122, 0, 0, 0 }
+    }
+};
+std::size_t const ReferenceScanner::ms_skip_set_count_ = sizeof(ReferenceScanner::ms_skip_set_table_) / sizeof(*ReferenceScanner::ms_skip_set_table_);
+
+std::uint32_t const ReferenceScanner::ms_accept_handler_count_ = 56;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const ReferenceScanner::ms_accept_handler_is_token_only_[] =
+{
+    false,
+    false,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    false,
+    false,
+    false,
+    true
+};
+ReferenceScanner::TokenId const ReferenceScanner::ms_accept_handler_token_id_[] =
+{
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::END_OF_INPUT
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
@@ -0,0 +1,77 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+// Checks that alternating ScanBatch with Scan (wherever ScanBatch stops short)
+// produces the same tokens as Scan alone, for each batch capacity, and that
+// ScanBatch reports contiguous offsets and lengths.  ScanBatch must stop just
+// before the rules with handler code, the kept string of BLOCK_COMMENT,
+// rejected input and the (empty) end-of-input token.
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include "reference_scanner.hpp"
+#include "streambuf_scanner.hpp"
+
+template <typename Scanner_>
+std::string ScanTokensInBatches (Scanner_ &scanner, std::size_t input_size, std::size_t batch_capacity)
+{
+    std::vector<typename Scanner_::TokenId> token_ids(batch_capacity);
+    std::vector<std::size_t> token_offsets(batch_capacity);
+    std::vector<std::size_t> token_lengths(batch_capacity);
+    std::string token_record;
+    // the offset of the next token
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        std::size_t token_count = scanner.ScanBatch(&token_ids[0], &token_offsets[0], &token_lengths[0], batch_capacity);
+        for (std::size_t t = 0; t < token_count; ++t)
+        {
+            if (token_offsets[t] != offset || token_lengths[t] == 0)
+                return token_record + "<token at offset " + std::to_string(token_offsets[t]) + " with length " + std::to_string(token_lengths[t]) + ">";
+            RecordToken(token_record, token_ids[t], std::string());
+            offset += token_lengths[t];
+        }
+        if (token_count == batch_capacity)
+            continue;
+
+        // Every token Scan must handle instead records the string it handled,
+        // except the end of input.
+        Token::Type token = scanner.Scan();
+        RecordToken(token_record, token, scanner.m_text);
+        offset += scanner.m_text.size();
+        if (token == Token::END_OF_INPUT)
+            break;
+    }
+    if (offset != input_size)
+        token_record += "<ended at offset " + std::to_string(offset) + ">";
+    return token_record;
+}
+
+int main ()
+{
+    InputGenerator generator;
+    int failure_count = 0;
+    for (int i = 0; i < 2000 && failure_count < 10; ++i)
+    {
+        std::string input(generator.Input(24));
+
+        ReferenceScanner reference_scanner;
+        reference_scanner.InputSpan(input.data(), input.data() + input.size());
+        std::string expected(ScanTokens(reference_scanner));
+
+        for (std::size_t batch_capacity = 1; batch_capacity <= 5; ++batch_capacity)
+        {
+            ReferenceScanner scanner;
+            scanner.InputSpan(input.data(), input.data() + input.size());
+            failure_count += CheckTokenRecord("in-memory ScanBatch", input, expected, ScanTokensInBatches(scanner, input.size(), batch_capacity));
+        }
+        for (std::size_t batch_capacity = 1; batch_capacity <= 5; ++batch_capacity)
+        {
+            std::istringstream in(input);
+            StreambufScanner scanner;
+            scanner.InputStreambuf(in.rdbuf());
+            failure_count += CheckTokenRecord("streambuf ScanBatch", input, expected, ScanTokensInBatches(scanner, input.size(), batch_capacity));
+        }
+    }
+    return failure_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+// 2026.10.18 - Copyright Victor Dods - Licensed under Apache 2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// Token types shared by all the test scanners, so that their outputs can be
+// compared directly.
+struct Token
+{
+    enum Type
+    {
+        END_OF_INPUT = 0,
+        BAD_TOKEN,
+        KEYWORD,
+        IDENTIFIER,
+        INTEGER,
+        OPERATOR,
+        WHITESPACE,
+        DIRECTIVE,
+        STRING,
+        COMMENT,
+        UNTERMINATED_COMMENT,
+        // returned by need_more_input_actions of push-mode scanners
+        NEED_MORE_INPUT
+    }; // end of enum Token::Type
+}; // end of struct Token
+
+// Deterministically generates short inputs made of fragments chosen to
+// exercise every rule, including partial and ill-formed tokens.
+class InputGenerator
+{
+public:
+
+    InputGenerator () : m_state(0x12345678) { }
+
+    // Returns a number in [0, bound).
+    std::size_t Next (std::size_t bound)
+    {
+        // xorshift32; quality is irrelevant, only determinism matters.
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return m_state % bound;
+    }
+
+    // Returns an input of at most max_fragment_count fragments.
+    std::string Input (std::size_t max_fragment_count)
+    {
+        static char const *const FRAGMENTS[] = {
+            "if", "else", "return", "x", "y1", "_tmp", "0", "42",
+            " ", "  ", "\t", "\n", "\n#", "#if", "#",
+            "\"", "\"str\"", "\\", "/", "*", "/*", "*/", "/* c */",
+            "=", "==", "<", "(", ")", ";", "{", "@",
+        };
+        static std::size_t const FRAGMENT_COUNT = sizeof(FRAGMENTS) / sizeof(FRAGMENTS[0]);
+
+        std::string retval;
+        for (std::size_t i = 0, fragment_count = Next(max_fragment_count + 1); i < fragment_count; ++i)
+            retval += FRAGMENTS[Next(FRAGMENT_COUNT)];
+        return retval;
+    }
+
+private:
+
+    std::uint32_t m_state;
+}; // end of class InputGenerator
+
+// Appends a token returned by Scan (along with the string its rule handler
+// code recorded, if any) to token_record.
+inline void RecordToken (std::string &token_record, Token::Type token, std::string const &text)
+{
+    token_record += std::to_string(token);
+    if (!text.empty())
+        token_record += "[" + text + "]";
+    token_record += ' ';
+}
+
+// Scans the input of scanner until the end of input, returning the record of
+// the tokens.  The number of tokens is capped, in case a scanner fails to
+// make progress.
+template <typename Scanner_>
+std::string ScanTokens (Scanner_ &scanner)
+{
+    std::string token_record;
+    for (std::size_t i = 0; i < 10000000; ++i)
+    {
+        Token::Type token = scanner.Scan();
+        RecordToken(token_record, token, scanner.m_text);
+        if (token == Token::END_OF_INPUT)
+            break;
+    }
+    return token_record;
+}
+
+// Prints the mismatch between the token records of the scanner under test and
+// of reference_scanner for input, and returns 1 (for counting failures), or
+// returns 0 if they match.
+inline int CheckTokenRecord (char const *test_name, std::string const &input, std::string const &expected, std::string const &actual)
+{
+    if (actual == expected)
+        return 0;
+    std::cerr << test_name << " failed for input \"" << input << "\"\n"
+              << "    expected: " << expected << '\n'
+              << "    actual:   " << actual << '\n';
+    return 1;
+}
@@ -0,0 +1,1720 @@
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+// small_scanner.cpp generated by reflex
+// from small_scanner.reflex using reflex.cpp.targetspec and reflex.cpp.implementation.codespec
+// DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY ! DO NOT MODIFY
+
+#include "small_scanner.hpp"
+
+
+SmallScanner::SmallScanner ()
+    :
+    ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_(
+        ms_state_table_,
+        ms_state_count_,
+        ms_transition_table_,
+        ms_transition_count_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_)
+{
+
+    ResetForNewInput();
+}
+
+SmallScanner::~SmallScanner ()
+{
+}
+
+SmallScanner::StateMachine::Name SmallScanner::CurrentStateMachine () const
+{
+    assert(InitialState_() != NULL);
+    std::size_t initial_node_index = InitialState_() - ms_state_table_;
+    assert(initial_node_index < ms_state_count_);
+    switch (initial_node_index)
+    {
+        default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
+        case 0: return StateMachine::BLOCK_COMMENT;
+        case 8: return StateMachine::KEYWORDS;
+        case 25: return StateMachine::KEYWORDS_CASE_INSENSITIVE;
+        case 65: return StateMachine::KEYWORDS_UNGREEDY;
+        case 82: return StateMachine::MAIN;
+    }
+}
+
+void SmallScanner::SwitchToStateMachine (StateMachine::Name state_machine)
+{
+    assert(
+        state_machine == StateMachine::BLOCK_COMMENT ||
+        state_machine == StateMachine::KEYWORDS ||
+        state_machine == StateMachine::KEYWORDS_CASE_INSENSITIVE ||
+        state_machine == StateMachine::KEYWORDS_UNGREEDY ||
+        state_machine == StateMachine::MAIN ||
+        (false && "invalid StateMachine::Name"));
+    InitialState_(ms_state_table_ + ms_state_machine_start_state_index_[state_machine]);
+    ModeFlags_(ms_state_machine_mode_flags_[state_machine]);
+    assert(CurrentStateMachine() == state_machine);
+}
+
+SmallScanner::ScannerCheckpoint SmallScanner::Checkpoint ()
+{
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_InMemory_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void SmallScanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void SmallScanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_InMemory_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
+void SmallScanner::ResetForNewInput ()
+{
+    ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    assert(CurrentStateMachine() == StateMachine::START_);
+
+}
+
+Token::Type SmallScanner::Scan () throw()
+{
+
+#line 47 "small_scanner.reflex"
+
+    m_text.clear();
+
+#line 92 "small_scanner.cpp"
+
+    // this is the main scanner loop.  it only breaks when an accept handler
+    // returns or after the unmatched character handler, if certain conditions
+    // exist (see comments below).
+    while (true)
+    {
+        // reset the char buffer and other stuff
+        PrepareToScan_();
+
+        bool was_at_end_of_input_ = IsAtEndOfInput();
+
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        // the work string is not copied out of the scanner's buffer.
+        char const *const work_string_data = reinterpret_cast<char const *>(AcceptedStringBegin_());
+        std::size_t const work_string_length = AcceptedStringEnd_() - AcceptedStringBegin_();
+        if (accept_handler_index_ >= ms_accept_handler_count_)
+        {
+            // if we were already at the end of input and no
+            // rule was matched, break out of the loop.
+            if (was_at_end_of_input_)
+                break;
+
+            char const *const rejected_string_data = work_string_data;
+            std::size_t const rejected_string_length = work_string_length;
+            std::uint8_t rejected_atom = rejected_string_length == 0 ? '\0' : rejected_string_data[rejected_string_length-1];
+            // suppress unused variable warnings
+            static_cast<void>(rejected_string_data);
+            static_cast<void>(rejected_atom);
+
+            // execute the rejection actions.  the do/while loop is so that a
+            // break statement inside the rejection actions doesn't break out
+            // of the main scanner loop.
+            do
+            {
+
+#line 59 "small_scanner.reflex"
+
+    m_text.assign(rejected_string_data, rejected_string_length);
+    return Token::BAD_TOKEN;
+
+#line 137 "small_scanner.cpp"
+
+            }
+            while (false);
+        }
+        // otherwise, call the appropriate accept handler code.
+        else
+        {
+            char const *const accepted_string_data = work_string_data;
+            std::size_t const accepted_string_length = work_string_length;
+            // suppress unused variable warnings
+            static_cast<void>(accepted_string_data);
+            static_cast<void>(accepted_string_length);
+
+            // execute the appropriate accept handler.
+            // the accepted string is in the range [accepted_string_data,
+            // accepted_string_data+accepted_string_length).
+            switch (accept_handler_index_)
+            {
+                case 0:
+                {
+
+#line 129 "small_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::COMMENT;
+    
+#line 165 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 1:
+                {
+
+#line 136 "small_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        SwitchToStateMachine(StateMachine::MAIN);
+        return Token::UNTERMINATED_COMMENT;
+    
+#line 179 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 2:
+                {
+
+#line 150 "small_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 189 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 3:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 4:
+                {
+
+#line 154 "small_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 205 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 5:
+                {
+
+#line 157 "small_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 215 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 6:
+                {
+
+#line 159 "small_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 225 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 7:
+                {
+
+#line 161 "small_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 235 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 8:
+                {
+
+#line 164 "small_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 245 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 9:
+                {
+
+#line 167 "small_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 255 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 10:
+                {
+
+#line 169 "small_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 265 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 11:
+                {
+
+#line 172 "small_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 275 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 12:
+                {
+
+#line 176 "small_scanner.reflex"
+ KeepString(); 
+#line 285 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 13:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 14:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 15:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 16:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 17:
+                {
+
+#line 228 "small_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 319 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 18:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 19:
+                {
+
+#line 232 "small_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 335 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 20:
+                {
+
+#line 235 "small_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 345 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 21:
+                {
+
+#line 237 "small_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 355 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 22:
+                {
+
+#line 239 "small_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 365 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 23:
+                {
+
+#line 242 "small_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 375 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 24:
+                {
+
+#line 245 "small_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 385 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 25:
+                {
+
+#line 247 "small_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 395 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 26:
+                {
+
+#line 250 "small_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 405 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 27:
+                {
+
+#line 254 "small_scanner.reflex"
+ KeepString(); 
+#line 415 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 28:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 29:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 30:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 31:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 32:
+                {
+
+#line 189 "small_scanner.reflex"
+ return Keyword("if|else", accepted_string_data, accepted_string_length); 
+#line 449 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 33:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 34:
+                {
+
+#line 193 "small_scanner.reflex"
+ return Keyword("do", accepted_string_data, accepted_string_length); 
+#line 465 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 35:
+                {
+
+#line 196 "small_scanner.reflex"
+ return Keyword("do$", accepted_string_data, accepted_string_length); 
+#line 475 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 36:
+                {
+
+#line 198 "small_scanner.reflex"
+ return Keyword("^for", accepted_string_data, accepted_string_length); 
+#line 485 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 37:
+                {
+
+#line 200 "small_scanner.reflex"
+ return Keyword("for|while", accepted_string_data, accepted_string_length); 
+#line 495 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 38:
+                {
+
+#line 203 "small_scanner.reflex"
+ return Keyword("if", accepted_string_data, accepted_string_length); 
+#line 505 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 39:
+                {
+
+#line 206 "small_scanner.reflex"
+ return Keyword("\\x01fa", accepted_string_data, accepted_string_length); 
+#line 515 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 40:
+                {
+
+#line 208 "small_scanner.reflex"
+ return Keyword("<=|>=|==", accepted_string_data, accepted_string_length); 
+#line 525 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 41:
+                {
+
+#line 211 "small_scanner.reflex"
+ return Keyword(":=", accepted_string_data, accepted_string_length); 
+#line 535 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 42:
+                {
+
+#line 215 "small_scanner.reflex"
+ KeepString(); 
+#line 545 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 43:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 44:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 45:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 46:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                case 47:
+                {
+                    return Token::KEYWORD;
+                }
+                break;
+
+                case 48:
+                {
+                    return Token::IDENTIFIER;
+                }
+                break;
+
+                case 49:
+                {
+                    return Token::INTEGER;
+                }
+                break;
+
+                case 50:
+                {
+                    return Token::OPERATOR;
+                }
+                break;
+
+                case 51:
+                {
+                    return Token::WHITESPACE;
+                }
+                break;
+
+                case 52:
+                {
+
+#line 105 "small_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::DIRECTIVE;
+    
+#line 612 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 53:
+                {
+
+#line 111 "small_scanner.reflex"
+
+        m_text.assign(accepted_string_data, accepted_string_length);
+        return Token::STRING;
+    
+#line 625 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 54:
+                {
+
+#line 118 "small_scanner.reflex"
+
+        KeepString();
+        SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
+    
+#line 638 "small_scanner.cpp"
+
+                }
+                break;
+
+                case 55:
+                {
+                    return Token::END_OF_INPUT;
+                }
+                break;
+
+                default: assert(false && "this should never happen"); break;
+            }
+        }
+    }
+
+
+#line 50 "small_scanner.reflex"
+
+    return Token::END_OF_INPUT;
+
+#line 659 "small_scanner.cpp"
+}
+
+std::size_t SmallScanner::ScanBatch (TokenId *token_ids, std::size_t *token_offsets, std::size_t *token_lengths, std::size_t token_capacity) throw()
+{
+    assert(token_ids != NULL);
+    assert(token_offsets != NULL);
+    assert(token_lengths != NULL);
+
+    // a string kept by KeepString must be scanned by Scan, since the
+    // scanned string would include it.
+    if (HasKeptString_())
+        return 0;
+
+    std::size_t token_count = 0;
+    while (token_count < token_capacity)
+    {
+        PrepareToScan_();
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        accept_handler_index_ = KeywordAcceptHandlerIndex_(accept_handler_index_);
+        std::uint8_t const *token_begin = AcceptedStringBegin_();
+        std::uint8_t const *token_end = AcceptedStringEnd_();
+        // anything other than a nonempty token matched by a token-only rule
+        // is put back for Scan to handle.  the end of input is either
+        // rejected or matched by an empty token, so it is also left to Scan.
+        if (accept_handler_index_ >= ms_accept_handler_count_ ||
+            !ms_accept_handler_is_token_only_[accept_handler_index_] ||
+            token_begin == token_end)
+        {
+            Unscan_();
+            break;
+        }
+        token_ids[token_count] = ms_accept_handler_token_id_[accept_handler_index_];
+        token_offsets[token_count] = InputOffset_(token_begin);
+        token_lengths[token_count] = token_end - token_begin;
+        ++token_count;
+    }
+    return token_count;
+}
+
+std::uint32_t SmallScanner::KeywordAcceptHandlerIndex_ (std::uint32_t accept_handler_index) const
+{
+    if (accept_handler_index >= ms_accept_handler_count_ || ms_accept_handler_keyword_state_machine_[accept_handler_index] < 0)
+        return accept_handler_index;
+
+    // the DFA started scanning after the kept string, if any, so only the
+    // scanned part of the accepted string can be a keyword.
+    std::uint8_t const *begin = ScannedStringBegin_();
+    std::uint8_t const *end = AcceptedStringEnd_();
+    std::size_t length = end - begin;
+    if (length < 2 || length > 6)
+        return accept_handler_index;
+
+    // see Reflex::KeywordBucketIndex and Reflex::KeywordSlotIndex in
+    // reflex_automaton.cpp.
+    std::uint32_t state_machine = std::uint32_t(ms_accept_handler_keyword_state_machine_[accept_handler_index]);
+    std::uint64_t hash = ReflexCpp_::KeywordHash_(0, state_machine, begin, end);
+    std::uint32_t displacement = ms_keyword_bucket_displacement_[std::uint32_t(hash) & 7];
+    ReflexCpp_::KeywordSlot_ const &slot = ms_keyword_slot_table_[(std::uint32_t(hash >> 32) + displacement * ((std::uint32_t(hash) >> 16) | 1)) & 63];
+    // only a keyword of a higher-priority rule takes precedence over the
+    // accepted rule, just as it would have in the full DFA.
+    if (slot.m_length == length &&
+        slot.m_state_machine == state_machine &&
+        slot.m_accept_handler_index < accept_handler_index &&
+        std::memcmp(slot.m_keyword, begin, length) == 0)
+    {
+        return slot.m_accept_handler_index;
+    }
+    return accept_handler_index;
+}
+
+// ///////////////////////////////////////////////////////////////////////
+// begin internal reflex-generated parser guts -- don't use
+// ///////////////////////////////////////////////////////////////////////
+
+std::uint32_t const SmallScanner::ms_state_machine_start_state_index_[] =
+{
+    0,
+    8,
+    25,
+    65,
+    82,
+};
+std::uint8_t const SmallScanner::ms_state_machine_mode_flags_[] =
+{
+    0,
+    0,
+    1,
+    2,
+    0,
+};
+std::uint32_t const SmallScanner::ms_state_machine_count_ = 5;
+
+// the order of the states indicates priority (only for accept states).
+// the lower the state's index in this array, the higher its priority.
+ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaState_ const SmallScanner::ms_state_table_[] =
+{
+    { 0, 56, 2, 0 },
+    { 2, 56, 3, 0 },
+    { 5, 56, 2, 0 },
+    { 7, 1, 3, 0 },
+    { 10, 56, 2, 0 },
+    { 12, 56, 5, 0 },
+    { 17, 0, 0, 0 },
+    { 17, 1, 5, 0 },
+    { 22, 56, 4, 0 },
+    { 26, 56, 11, 0 },
+    { 37, 13, 4, 1 },
+    { 41, 15, 2, 2 },
+    { 43, 56, 1, 0 },
+    { 44, 11, 0, 0 },
+    { 44, 14, 1, 3 },
+    { 45, 12, 0, 0 },
+    { 45, 13, 6, 0 },
+    { 51, 13, 2, 0 },
+    { 53, 5, 4, 0 },
+    { 57, 16, 11, 0 },
+    { 68, 56, 13, 0 },
+    { 81, 13, 6, 0 },
+    { 87, 13, 6, 0 },
+    { 93, 6, 4, 0 },
+    { 97, 16, 13, 0 },
+    { 110, 56, 4, 0 },
+    { 114, 56, 19, 0 },
+    { 133, 28, 6, 0 },
+    { 139, 28, 4, 1 },
+    { 143, 28, 5, 0 },
+    { 148, 24, 4, 0 },
+    { 152, 30, 2, 2 },
+    { 154, 56, 1, 0 },
+    { 155, 26, 0, 0 },
+    { 155, 29, 3, 0 },
+    { 158, 29, 1, 3 },
+    { 159, 25, 1, 0 },
+    { 160, 27, 0, 0 },
+    { 160, 28, 6, 0 },
+    { 166, 19, 2, 0 },
+    { 168, 19, 4, 0 },
+    { 172, 28, 6, 0 },
+    { 178, 28, 6, 0 },
+    { 184, 28, 6, 0 },
+    { 190, 17, 4, 0 },
+    { 194, 28, 6, 0 },
+    { 200, 28, 6, 0 },
+    { 206, 22, 4, 0 },
+    { 210, 28, 6, 0 },
+    { 216, 28, 6, 0 },
+    { 222, 28, 6, 0 },
+    { 228, 28, 6, 0 },
+    { 234, 28, 6, 0 },
+    { 240, 28, 6, 0 },
+    { 246, 18, 4, 0 },
+    { 250, 28, 6, 0 },
+    { 256, 28, 6, 0 },
+    { 262, 28, 6, 0 },
+    { 268, 28, 6, 0 },
+    { 274, 31, 19, 0 },
+    { 293, 56, 19, 0 },
+    { 312, 28, 6, 0 },
+    { 318, 28, 6, 0 },
+    { 324, 21, 4, 0 },
+    { 328, 31, 19, 0 },
+    { 347, 56, 4, 0 },
+    { 351, 56, 11, 0 },
+    { 362, 43, 4, 0 },
+    { 366, 45, 2, 0 },
+    { 368, 56, 1, 0 },
+    { 369, 41, 0, 0 },
+    { 369, 44, 1, 0 },
+    { 370, 42, 0, 0 },
+    { 370, 43, 6, 0 },
+    { 376, 43, 2, 0 },
+    { 378, 35, 4, 0 },
+    { 382, 46, 11, 0 },
+    { 393, 56, 13, 0 },
+    { 406, 43, 6, 0 },
+    { 412, 43, 6, 0 },
+    { 418, 36, 4, 0 },
+    { 422, 46, 13, 0 },
+    { 435, 56, 4, 0 },
+    { 439, 56, 14, 0 },
+    { 453, 51, 2, 2 },
+    { 455, 56, 1, 0 },
+    { 456, 50, 0, 0 },
+    { 456, 56, 6, 4 },
+    { 462, 53, 0, 0 },
+    { 462, 56, 2, 0 },
+    { 464, 50, 1, 0 },
+    { 465, 54, 0, 0 },
+    { 465, 49, 1, 5 },
+    { 466, 50, 1, 0 },
+    { 467, 48, 4, 1 },
+    { 471, 55, 14, 0 },
+    { 485, 56, 15, 0 },
+    { 500, 52, 1, 6 },
+    { 501, 55, 15, 0 }
+};
+std::size_t const SmallScanner::ms_state_count_ = sizeof(SmallScanner::ms_state_table_) / sizeof(*SmallScanner::ms_state_table_);
+
+ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_ const SmallScanner::ms_transition_table_[] =
+{
+    { 1, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 2, 0 },
+    { 3, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 2, 2 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 4, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 42, 0 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 43, 255 },
+    { 1, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 2, 0 },
+    { 3, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 2, 2 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 4, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 42, 0 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 43, 255 },
+    { 5, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 2, 0 },
+    { 7, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 2, 2 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 4, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 42, 0 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 43, 46 },
+    { 6, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 47, 0 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 255 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 1, 41 },
+    { 4, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 42, 0 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 43, 46 },
+    { 6, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 47, 0 },
+    { 2, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 255 },
+    { 9, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 0 },
+    { 19, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 2 },
+    { 20, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 4 },
+    { 24, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 6 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 12, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 14, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 15, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 16, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 101, 122 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 13, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 61, 0 },
+    { 14, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 110 },
+    { 17, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 111, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 112, 122 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 8, 0 },
+    { 18, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 8, 8 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 12, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 14, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 15, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 16, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 101, 122 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 12, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 14, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 15, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 16, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 21, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 122 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 110 },
+    { 22, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 111, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 112, 122 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 113 },
+    { 23, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 122 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 11, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 12, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 14, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 15, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 16, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 21, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 10, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 122 },
+    { 26, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 0 },
+    { 59, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 2 },
+    { 60, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 4 },
+    { 64, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 6 },
+    { 27, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 32, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 34, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 37, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 38, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 41, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 45, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 104 },
+    { 48, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 105, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 106, 113 },
+    { 49, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 118 },
+    { 55, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 119, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 120, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 101 },
+    { 29, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 30, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 97, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 98, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 33, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 61, 0 },
+    { 35, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 60, 0 },
+    { 36, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 61, 0 },
+    { 35, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 62, 0 },
+    { 35, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 35, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 110 },
+    { 39, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 111, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 112, 122 },
+    { 40, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 8, 0 },
+    { 40, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 8, 8 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 107 },
+    { 42, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 108, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 109, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 114 },
+    { 43, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 115, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 116, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 100 },
+    { 44, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 102, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 110 },
+    { 46, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 111, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 112, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 113 },
+    { 47, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 101 },
+    { 44, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 100 },
+    { 50, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 102, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 115 },
+    { 51, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 116, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 117, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 116 },
+    { 52, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 117, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 118, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 113 },
+    { 53, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 109 },
+    { 54, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 110, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 111, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 103 },
+    { 56, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 104, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 105, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 104 },
+    { 57, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 105, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 106, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 107 },
+    { 58, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 108, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 109, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 100 },
+    { 47, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 102, 122 },
+    { 27, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 32, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 34, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 37, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 38, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 41, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 45, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 104 },
+    { 48, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 105, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 106, 113 },
+    { 49, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 118 },
+    { 55, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 119, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 120, 122 },
+    { 27, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 32, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 34, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 37, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 38, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 41, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 61, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 104 },
+    { 48, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 105, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 106, 113 },
+    { 49, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 118 },
+    { 55, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 119, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 120, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 110 },
+    { 62, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 111, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 112, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 113 },
+    { 63, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 122 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 27, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 31, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 32, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 34, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 37, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 38, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 41, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 61, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 104 },
+    { 48, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 105, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 106, 113 },
+    { 49, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 118 },
+    { 55, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 119, 0 },
+    { 28, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 120, 122 },
+    { 66, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 0 },
+    { 76, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 2 },
+    { 77, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 4 },
+    { 81, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 6 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 69, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 71, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 72, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 73, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 101, 122 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 70, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 61, 0 },
+    { 71, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 110 },
+    { 74, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 111, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 112, 122 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 8, 0 },
+    { 75, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 8, 8 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 69, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 71, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 72, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 73, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 101, 122 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 69, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 71, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 72, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 73, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 78, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 122 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 110 },
+    { 79, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 111, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 112, 122 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 113 },
+    { 80, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 114, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 115, 122 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 1, 0 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 68, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 69, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 58, 0 },
+    { 71, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 72, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 64, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 99 },
+    { 73, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 100, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 101, 0 },
+    { 78, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 102, 0 },
+    { 67, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 103, 122 },
+    { 83, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 0 },
+    { 95, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 2 },
+    { 96, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 4 },
+    { 98, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::CONDITIONAL, 6, 6 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 85, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 33, 0 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 34, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 40, 45 },
+    { 90, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 47, 0 },
+    { 92, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 59, 0 },
+    { 93, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 123, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 125, 0 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 61, 0 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 1, 9 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 11, 33 },
+    { 88, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 34, 0 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 35, 91 },
+    { 89, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 92, 0 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 93, 255 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 1, 9 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 11, 255 },
+    { 91, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 42, 0 },
+    { 92, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 61, 0 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 85, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 33, 0 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 34, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 40, 45 },
+    { 90, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 47, 0 },
+    { 92, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 59, 0 },
+    { 93, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 123, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 125, 0 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 85, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 33, 0 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 34, 0 },
+    { 97, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 35, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 40, 45 },
+    { 90, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 47, 0 },
+    { 92, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 59, 0 },
+    { 93, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 123, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 125, 0 },
+    { 97, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 9, 10 },
+    { 84, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 32, 0 },
+    { 85, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 33, 0 },
+    { 87, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 34, 0 },
+    { 97, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 35, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 40, 45 },
+    { 90, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 47, 0 },
+    { 92, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 48, 57 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 59, 0 },
+    { 93, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 60, 62 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 65, 90 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 95, 0 },
+    { 94, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM_RANGE, 97, 122 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 123, 0 },
+    { 86, ReflexCpp_::AutomatonApparatus_SmallAndSlow_InMemory_S8_T16_A8_::DfaTransition_::INPUT_ATOM, 125, 0 }
+};
+std::size_t const SmallScanner::ms_transition_count_ = sizeof(SmallScanner::ms_transition_table_) / sizeof(*SmallScanner::ms_transition_table_);
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const SmallScanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    },
+    {
+        {
+            0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        2, false,
+        { 9, 32, 0, 0 },
+        { 10, 32, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 60, 0, 0, 0 },
+        { 62, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 251, 255, 255, 255, 255, 255, 255, 239, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        4, false,
+        { 1, 11, 35, 93 },
+        { 9, 33, 91, 255 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 97, 0, 0, 0 },
+        { 122, 0, 0, 0 }
+    }
+};
+std::size_t const SmallScanner::ms_skip_set_count_ = sizeof(SmallScanner::ms_skip_set_table_) / sizeof(*SmallScanner::ms_skip_set_table_);
+
+std::uint32_t const SmallScanner::ms_accept_handler_count_ = 56;
+
+// indicates which accept handlers are token-only, and gives their token ids
+// (the token ids of the others are unused).
+bool const SmallScanner::ms_accept_handler_is_token_only_[] =
+{
+    false,
+    false,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    false,
+    true,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    false,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    true,
+    false,
+    false,
+    false,
+    true
+};
+SmallScanner::TokenId const SmallScanner::ms_accept_handler_token_id_[] =
+{
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    TokenId(),
+    Token::KEYWORD,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::IDENTIFIER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    Token::END_OF_INPUT,
+    Token::KEYWORD,
+    Token::IDENTIFIER,
+    Token::INTEGER,
+    Token::OPERATOR,
+    Token::WHITESPACE,
+    TokenId(),
+    TokenId(),
+    TokenId(),
+    Token::END_OF_INPUT
+};
+
+// the rules matching only (finitely many) literal strings which are also
+// matched by later rules were left out of the DFA; the strings accepted by
+// those later rules are looked up in this perfect hash table of the keywords
+// (see KeywordAcceptHandlerIndex_).  this gives the index of the state machine
+// whose keywords each accept handler's strings are looked up in, or -1 if its
+// strings can't be keywords of higher priority.
+std::int32_t const SmallScanner::ms_accept_handler_keyword_state_machine_[] =
+{
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    1,
+    1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    3,
+    3,
+    -1,
+    -1,
+    -1,
+    4,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1,
+    -1
+};
+ReflexCpp_::KeywordSlot_ const SmallScanner::ms_keyword_slot_table_[] =
+{
+    { ">=", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "<=", 2, 3, 40 },
+    { "do", 2, 1, 4 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { ">=", 2, 1, 10 },
+    { "==", 2, 1, 10 },
+    { "<=", 2, 1, 10 },
+    { "for", 3, 1, 7 },
+    { "if", 2, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 1, 2 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 4, 47 },
+    { "return", 6, 3, 33 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "do", 2, 3, 34 },
+    { "\x01\x66\x61", 3, 1, 9 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "==", 2, 3, 40 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 3, 32 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 1, 3 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "return", 6, 4, 47 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "while", 5, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "if", 2, 4, 47 },
+    { "", 0, 0, 56 },
+    { "while", 5, 1, 7 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "\x01\x66\x61", 3, 3, 39 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 },
+    { "else", 4, 3, 32 },
+    { "while", 5, 4, 47 },
+    { "", 0, 0, 56 },
+    { "for", 3, 3, 37 },
+    { "", 0, 0, 56 },
+    { "", 0, 0, 56 }
+};
+std::uint16_t const SmallScanner::ms_keyword_bucket_displacement_[] =
+{
+    0,
+    1,
+    0,
+    3,
+    2,
+    1,
+    3,
+    0
+};
+
+// ///////////////////////////////////////////////////////////////////////
+// end of internal reflex-generated parser guts
+// ///////////////////////////////////////////////////////////////////////
+
@@ -381,7 +381,10 @@ void RuleHandler::Print (ostream &stream, StringifyAstType Stringify, Uint32 ind
     stream << Tabs(indent_level) << Stringify(GetAstType()) << endl;
     if (m_target_id != NULL)
         m_target_id->Print(stream, Stringify, indent_level+1);
-    m_rule_handler_code_block->Print(stream, Stringify, indent_level+1);
+    if (m_rule_handler_code_block != NULL)
+        m_rule_handler_code_block->Print(stream, Stringify, indent_level+1);
+    else
+        m_token_id->Print(stream, Stringify, indent_level+1);
 }
 
 } // end of namespace CommonLang
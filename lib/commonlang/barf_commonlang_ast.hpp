@@ -160,7 +160,11 @@ struct TargetMap : public Ast::AstMap<Target>
 struct RuleHandler : public Ast::Base
 {
     Ast::Id const *const m_target_id;
+    // exactly one of m_rule_handler_code_block and m_token_id is non-NULL.
     Ast::CodeBlock const *const m_rule_handler_code_block;
+    // if non-NULL, the rule is "token-only" -- instead of executing code, its
+    // handler produces this (target-specific) token id.
+    Ast::TextBase const *const m_token_id;
 
     RuleHandler (
         Ast::Id const *target_id,
@@ -172,11 +176,24 @@ struct RuleHandler : public Ast::Base
             rule_handler_code_block->GetFiLoc(),
             AST_RULE_HANDLER),
         m_target_id(target_id),
-        m_rule_handler_code_block(rule_handler_code_block)
+        m_rule_handler_code_block(rule_handler_code_block),
+        m_token_id(NULL)
     {
         assert(m_target_id != NULL);
         assert(m_rule_handler_code_block != NULL);
     }
+    RuleHandler (
+        Ast::Id const *target_id,
+        Ast::TextBase const *token_id)
+        :
+        Ast::Base(target_id->GetFiLoc(), AST_RULE_HANDLER),
+        m_target_id(target_id),
+        m_rule_handler_code_block(NULL),
+        m_token_id(token_id)
+    {
+        assert(m_target_id != NULL);
+        assert(m_token_id != NULL);
+    }
 
     virtual void Print (ostream &stream, StringifyAstType Stringify, Uint32 indent_level = 0) const;
 }; // end of struct RuleHandler
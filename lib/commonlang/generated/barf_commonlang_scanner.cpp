@@ -10,7 +10,7 @@
 #define REFLEX_CPP_DEBUG_CODE_(spew_code) if (DebugSpewIsEnabled()) { spew_code; }
 
 
-#line 120 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 112 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
 #include <cstdlib>
 #include <sstream>
@@ -141,12 +141,16 @@ Scanner::Token::Type Scanner::ParseDirective (string const &accepted_string, Ast
 
 Scanner::Scanner ()
     :
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_(
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_(
         ms_state_table_,
         ms_state_count_,
         ms_transition_table_,
         ms_transition_count_,
-        ms_accept_handler_count_)
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_,
+        1024)
 {
     SetDebugSpewStream(NULL);
 
@@ -167,16 +171,16 @@ Scanner::StateMachine::Name Scanner::CurrentStateMachine () const
     {
         default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
         case 0: return StateMachine::BLOCK_COMMENT;
-        case 10: return StateMachine::CHAR_LITERAL_END;
-        case 17: return StateMachine::CHAR_LITERAL_GUTS;
-        case 30: return StateMachine::CHAR_LITERAL_INSIDE_STRICT_CODE_BLOCK;
-        case 40: return StateMachine::DUMB_CODE_BLOCK;
-        case 50: return StateMachine::MAIN;
-        case 72: return StateMachine::REGULAR_EXPRESSION;
-        case 83: return StateMachine::REGULAR_EXPRESSION_BRACKET_EXPRESSION;
-        case 93: return StateMachine::STRICT_CODE_BLOCK;
-        case 104: return StateMachine::STRING_LITERAL_GUTS;
-        case 114: return StateMachine::STRING_LITERAL_INSIDE_STRICT_CODE_BLOCK;
+        case 9: return StateMachine::CHAR_LITERAL_END;
+        case 16: return StateMachine::CHAR_LITERAL_GUTS;
+        case 28: return StateMachine::CHAR_LITERAL_INSIDE_STRICT_CODE_BLOCK;
+        case 37: return StateMachine::DUMB_CODE_BLOCK;
+        case 46: return StateMachine::MAIN;
+        case 67: return StateMachine::REGULAR_EXPRESSION;
+        case 77: return StateMachine::REGULAR_EXPRESSION_BRACKET_EXPRESSION;
+        case 86: return StateMachine::STRICT_CODE_BLOCK;
+        case 97: return StateMachine::STRING_LITERAL_GUTS;
+        case 106: return StateMachine::STRING_LITERAL_INSIDE_STRICT_CODE_BLOCK;
     }
 }
 
@@ -197,16 +201,16 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
         (false && "invalid StateMachine::Name"));
     REFLEX_CPP_DEBUG_CODE_(
         *DebugSpewStream() << 
-#line 277 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
 "CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 203 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 207 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
  << " switching to state machine "
                            << ms_state_machine_name_[state_machine];
         if (ms_state_machine_mode_flags_[state_machine] != 0)
         {
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_CASE_INSENSITIVE_) != 0)
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
                 *DebugSpewStream() << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_UNGREEDY_) != 0)
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_UNGREEDY_) != 0)
                 *DebugSpewStream() << " %ungreedy";
         }
         *DebugSpewStream() << std::endl)
@@ -215,48 +219,77 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
     assert(CurrentStateMachine() == state_machine);
 }
 
+Scanner::ScannerCheckpoint Scanner::Checkpoint ()
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
+"CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
+#line 228 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+ << " taking checkpoint" << std::endl)
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_Noninteractive_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void Scanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
+"CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
+#line 241 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+ << " restoring checkpoint" << std::endl)
+    ReflexCpp_::InputApparatus_Noninteractive_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void Scanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_Noninteractive_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
 void Scanner::ResetForNewInput ()
 {
     REFLEX_CPP_DEBUG_CODE_(
         *DebugSpewStream() << 
-#line 277 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
 "CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 225 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 258 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
  << " executing reset-for-new-input actions and switching to state machine "
                            << ms_state_machine_name_[StateMachine::START_];
         if (ms_state_machine_mode_flags_[StateMachine::START_] != 0)
         {
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_CASE_INSENSITIVE_) != 0)
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
                 *DebugSpewStream() << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_UNGREEDY_) != 0)
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_UNGREEDY_) != 0)
                 *DebugSpewStream() << " %ungreedy";
         }
         *DebugSpewStream() << std::endl)
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
     assert(CurrentStateMachine() == StateMachine::START_);
 
 
-#line 266 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 258 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
     m_is_in_preamble = true;
     m_regex_paren_level = 0;
     m_code_block_bracket_level = 0;
 
-#line 246 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 279 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 }
 
 Scanner::Token::Type Scanner::Scan (
-#line 85 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 77 "../lib/commonlang/barf_commonlang_scanner.reflex"
  Ast::Base *&token 
-#line 252 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 285 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 ) throw()
 {
 
-#line 246 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 238 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
     assert(token == NULL);
 
-#line 260 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 293 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
     std::string work_string;
     // this is the main scanner loop.  it only breaks when an accept handler
@@ -264,17 +297,16 @@ Scanner::Token::Type Scanner::Scan (
     // exist (see comments below).
     while (true)
     {
-        // clear the previous accepted/rejected string.
-        work_string.clear();
         // reset the char buffer and other stuff
         PrepareToScan_();
 
         bool was_at_end_of_input_ = IsAtEndOfInput();
 
-        std::uint32_t accept_handler_index_ = RunDfa_(work_string);
-        // if no valid accept_handler_index_ was returned, then work_string
-        // was filled with everything up to the char after the keep_string
-        // cursor (i.e. the rejected atom).
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        work_string.assign(AcceptedStringBegin_(), AcceptedStringEnd_());
         if (accept_handler_index_ >= ms_accept_handler_count_)
         {
             // if we were already at the end of input and no
@@ -287,9 +319,9 @@ Scanner::Token::Type Scanner::Scan (
 
             REFLEX_CPP_DEBUG_CODE_(
                 *DebugSpewStream() << 
-#line 277 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
 "CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 293 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 325 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
  << " rejecting string ";
                 PrintString_(*DebugSpewStream(), rejected_string);
                 *DebugSpewStream() << " (rejected_atom is \'";
@@ -302,11 +334,11 @@ Scanner::Token::Type Scanner::Scan (
             do
             {
 
-#line 263 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 255 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
     EmitError("unrecognized character " + CharLiteral(rejected_atom), GetFiLoc());
 
-#line 310 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 342 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
             }
             while (false);
@@ -318,9 +350,9 @@ Scanner::Token::Type Scanner::Scan (
 
             REFLEX_CPP_DEBUG_CODE_(
                 *DebugSpewStream() << 
-#line 277 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
 "CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 324 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 356 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
  << " accepting string ";
                 PrintString_(*DebugSpewStream(), accepted_string);
                 *DebugSpewStream() << " in state machine " << ms_state_machine_name_[CurrentStateMachine()]
@@ -333,14 +365,14 @@ Scanner::Token::Type Scanner::Scan (
                 case 0:
                 {
 
-#line 414 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 406 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         IncrementLineNumber(NewlineCount(accepted_string));
         if (token != NULL)
             Dsc<Ast::CodeBlock *>(token)->AppendText(accepted_string);
         SwitchToStateMachine(m_return_state);
     
-#line 344 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 376 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -348,7 +380,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 1:
                 {
 
-#line 422 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 414 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         IncrementLineNumber(NewlineCount(accepted_string));
         EmitWarning("unterminated block comment", GetFiLoc());
@@ -356,7 +388,7 @@ Scanner::Token::Type Scanner::Scan (
         token = NULL;
         return Token::END_OF_FILE;
     
-#line 360 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 392 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -364,13 +396,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 2:
                 {
 
-#line 492 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 484 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         SwitchToStateMachine(StateMachine::MAIN);
         return Token::CHAR_LITERAL;
     
-#line 374 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 406 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -378,7 +410,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 3:
                 {
 
-#line 499 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 491 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         EmitError("unterminated character literal", GetFiLoc());
         assert(token != NULL);
@@ -387,7 +419,7 @@ Scanner::Token::Type Scanner::Scan (
         SwitchToStateMachine(StateMachine::MAIN);
         return Token::END_OF_FILE;
     
-#line 391 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 423 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -395,7 +427,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 4:
                 {
 
-#line 509 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 501 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         EmitError("malformed character literal", GetFiLoc());
         if (accepted_string[0] == '\n')
@@ -406,7 +438,7 @@ Scanner::Token::Type Scanner::Scan (
         SwitchToStateMachine(StateMachine::MAIN);
         return Token::BAD_TOKEN;
     
-#line 410 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 442 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -414,7 +446,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 5:
                 {
 
-#line 434 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 426 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(accepted_string.length() >= 2);
         assert(accepted_string[0] == '\\');
@@ -424,7 +456,7 @@ Scanner::Token::Type Scanner::Scan (
         token = new Ast::Char(Uint8(value), GetFiLoc());
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 428 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 460 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -432,7 +464,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 6:
                 {
 
-#line 445 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 437 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(accepted_string.length() >= 3);
         assert(accepted_string[0] == '\\');
@@ -443,7 +475,7 @@ Scanner::Token::Type Scanner::Scan (
         token = new Ast::Char(Uint8(value), GetFiLoc());
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 447 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 479 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -451,7 +483,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 7:
                 {
 
-#line 457 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 449 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(accepted_string.length() == 2);
         assert(accepted_string[0] == '\\');
@@ -460,7 +492,7 @@ Scanner::Token::Type Scanner::Scan (
         token = ch;
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 464 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 496 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -468,13 +500,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 8:
                 {
 
-#line 467 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 459 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(accepted_string.length() == 1);
         token = new Ast::Char(Uint8(accepted_string[0]), GetFiLoc());
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 478 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 510 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -482,12 +514,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 9:
                 {
 
-#line 474 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 466 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         EmitError("unterminated character literal", GetFiLoc());
         return Token::END_OF_FILE;
     
-#line 491 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 523 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -495,7 +527,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 10:
                 {
 
-#line 480 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 472 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         EmitError("unexpected character " + CharLiteral(accepted_string[0]) + " in character literal", GetFiLoc());
         if (accepted_string[0] == '\n')
@@ -503,7 +535,7 @@ Scanner::Token::Type Scanner::Scan (
         token = new Ast::Char(Uint8(accepted_string[0]), GetFiLoc());
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_END);
     
-#line 507 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 539 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -511,14 +543,14 @@ Scanner::Token::Type Scanner::Scan (
                 case 11:
                 {
 
-#line 749 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 741 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         IncrementLineNumber(NewlineCount(accepted_string));
         Dsc<Ast::StrictCodeBlock *>(token)->AppendText(accepted_string);
         SwitchToStateMachine(StateMachine::STRICT_CODE_BLOCK);
     
-#line 522 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 554 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -526,7 +558,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 12:
                 {
 
-#line 757 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 749 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         delete token;
@@ -535,7 +567,7 @@ Scanner::Token::Type Scanner::Scan (
         IncrementLineNumber(NewlineCount(accepted_string));
         return Token::END_OF_FILE;
     
-#line 539 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 571 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -543,7 +575,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 13:
                 {
 
-#line 658 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 650 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         assert(accepted_string.length() >= 2);
@@ -554,7 +586,7 @@ Scanner::Token::Type Scanner::Scan (
         SwitchToStateMachine(StateMachine::MAIN);
         return Token::DUMB_CODE_BLOCK;
     
-#line 558 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 590 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -562,7 +594,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 14:
                 {
 
-#line 670 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 662 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         EmitError("unterminated dumb code block (looking for %} delimiter)", GetFiLoc());
         IncrementLineNumber(NewlineCount(accepted_string));
@@ -571,7 +603,7 @@ Scanner::Token::Type Scanner::Scan (
         token = NULL;
         return Token::END_OF_FILE;
     
-#line 575 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 607 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -579,12 +611,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 15:
                 {
 
-#line 330 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 322 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         m_return_state = StateMachine::MAIN;
         SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
     
-#line 588 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 620 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -592,9 +624,9 @@ Scanner::Token::Type Scanner::Scan (
                 case 16:
                 {
 
-#line 336 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 328 "../lib/commonlang/barf_commonlang_scanner.reflex"
  
-#line 598 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 630 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -602,11 +634,11 @@ Scanner::Token::Type Scanner::Scan (
                 case 17:
                 {
 
-#line 339 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 331 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_GUTS);
     
-#line 610 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 642 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -614,12 +646,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 18:
                 {
 
-#line 344 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 336 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         token = new Ast::String(GetFiLoc());
         SwitchToStateMachine(StateMachine::STRING_LITERAL_GUTS);
     
-#line 623 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 655 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -627,12 +659,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 19:
                 {
 
-#line 350 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 342 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         token = new Ast::String(GetFiLoc());
         SwitchToStateMachine(StateMachine::REGULAR_EXPRESSION);
     
-#line 636 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 668 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -640,12 +672,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 20:
                 {
 
-#line 356 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 348 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         token = new Ast::DumbCodeBlock(GetFiLoc());
         SwitchToStateMachine(StateMachine::DUMB_CODE_BLOCK);
     
-#line 649 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 681 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -653,12 +685,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 21:
                 {
 
-#line 362 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 354 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         token = new Ast::StrictCodeBlock(GetFiLoc());
         SwitchToStateMachine(StateMachine::STRICT_CODE_BLOCK);
     
-#line 662 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 694 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -666,11 +698,11 @@ Scanner::Token::Type Scanner::Scan (
                 case 22:
                 {
 
-#line 368 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 360 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         return Scanner::ParseDirective(accepted_string, token);
     
-#line 674 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 706 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -678,13 +710,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 23:
                 {
 
-#line 373 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 365 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         token = new Ast::ThrowAway(GetFiLoc());
         m_is_in_preamble = false;
         return Token::END_PREAMBLE;
     
-#line 688 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 720 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -692,12 +724,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 24:
                 {
 
-#line 380 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 372 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         token = new Ast::Id(accepted_string, GetFiLoc());
         return Token::ID;
     
-#line 701 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 733 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -705,11 +737,11 @@ Scanner::Token::Type Scanner::Scan (
                 case 25:
                 {
 
-#line 386 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 378 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         return Token::Type(accepted_string[0]);
     
-#line 713 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 745 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -717,9 +749,9 @@ Scanner::Token::Type Scanner::Scan (
                 case 26:
                 {
 
-#line 390 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 382 "../lib/commonlang/barf_commonlang_scanner.reflex"
  /* ignore all whitespace */ 
-#line 723 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 755 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -727,13 +759,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 27:
                 {
 
-#line 393 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 385 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         IncrementLineNumber();
         if (m_is_in_preamble)
             return Token::NEWLINE;
     
-#line 737 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 769 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -741,11 +773,11 @@ Scanner::Token::Type Scanner::Scan (
                 case 28:
                 {
 
-#line 400 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 392 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         return Token::END_OF_FILE;
     
-#line 749 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 781 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -753,12 +785,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 29:
                 {
 
-#line 405 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 397 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         EmitError("unexpected character " + CharLiteral(accepted_string[0]), GetFiLoc());
         return Token::BAD_TOKEN;
     
-#line 762 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 794 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -766,7 +798,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 30:
                 {
 
-#line 576 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 568 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         if (m_regex_paren_level == 0)
@@ -777,7 +809,7 @@ Scanner::Token::Type Scanner::Scan (
         --m_regex_paren_level;
         Dsc<Ast::String *>(token)->AppendText(accepted_string);
     
-#line 781 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 813 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -785,13 +817,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 31:
                 {
 
-#line 588 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 580 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         ++m_regex_paren_level;
         Dsc<Ast::String *>(token)->AppendText(accepted_string);
     
-#line 795 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 827 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -799,14 +831,14 @@ Scanner::Token::Type Scanner::Scan (
                 case 32:
                 {
 
-#line 595 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 587 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::String *>(token)->AppendText(accepted_string);
         m_regex_bracket_level = 0;
         SwitchToStateMachine(StateMachine::REGULAR_EXPRESSION_BRACKET_EXPRESSION);
     
-#line 810 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 842 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -814,13 +846,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 33:
                 {
 
-#line 603 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 595 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         IncrementLineNumber(NewlineCount(accepted_string));
         Dsc<Ast::String *>(token)->AppendText(accepted_string);
     
-#line 824 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 856 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -828,7 +860,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 34:
                 {
 
-#line 610 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 602 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         delete token;
@@ -836,7 +868,7 @@ Scanner::Token::Type Scanner::Scan (
         EmitError("unterminated regular expression", GetFiLoc());
         return Token::END_OF_FILE;
     
-#line 840 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 872 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -844,7 +876,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 35:
                 {
 
-#line 622 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 614 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::String *>(token)->AppendText(accepted_string);
@@ -853,7 +885,7 @@ Scanner::Token::Type Scanner::Scan (
         else
             --m_regex_bracket_level;
     
-#line 857 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 889 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -861,13 +893,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 36:
                 {
 
-#line 632 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 624 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::String *>(token)->AppendText(accepted_string);
         ++m_regex_bracket_level;
     
-#line 871 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 903 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -875,13 +907,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 37:
                 {
 
-#line 639 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 631 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         IncrementLineNumber(NewlineCount(accepted_string));
         Dsc<Ast::String *>(token)->AppendText(accepted_string);
     
-#line 885 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 917 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -889,7 +921,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 38:
                 {
 
-#line 646 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 638 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         delete token;
@@ -897,7 +929,7 @@ Scanner::Token::Type Scanner::Scan (
         EmitError("unterminated bracket expression inside regular expression", GetFiLoc());
         return Token::END_OF_FILE;
     
-#line 901 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 933 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -905,7 +937,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 39:
                 {
 
-#line 683 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 675 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         if (m_code_block_bracket_level == 0)
@@ -916,7 +948,7 @@ Scanner::Token::Type Scanner::Scan (
         --m_code_block_bracket_level;
         Dsc<Ast::CodeBlock *>(token)->AppendText(accepted_string);
     
-#line 920 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 952 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -924,13 +956,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 40:
                 {
 
-#line 695 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 687 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::CodeBlock *>(token)->AppendText(accepted_string);
         ++m_code_block_bracket_level;
     
-#line 934 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 966 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -938,13 +970,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 41:
                 {
 
-#line 702 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 694 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::CodeBlock *>(token)->AppendText(accepted_string);
         SwitchToStateMachine(StateMachine::CHAR_LITERAL_INSIDE_STRICT_CODE_BLOCK);
     
-#line 948 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 980 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -952,13 +984,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 42:
                 {
 
-#line 709 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 701 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::CodeBlock *>(token)->AppendText(accepted_string);
         SwitchToStateMachine(StateMachine::STRING_LITERAL_INSIDE_STRICT_CODE_BLOCK);
     
-#line 962 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 994 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -966,14 +998,14 @@ Scanner::Token::Type Scanner::Scan (
                 case 43:
                 {
 
-#line 716 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 708 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::CodeBlock *>(token)->AppendText(accepted_string);
         m_return_state = StateMachine::STRICT_CODE_BLOCK;
         SwitchToStateMachine(StateMachine::BLOCK_COMMENT);
     
-#line 977 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1009 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -981,12 +1013,12 @@ Scanner::Token::Type Scanner::Scan (
                 case 44:
                 {
 
-#line 724 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 716 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::CodeBlock *>(token)->AppendText(accepted_string);
     
-#line 990 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1022 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -994,13 +1026,13 @@ Scanner::Token::Type Scanner::Scan (
                 case 45:
                 {
 
-#line 730 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 722 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         IncrementLineNumber(NewlineCount(accepted_string));
         Dsc<Ast::CodeBlock *>(token)->AppendText(accepted_string);
     
-#line 1004 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1036 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -1008,7 +1040,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 46:
                 {
 
-#line 737 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 729 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         delete token;
@@ -1016,7 +1048,7 @@ Scanner::Token::Type Scanner::Scan (
         EmitError("unterminated strict code block", GetFiLoc());
         return Token::END_OF_FILE;
     
-#line 1020 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1052 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -1024,7 +1056,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 47:
                 {
 
-#line 524 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 516 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         IncrementLineNumber(NewlineCount(accepted_string));
@@ -1062,7 +1094,7 @@ Scanner::Token::Type Scanner::Scan (
         SwitchToStateMachine(StateMachine::MAIN);
         return Token::STRING_LITERAL;
     
-#line 1066 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1098 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -1070,7 +1102,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 48:
                 {
 
-#line 563 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 555 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         EmitError("unterminated string literal", GetFiLoc());
         IncrementLineNumber(NewlineCount(accepted_string));
@@ -1079,7 +1111,7 @@ Scanner::Token::Type Scanner::Scan (
         token = NULL;
         return Token::END_OF_FILE;
     
-#line 1083 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1115 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -1087,14 +1119,14 @@ Scanner::Token::Type Scanner::Scan (
                 case 49:
                 {
 
-#line 770 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 762 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         Dsc<Ast::StrictCodeBlock *>(token)->AppendText(accepted_string);
         IncrementLineNumber(NewlineCount(accepted_string));
         SwitchToStateMachine(StateMachine::STRICT_CODE_BLOCK);
     
-#line 1098 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1130 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -1102,7 +1134,7 @@ Scanner::Token::Type Scanner::Scan (
                 case 50:
                 {
 
-#line 778 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 770 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
         assert(token != NULL);
         delete token;
@@ -1111,7 +1143,7 @@ Scanner::Token::Type Scanner::Scan (
         IncrementLineNumber(NewlineCount(accepted_string));
         return Token::END_OF_FILE;
     
-#line 1115 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1147 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 
                 }
                 break;
@@ -1122,42 +1154,42 @@ Scanner::Token::Type Scanner::Scan (
     }
 
 
-#line 249 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 241 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
     assert(false && "you didn't handle EOF properly");
     return Token::BAD_END_OF_FILE;
 
-#line 1131 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1163 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
 }
 
 void Scanner::KeepString ()
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
-#line 277 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
 "CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 1139 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1171 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
  << " keeping string" << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::KeepString();
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::KeepString();
 }
 
 void Scanner::Unaccept (std::uint32_t unaccept_char_count)
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
-#line 277 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
 "CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 1149 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1181 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
  << " unaccepting " << unaccept_char_count << " char" << (unaccept_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::Unaccept(unaccept_char_count);
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::Unaccept(unaccept_char_count);
 }
 
 void Scanner::Unreject (std::uint32_t unreject_char_count)
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
-#line 277 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 269 "../lib/commonlang/barf_commonlang_scanner.reflex"
 "CommonLang::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 1159 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 1191 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
  << " unrejecting " << unreject_char_count << " char" << (unreject_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::Unreject(unreject_char_count);
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::Unreject(unreject_char_count);
 }
 
 // ///////////////////////////////////////////////////////////////////////
@@ -1181,6 +1213,11 @@ void Scanner::PrintAtom_ (std::ostream &out, std::uint8_t atom)
 }
 
 void Scanner::PrintString_ (std::ostream &out, std::string const &s)
+{
+    PrintString_(out, s.data(), s.length());
+}
+
+void Scanner::PrintString_ (std::ostream &out, char const *s, std::size_t length)
 {
     // save the existing ostream properties for later restoration
     std::ios_base::fmtflags saved_stream_flags = out.flags();
@@ -1200,7 +1237,7 @@ void Scanner::PrintString_ (std::ostream &out, std::string const &s)
     out.fill('0');
 
     out << '"';
-    for (std::string::size_type i = 0; i < s.size(); ++i)
+    for (std::size_t i = 0; i < length; ++i)
         PrintAtom_(out, s[i]);
     out << '"';
 
@@ -1214,16 +1251,16 @@ void Scanner::PrintString_ (std::ostream &out, std::string const &s)
 std::uint32_t const Scanner::ms_state_machine_start_state_index_[] =
 {
     0,
-    10,
-    17,
-    30,
-    40,
-    50,
-    72,
-    83,
-    93,
-    104,
-    114,
+    9,
+    16,
+    28,
+    37,
+    46,
+    67,
+    77,
+    86,
+    97,
+    106,
 };
 std::uint8_t const Scanner::ms_state_machine_mode_flags_[] =
 {
@@ -1257,136 +1294,127 @@ std::uint32_t const Scanner::ms_state_machine_count_ = sizeof(Scanner::ms_state_
 
 // the order of the states indicates priority (only for accept states).
 // the lower the state's index in this array, the higher its priority.
-ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaState_ const Scanner::ms_state_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaState_ const Scanner::ms_state_table_[] =
 {
-    { 51, 32, 0, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 32, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 1, 255, 319, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 574, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 606, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 0, 32, 861, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 0, 255, 893, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 0, 255, 1148, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 1, 255, 1403, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 1658, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 1690, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 4, 0, 1945, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 2, 0, 1945, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 4, 32, 1945, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 3, 0, 1977, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 3, 255, 1977, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 2232, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 2264, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 10, 0, 2519, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 8, 0, 2519, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 10, 32, 2519, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 10, 95, 2551, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 32 },
-    { 7, 0, 2646, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 5, 8, 2646, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 5, 8, 2654, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 7, 55, 2662, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 6, 55, 2717, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 9, 95, 2772, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 32 },
-    { 9, 255, 2867, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 3122, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 3154, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 3409, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 12, 255, 3441, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 11, 32, 3696, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 11, 255, 3728, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 3983, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 4015, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 12, 255, 4270, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 11, 255, 4525, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 4780, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 4812, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 5067, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 14, 255, 5099, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 5354, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 5386, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 13, 32, 5641, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 13, 255, 5673, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 13, 255, 5928, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 14, 255, 6183, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 6438, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 6470, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 29, 0, 6725, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 26, 0, 6725, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 27, 0, 6725, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 25, 0, 6725, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 18, 0, 6725, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 29, 87, 6725, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 37 },
-    { 23, 0, 6812, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 22, 75, 6812, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 51, 75, 6887, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 20, 0, 6962, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 17, 0, 6962, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 19, 0, 6962, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 29, 6, 6962, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 42 },
-    { 15, 0, 6968, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 16, 255, 6968, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 24, 75, 7223, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 24, 75, 7298, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 51, 75, 7373, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 21, 0, 7448, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 28, 255, 7448, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 7703, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 7735, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 33, 255, 7990, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 255, 8245, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 31, 0, 8500, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 30, 0, 8500, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 32, 0, 8500, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 51, 32, 8500, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 8532, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 34, 255, 8787, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 34, 255, 9042, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 9297, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 9329, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 37, 255, 9584, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 255, 9839, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 36, 0, 10094, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 51, 32, 10094, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 10126, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 38, 255, 10381, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 35, 0, 10636, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 38, 255, 10636, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 10891, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 10923, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 45, 255, 11178, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 42, 0, 11433, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 41, 0, 11433, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 45, 6, 11433, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 42 },
-    { 43, 0, 11439, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 44, 255, 11439, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 40, 0, 11694, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 39, 0, 11694, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 46, 255, 11694, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 11949, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 11981, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 12236, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 48, 255, 12268, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 47, 32, 12523, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 47, 255, 12555, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 12810, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 12842, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 48, 255, 13097, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 47, 255, 13352, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 13607, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 13639, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 13894, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 50, 255, 13926, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 49, 32, 14181, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 49, 255, 14213, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 51, 32, 14468, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 51, 255, 14500, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 50, 255, 14755, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 49, 255, 15010, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 }
+    { 0, 51, 32, 2, 0 },
+    { 32, 51, 25, 0, 0 },
+    { 57, 51, 32, 2, 0 },
+    { 89, 1, 25, 0, 0 },
+    { 114, 51, 32, 2, 0 },
+    { 146, 51, 25, 0, 0 },
+    { 171, 0, 32, 2, 0 },
+    { 203, 0, 25, 0, 0 },
+    { 228, 1, 25, 0, 0 },
+    { 253, 51, 32, 2, 0 },
+    { 285, 51, 25, 0, 0 },
+    { 310, 4, 0, 0, 0 },
+    { 310, 2, 0, 0, 0 },
+    { 310, 4, 32, 2, 0 },
+    { 342, 3, 0, 0, 0 },
+    { 342, 3, 25, 0, 0 },
+    { 367, 51, 32, 2, 0 },
+    { 399, 51, 25, 0, 0 },
+    { 424, 10, 0, 0, 0 },
+    { 424, 8, 0, 0, 0 },
+    { 424, 10, 32, 2, 0 },
+    { 456, 10, 25, 0, 0 },
+    { 481, 7, 0, 0, 0 },
+    { 481, 5, 25, 0, 1 },
+    { 506, 7, 25, 0, 0 },
+    { 531, 6, 25, 0, 2 },
+    { 556, 9, 25, 0, 0 },
+    { 581, 9, 25, 0, 0 },
+    { 606, 51, 32, 2, 0 },
+    { 638, 51, 25, 0, 0 },
+    { 663, 51, 32, 2, 0 },
+    { 695, 12, 25, 0, 0 },
+    { 720, 11, 32, 2, 0 },
+    { 752, 11, 25, 0, 0 },
+    { 777, 51, 32, 2, 0 },
+    { 809, 51, 25, 0, 0 },
+    { 834, 12, 25, 0, 0 },
+    { 859, 51, 32, 2, 0 },
+    { 891, 51, 25, 0, 0 },
+    { 916, 51, 32, 2, 0 },
+    { 948, 14, 25, 0, 0 },
+    { 973, 51, 32, 2, 0 },
+    { 1005, 51, 25, 0, 0 },
+    { 1030, 13, 32, 2, 0 },
+    { 1062, 13, 25, 0, 0 },
+    { 1087, 14, 25, 0, 0 },
+    { 1112, 51, 32, 2, 0 },
+    { 1144, 51, 25, 0, 0 },
+    { 1169, 29, 0, 0, 0 },
+    { 1169, 26, 0, 0, 0 },
+    { 1169, 27, 0, 0, 0 },
+    { 1169, 25, 0, 0, 0 },
+    { 1169, 18, 0, 0, 0 },
+    { 1169, 29, 25, 0, 0 },
+    { 1194, 23, 0, 0, 0 },
+    { 1194, 22, 25, 0, 3 },
+    { 1219, 51, 25, 0, 4 },
+    { 1244, 20, 0, 0, 0 },
+    { 1244, 17, 0, 0, 0 },
+    { 1244, 19, 0, 0, 0 },
+    { 1244, 29, 25, 0, 0 },
+    { 1269, 15, 0, 0, 0 },
+    { 1269, 16, 25, 0, 5 },
+    { 1294, 24, 25, 0, 3 },
+    { 1319, 51, 25, 0, 4 },
+    { 1344, 21, 0, 0, 0 },
+    { 1344, 28, 25, 0, 0 },
+    { 1369, 51, 32, 2, 0 },
+    { 1401, 51, 25, 0, 0 },
+    { 1426, 33, 25, 0, 6 },
+    { 1451, 51, 25, 0, 0 },
+    { 1476, 31, 0, 0, 0 },
+    { 1476, 30, 0, 0, 0 },
+    { 1476, 32, 0, 0, 0 },
+    { 1476, 51, 32, 2, 0 },
+    { 1508, 34, 25, 0, 0 },
+    { 1533, 34, 25, 0, 0 },
+    { 1558, 51, 32, 2, 0 },
+    { 1590, 51, 25, 0, 0 },
+    { 1615, 37, 25, 0, 7 },
+    { 1640, 51, 25, 0, 0 },
+    { 1665, 36, 0, 0, 0 },
+    { 1665, 51, 32, 2, 0 },
+    { 1697, 38, 25, 0, 0 },
+    { 1722, 35, 0, 0, 0 },
+    { 1722, 38, 25, 0, 0 },
+    { 1747, 51, 32, 2, 0 },
+    { 1779, 51, 25, 0, 0 },
+    { 1804, 45, 25, 0, 8 },
+    { 1829, 42, 0, 0, 0 },
+    { 1829, 41, 0, 0, 0 },
+    { 1829, 45, 25, 0, 0 },
+    { 1854, 43, 0, 0, 0 },
+    { 1854, 44, 25, 0, 5 },
+    { 1879, 40, 0, 0, 0 },
+    { 1879, 39, 0, 0, 0 },
+    { 1879, 46, 25, 0, 0 },
+    { 1904, 51, 32, 2, 0 },
+    { 1936, 51, 25, 0, 0 },
+    { 1961, 51, 32, 2, 0 },
+    { 1993, 48, 25, 0, 0 },
+    { 2018, 47, 32, 2, 0 },
+    { 2050, 47, 25, 0, 0 },
+    { 2075, 51, 32, 2, 0 },
+    { 2107, 51, 25, 0, 0 },
+    { 2132, 48, 25, 0, 0 },
+    { 2157, 51, 32, 2, 0 },
+    { 2189, 51, 25, 0, 0 },
+    { 2214, 51, 32, 2, 0 },
+    { 2246, 50, 25, 0, 0 },
+    { 2271, 49, 32, 2, 0 },
+    { 2303, 49, 25, 0, 0 },
+    { 2328, 51, 32, 2, 0 },
+    { 2360, 51, 25, 0, 0 },
+    { 2385, 50, 25, 0, 0 }
 };
 std::size_t const Scanner::ms_state_count_ = sizeof(Scanner::ms_state_table_) / sizeof(*Scanner::ms_state_table_);
 
-ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const Scanner::ms_transition_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaTransition_ const Scanner::ms_transition_table_[] =
 {
     { 1 },
     { 1 },
@@ -1420,36 +1448,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 1 },
     { 3 },
     { 3 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
+    { 115 },
     { 2 },
     { 2 },
     { 2 },
@@ -1474,6 +1473,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 1 },
+    { 1 },
+    { 3 },
+    { 3 },
+    { 115 },
     { 2 },
     { 2 },
     { 2 },
@@ -1485,6 +1517,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
     { 2 },
@@ -1497,6 +1530,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 5 },
+    { 5 },
+    { 8 },
+    { 8 },
+    { 115 },
     { 2 },
     { 2 },
     { 2 },
@@ -1508,6 +1574,8 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
+    { 6 },
     { 2 },
     { 2 },
     { 2 },
@@ -1519,6 +1587,39 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 7 },
+    { 115 },
     { 2 },
     { 2 },
     { 2 },
@@ -1530,6 +1631,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
     { 2 },
     { 2 },
     { 2 },
@@ -1542,6 +1644,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 115 },
     { 2 },
     { 2 },
     { 2 },
@@ -1553,6 +1656,8 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 4 },
+    { 6 },
     { 2 },
     { 2 },
     { 2 },
@@ -1564,15098 +1669,2278 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 1 },
-    { 1 },
-    { 3 },
-    { 3 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 5 },
-    { 5 },
-    { 9 },
-    { 9 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 6 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 7 },
-    { 7 },
-    { 8 },
-    { 8 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 4 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 6 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 11 },
-    { 11 },
-    { 16 },
-    { 16 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 13 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 14 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 15 },
-    { 15 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 13 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 14 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 12 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 18 },
-    { 18 },
-    { 29 },
-    { 29 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 21 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 22 },
-    { 22 },
-    { 28 },
-    { 28 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 26 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 27 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 26 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 21 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 20 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 34 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 36 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 31 },
-    { 31 },
-    { 33 },
-    { 33 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 34 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 36 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 35 },
-    { 35 },
-    { 39 },
-    { 39 },
-    { 35 },
-    { 35 },
-    { 39 },
-    { 39 },
-    { 35 },
-    { 35 },
-    { 39 },
-    { 39 },
-    { 35 },
-    { 35 },
-    { 39 },
-    { 39 },
-    { 35 },
-    { 35 },
-    { 39 },
-    { 39 },
-    { 35 },
-    { 35 },
-    { 39 },
-    { 39 },
-    { 35 },
-    { 35 },
-    { 39 },
-    { 39 },
-    { 35 },
-    { 35 },
-    { 39 },
-    { 39 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 34 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 36 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 37 },
-    { 37 },
-    { 38 },
-    { 38 },
-    { 37 },
-    { 37 },
-    { 38 },
-    { 38 },
-    { 37 },
-    { 37 },
-    { 38 },
-    { 38 },
-    { 37 },
-    { 37 },
-    { 38 },
-    { 38 },
-    { 37 },
-    { 37 },
-    { 38 },
-    { 38 },
-    { 37 },
-    { 37 },
-    { 38 },
-    { 38 },
-    { 37 },
-    { 37 },
-    { 38 },
-    { 38 },
-    { 37 },
-    { 37 },
-    { 38 },
-    { 38 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 34 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 36 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 32 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 44 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 41 },
-    { 41 },
-    { 43 },
-    { 43 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 44 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 45 },
-    { 45 },
-    { 49 },
-    { 49 },
-    { 45 },
-    { 45 },
-    { 49 },
-    { 49 },
-    { 45 },
-    { 45 },
-    { 49 },
-    { 49 },
-    { 45 },
-    { 45 },
-    { 49 },
-    { 49 },
-    { 45 },
-    { 45 },
-    { 49 },
-    { 49 },
-    { 45 },
-    { 45 },
-    { 49 },
-    { 49 },
-    { 45 },
-    { 45 },
-    { 49 },
-    { 49 },
-    { 45 },
-    { 45 },
-    { 49 },
-    { 49 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 44 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 46 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 47 },
-    { 47 },
-    { 48 },
-    { 48 },
-    { 47 },
-    { 47 },
-    { 48 },
-    { 48 },
-    { 47 },
-    { 47 },
-    { 48 },
-    { 48 },
-    { 47 },
-    { 47 },
-    { 48 },
-    { 48 },
-    { 47 },
-    { 47 },
-    { 48 },
-    { 48 },
-    { 47 },
-    { 47 },
-    { 48 },
-    { 48 },
-    { 47 },
-    { 47 },
-    { 48 },
-    { 48 },
-    { 47 },
-    { 47 },
-    { 48 },
-    { 48 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 44 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 44 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 44 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 46 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 42 },
-    { 51 },
-    { 51 },
-    { 71 },
-    { 71 },
-    { 51 },
-    { 51 },
-    { 71 },
-    { 71 },
-    { 51 },
-    { 51 },
-    { 71 },
-    { 71 },
-    { 51 },
-    { 51 },
-    { 71 },
-    { 71 },
-    { 51 },
-    { 51 },
-    { 71 },
-    { 71 },
-    { 51 },
-    { 51 },
-    { 71 },
-    { 71 },
-    { 51 },
-    { 51 },
-    { 71 },
-    { 71 },
-    { 51 },
-    { 51 },
-    { 71 },
-    { 71 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 54 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 55 },
-    { 56 },
-    { 52 },
-    { 52 },
-    { 57 },
-    { 52 },
-    { 62 },
-    { 63 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 55 },
-    { 64 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 55 },
-    { 55 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 55 },
-    { 52 },
-    { 55 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 70 },
-    { 55 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 58 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 61 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 60 },
-    { 124 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 60 },
-    { 124 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 59 },
-    { 65 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 124 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 66 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 69 },
-    { 124 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 69 },
-    { 124 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 69 },
-    { 124 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 68 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 54 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 53 },
-    { 55 },
-    { 56 },
-    { 52 },
-    { 52 },
-    { 57 },
-    { 52 },
-    { 62 },
-    { 63 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 55 },
-    { 64 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 55 },
-    { 55 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 55 },
-    { 52 },
-    { 55 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 67 },
-    { 70 },
-    { 55 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 52 },
-    { 73 },
-    { 73 },
-    { 82 },
-    { 82 },
-    { 73 },
-    { 73 },
-    { 82 },
-    { 82 },
-    { 73 },
-    { 73 },
-    { 82 },
-    { 82 },
-    { 73 },
-    { 73 },
-    { 82 },
-    { 82 },
-    { 73 },
-    { 73 },
-    { 82 },
-    { 82 },
-    { 73 },
-    { 73 },
-    { 82 },
-    { 82 },
-    { 73 },
-    { 73 },
-    { 82 },
-    { 82 },
-    { 73 },
-    { 73 },
-    { 82 },
-    { 82 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 76 },
-    { 77 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 78 },
-    { 79 },
-    { 124 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 124 },
-    { 124 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 124 },
-    { 75 },
-    { 124 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 80 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 80 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 80 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 80 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 80 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 80 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 80 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 80 },
-    { 80 },
-    { 81 },
-    { 81 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 76 },
-    { 77 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 78 },
-    { 79 },
-    { 124 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 74 },
-    { 84 },
-    { 84 },
-    { 92 },
-    { 92 },
-    { 84 },
-    { 84 },
-    { 92 },
-    { 92 },
-    { 84 },
-    { 84 },
-    { 92 },
-    { 92 },
-    { 84 },
-    { 84 },
-    { 92 },
-    { 92 },
-    { 84 },
-    { 84 },
-    { 92 },
-    { 92 },
-    { 84 },
-    { 84 },
-    { 92 },
-    { 92 },
-    { 84 },
-    { 84 },
-    { 92 },
-    { 92 },
-    { 84 },
-    { 84 },
-    { 92 },
-    { 92 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 87 },
-    { 88 },
-    { 91 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 124 },
-    { 86 },
-    { 124 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 89 },
-    { 89 },
-    { 90 },
-    { 90 },
-    { 89 },
-    { 89 },
-    { 90 },
-    { 90 },
-    { 89 },
-    { 89 },
-    { 90 },
-    { 90 },
-    { 89 },
-    { 89 },
-    { 90 },
-    { 90 },
-    { 89 },
-    { 89 },
-    { 90 },
-    { 90 },
-    { 89 },
-    { 89 },
-    { 90 },
-    { 90 },
-    { 89 },
-    { 89 },
-    { 90 },
-    { 90 },
-    { 89 },
-    { 89 },
-    { 90 },
-    { 90 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 87 },
-    { 88 },
-    { 91 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 85 },
-    { 94 },
-    { 94 },
-    { 103 },
-    { 103 },
-    { 94 },
-    { 94 },
-    { 103 },
-    { 103 },
-    { 94 },
-    { 94 },
-    { 103 },
-    { 103 },
-    { 94 },
-    { 94 },
-    { 103 },
-    { 103 },
-    { 94 },
-    { 94 },
-    { 103 },
-    { 103 },
-    { 94 },
-    { 94 },
-    { 103 },
-    { 103 },
-    { 94 },
-    { 94 },
-    { 103 },
-    { 103 },
-    { 94 },
-    { 94 },
-    { 103 },
-    { 103 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 96 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 97 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 98 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 101 },
-    { 95 },
-    { 102 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 124 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 124 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 124 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 124 },
-    { 95 },
-    { 124 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 99 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 124 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 124 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 100 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 96 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 97 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 98 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 101 },
-    { 95 },
-    { 102 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
-    { 95 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 10 },
+    { 10 },
+    { 15 },
+    { 15 },
+    { 115 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 12 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 13 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 11 },
+    { 11 },
+    { 14 },
+    { 14 },
+    { 115 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 12 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 13 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 17 },
+    { 17 },
+    { 27 },
+    { 27 },
+    { 115 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 20 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 21 },
+    { 21 },
+    { 26 },
+    { 26 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 23 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 24 },
+    { 22 },
+    { 22 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 23 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 25 },
+    { 25 },
+    { 25 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 23 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 22 },
+    { 24 },
+    { 22 },
+    { 22 },
+    { 115 },
+    { 18 },
+    { 18 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 18 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 20 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 19 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 115 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 32 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 34 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 29 },
+    { 29 },
+    { 31 },
+    { 31 },
+    { 115 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 32 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 34 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 33 },
+    { 115 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 32 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 34 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 35 },
+    { 35 },
+    { 36 },
+    { 36 },
+    { 35 },
+    { 35 },
+    { 36 },
+    { 36 },
+    { 35 },
+    { 35 },
+    { 36 },
+    { 36 },
+    { 35 },
+    { 35 },
+    { 36 },
+    { 36 },
+    { 35 },
+    { 35 },
+    { 36 },
+    { 36 },
+    { 35 },
+    { 35 },
+    { 36 },
+    { 36 },
+    { 35 },
+    { 35 },
+    { 36 },
+    { 36 },
+    { 35 },
+    { 35 },
+    { 36 },
+    { 36 },
+    { 115 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 115 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 30 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 115 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 41 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 38 },
+    { 38 },
+    { 40 },
+    { 40 },
+    { 115 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 41 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 42 },
+    { 42 },
+    { 45 },
+    { 45 },
+    { 42 },
+    { 42 },
+    { 45 },
+    { 45 },
+    { 42 },
+    { 42 },
+    { 45 },
+    { 45 },
+    { 42 },
+    { 42 },
+    { 45 },
+    { 45 },
+    { 42 },
+    { 42 },
+    { 45 },
+    { 45 },
+    { 42 },
+    { 42 },
+    { 45 },
+    { 45 },
+    { 42 },
+    { 42 },
+    { 45 },
+    { 45 },
+    { 42 },
+    { 42 },
+    { 45 },
+    { 45 },
+    { 115 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 41 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 43 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 44 },
+    { 115 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 41 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 115 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 41 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 39 },
+    { 43 },
+    { 47 },
+    { 47 },
+    { 66 },
+    { 66 },
+    { 47 },
+    { 47 },
+    { 66 },
+    { 66 },
+    { 47 },
+    { 47 },
+    { 66 },
+    { 66 },
+    { 47 },
+    { 47 },
+    { 66 },
+    { 66 },
+    { 47 },
+    { 47 },
+    { 66 },
+    { 66 },
+    { 47 },
+    { 47 },
+    { 66 },
+    { 66 },
+    { 47 },
+    { 47 },
+    { 66 },
+    { 66 },
+    { 47 },
+    { 47 },
+    { 66 },
+    { 66 },
+    { 115 },
+    { 48 },
+    { 49 },
+    { 50 },
+    { 49 },
+    { 51 },
+    { 52 },
+    { 48 },
+    { 53 },
+    { 58 },
+    { 59 },
+    { 48 },
+    { 48 },
+    { 60 },
+    { 48 },
+    { 48 },
+    { 63 },
+    { 63 },
+    { 51 },
+    { 48 },
+    { 51 },
+    { 48 },
+    { 63 },
+    { 65 },
+    { 48 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 54 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 55 },
+    { 55 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 55 },
+    { 57 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 55 },
+    { 55 },
+    { 55 },
+    { 55 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 56 },
+    { 55 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 55 },
+    { 55 },
+    { 55 },
+    { 55 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 56 },
+    { 55 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 61 },
+    { 62 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 62 },
+    { 62 },
+    { 115 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 62 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 64 },
+    { 63 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 63 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 64 },
+    { 63 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 48 },
+    { 49 },
+    { 50 },
+    { 49 },
+    { 51 },
+    { 52 },
+    { 48 },
+    { 53 },
+    { 58 },
+    { 59 },
+    { 48 },
+    { 48 },
+    { 60 },
+    { 48 },
+    { 48 },
+    { 63 },
+    { 63 },
+    { 51 },
+    { 48 },
+    { 51 },
+    { 48 },
+    { 63 },
+    { 65 },
+    { 48 },
+    { 68 },
+    { 68 },
+    { 76 },
+    { 76 },
+    { 68 },
+    { 68 },
+    { 76 },
+    { 76 },
+    { 68 },
+    { 68 },
+    { 76 },
+    { 76 },
+    { 68 },
+    { 68 },
+    { 76 },
+    { 76 },
+    { 68 },
+    { 68 },
+    { 76 },
+    { 76 },
+    { 68 },
+    { 68 },
+    { 76 },
+    { 76 },
+    { 68 },
+    { 68 },
+    { 76 },
+    { 76 },
+    { 68 },
+    { 68 },
+    { 76 },
+    { 76 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 71 },
+    { 72 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 73 },
+    { 74 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 115 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 115 },
+    { 70 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 70 },
+    { 70 },
+    { 75 },
+    { 75 },
+    { 70 },
+    { 70 },
+    { 75 },
+    { 75 },
+    { 70 },
+    { 70 },
+    { 75 },
+    { 75 },
+    { 70 },
+    { 70 },
+    { 75 },
+    { 75 },
+    { 70 },
+    { 70 },
+    { 75 },
+    { 75 },
+    { 70 },
+    { 70 },
+    { 75 },
+    { 75 },
+    { 70 },
+    { 70 },
+    { 75 },
+    { 75 },
+    { 70 },
+    { 70 },
+    { 75 },
+    { 75 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 71 },
+    { 72 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 73 },
+    { 74 },
+    { 115 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 69 },
+    { 78 },
+    { 78 },
+    { 85 },
+    { 85 },
+    { 78 },
+    { 78 },
+    { 85 },
+    { 85 },
+    { 78 },
+    { 78 },
+    { 85 },
+    { 85 },
+    { 78 },
+    { 78 },
+    { 85 },
+    { 85 },
+    { 78 },
+    { 78 },
+    { 85 },
+    { 85 },
+    { 78 },
+    { 78 },
+    { 85 },
+    { 85 },
+    { 78 },
+    { 78 },
+    { 85 },
+    { 85 },
+    { 78 },
+    { 78 },
+    { 85 },
+    { 85 },
+    { 115 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 81 },
+    { 82 },
+    { 84 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 115 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 115 },
+    { 80 },
+    { 115 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 115 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 80 },
+    { 80 },
+    { 83 },
+    { 83 },
+    { 80 },
+    { 80 },
+    { 83 },
+    { 83 },
+    { 80 },
+    { 80 },
+    { 83 },
+    { 83 },
+    { 80 },
+    { 80 },
+    { 83 },
+    { 83 },
+    { 80 },
+    { 80 },
+    { 83 },
+    { 83 },
+    { 80 },
+    { 80 },
+    { 83 },
+    { 83 },
+    { 80 },
+    { 80 },
+    { 83 },
+    { 83 },
+    { 80 },
+    { 80 },
+    { 83 },
+    { 83 },
+    { 115 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 115 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 81 },
+    { 82 },
+    { 84 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 79 },
+    { 87 },
+    { 87 },
+    { 96 },
+    { 96 },
+    { 87 },
+    { 87 },
+    { 96 },
+    { 96 },
+    { 87 },
+    { 87 },
+    { 96 },
+    { 96 },
+    { 87 },
+    { 87 },
+    { 96 },
+    { 96 },
+    { 87 },
+    { 87 },
+    { 96 },
+    { 96 },
+    { 87 },
+    { 87 },
+    { 96 },
+    { 96 },
+    { 87 },
+    { 87 },
+    { 96 },
+    { 96 },
+    { 87 },
+    { 87 },
+    { 96 },
+    { 96 },
+    { 115 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 89 },
+    { 88 },
+    { 88 },
+    { 90 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 91 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 94 },
     { 95 },
+    { 115 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 115 },
+    { 88 },
+    { 88 },
+    { 115 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 115 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 92 },
+    { 93 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 115 },
+    { 93 },
+    { 93 },
+    { 115 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 93 },
+    { 115 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 89 },
+    { 88 },
+    { 88 },
+    { 90 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 91 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 88 },
+    { 94 },
     { 95 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 115 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 101 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 103 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 98 },
+    { 98 },
+    { 100 },
+    { 100 },
+    { 115 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 101 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 103 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 102 },
+    { 115 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 101 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 103 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 104 },
+    { 104 },
     { 105 },
     { 105 },
-    { 107 },
-    { 107 },
-    { 105 },
-    { 105 },
-    { 107 },
-    { 107 },
+    { 104 },
+    { 104 },
     { 105 },
     { 105 },
-    { 107 },
-    { 107 },
+    { 104 },
+    { 104 },
     { 105 },
     { 105 },
-    { 107 },
-    { 107 },
+    { 104 },
+    { 104 },
     { 105 },
     { 105 },
-    { 107 },
-    { 107 },
+    { 104 },
+    { 104 },
     { 105 },
     { 105 },
-    { 107 },
-    { 107 },
+    { 104 },
+    { 104 },
     { 105 },
     { 105 },
-    { 107 },
-    { 107 },
+    { 104 },
+    { 104 },
     { 105 },
     { 105 },
-    { 107 },
-    { 107 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 108 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 110 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
+    { 104 },
+    { 104 },
     { 105 },
     { 105 },
+    { 115 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 115 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
+    { 99 },
     { 107 },
     { 107 },
-    { 105 },
-    { 105 },
+    { 109 },
+    { 109 },
     { 107 },
     { 107 },
-    { 105 },
-    { 105 },
+    { 109 },
+    { 109 },
     { 107 },
     { 107 },
-    { 105 },
-    { 105 },
+    { 109 },
+    { 109 },
     { 107 },
     { 107 },
-    { 105 },
-    { 105 },
+    { 109 },
+    { 109 },
     { 107 },
     { 107 },
-    { 105 },
-    { 105 },
+    { 109 },
+    { 109 },
     { 107 },
     { 107 },
-    { 105 },
-    { 105 },
+    { 109 },
+    { 109 },
     { 107 },
     { 107 },
-    { 105 },
-    { 105 },
+    { 109 },
+    { 109 },
     { 107 },
     { 107 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
+    { 109 },
+    { 109 },
+    { 115 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
     { 108 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
     { 110 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 112 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 107 },
+    { 107 },
     { 109 },
     { 109 },
-    { 113 },
-    { 113 },
+    { 107 },
+    { 107 },
     { 109 },
     { 109 },
-    { 113 },
-    { 113 },
+    { 107 },
+    { 107 },
     { 109 },
     { 109 },
-    { 113 },
-    { 113 },
+    { 107 },
+    { 107 },
     { 109 },
     { 109 },
-    { 113 },
-    { 113 },
+    { 107 },
+    { 107 },
     { 109 },
     { 109 },
-    { 113 },
-    { 113 },
+    { 107 },
+    { 107 },
     { 109 },
     { 109 },
-    { 113 },
-    { 113 },
+    { 107 },
+    { 107 },
     { 109 },
     { 109 },
-    { 113 },
-    { 113 },
+    { 107 },
+    { 107 },
     { 109 },
     { 109 },
-    { 113 },
-    { 113 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
+    { 115 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
     { 108 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
     { 110 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 112 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
     { 111 },
     { 111 },
-    { 112 },
-    { 112 },
     { 111 },
     { 111 },
-    { 112 },
-    { 112 },
     { 111 },
     { 111 },
-    { 112 },
-    { 112 },
     { 111 },
     { 111 },
-    { 112 },
-    { 112 },
     { 111 },
     { 111 },
-    { 112 },
-    { 112 },
     { 111 },
     { 111 },
-    { 112 },
-    { 112 },
     { 111 },
     { 111 },
-    { 112 },
-    { 112 },
     { 111 },
     { 111 },
-    { 112 },
-    { 112 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 111 },
+    { 115 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
     { 108 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
     { 110 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 106 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 118 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 120 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 115 },
-    { 115 },
-    { 117 },
-    { 117 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 118 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 120 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 119 },
-    { 119 },
-    { 123 },
-    { 123 },
-    { 119 },
-    { 119 },
-    { 123 },
-    { 123 },
-    { 119 },
-    { 119 },
-    { 123 },
-    { 123 },
-    { 119 },
-    { 119 },
-    { 123 },
-    { 123 },
-    { 119 },
-    { 119 },
-    { 123 },
-    { 123 },
-    { 119 },
-    { 119 },
-    { 123 },
-    { 123 },
-    { 119 },
-    { 119 },
-    { 123 },
-    { 123 },
-    { 119 },
-    { 119 },
-    { 123 },
-    { 123 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 118 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 120 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 121 },
-    { 121 },
-    { 122 },
-    { 122 },
-    { 121 },
-    { 121 },
-    { 122 },
-    { 122 },
-    { 121 },
-    { 121 },
-    { 122 },
-    { 122 },
-    { 121 },
-    { 121 },
-    { 122 },
-    { 122 },
-    { 121 },
-    { 121 },
-    { 122 },
-    { 122 },
-    { 121 },
-    { 121 },
-    { 122 },
-    { 122 },
-    { 121 },
-    { 121 },
-    { 122 },
-    { 122 },
-    { 121 },
-    { 121 },
-    { 122 },
-    { 122 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 118 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 120 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 },
-    { 116 }
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 112 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 113 },
+    { 113 },
+    { 114 },
+    { 114 },
+    { 113 },
+    { 113 },
+    { 114 },
+    { 114 },
+    { 113 },
+    { 113 },
+    { 114 },
+    { 114 },
+    { 113 },
+    { 113 },
+    { 114 },
+    { 114 },
+    { 113 },
+    { 113 },
+    { 114 },
+    { 114 },
+    { 113 },
+    { 113 },
+    { 114 },
+    { 114 },
+    { 113 },
+    { 113 },
+    { 114 },
+    { 114 },
+    { 113 },
+    { 113 },
+    { 114 },
+    { 114 },
+    { 115 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 115 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 },
+    { 108 }
 };
 std::size_t const Scanner::ms_transition_count_ = sizeof(Scanner::ms_transition_table_) / sizeof(*Scanner::ms_transition_table_);
 
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 25 atom classes.
+std::uint8_t const Scanner::ms_atom_class_table_[256] =
+{
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 5, 6, 7, 7, 8, 7, 9, 10, 11, 12, 7, 7, 7, 5, 13,
+    14, 14, 14, 14, 14, 14, 14, 14, 15, 15, 5, 5, 7, 7, 7, 7,
+    7, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 19, 20, 7, 21,
+    7, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 22, 17, 17, 23, 5, 24, 7, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const Scanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 55, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 126, 0, 0, 0, 126, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        3, false,
+        { 48, 65, 97, 0 },
+        { 57, 70, 102, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 7, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        3, false,
+        { 48, 65, 97, 0 },
+        { 57, 90, 122, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 95, 0, 0, 0 },
+        { 95, 0, 0, 0 }
+    },
+    {
+        {
+            254, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 11, 0, 0 },
+        { 9, 255, 0, 0 }
+    },
+    {
+        {
+            254, 255, 255, 255, 255, 252, 255, 255, 255, 255, 255, 199, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        3, false,
+        { 1, 42, 94, 0 },
+        { 39, 90, 255, 0 }
+    },
+    {
+        {
+            254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        2, false,
+        { 1, 94, 0, 0 },
+        { 90, 255, 0, 0 }
+    },
+    {
+        {
+            254, 255, 255, 255, 123, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 215,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    }
+};
+std::size_t const Scanner::ms_skip_set_count_ = sizeof(Scanner::ms_skip_set_table_) / sizeof(*Scanner::ms_skip_set_table_);
+
 char const *const Scanner::ms_accept_handler_regex_[] =
 {
     "{ANY}*[*]/",
@@ -16717,9 +4002,9 @@ std::uint32_t const Scanner::ms_accept_handler_count_ = sizeof(Scanner::ms_accep
 // ///////////////////////////////////////////////////////////////////////
 
 
-#line 253 "../lib/commonlang/barf_commonlang_scanner.reflex"
+#line 245 "../lib/commonlang/barf_commonlang_scanner.reflex"
 
 } // end of namespace CommonLang
 } // end of namespace Barf
 
-#line 16726 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
+#line 4011 "../lib/commonlang/generated/barf_commonlang_scanner.cpp"
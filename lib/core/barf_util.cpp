@@ -254,6 +254,9 @@ string StringLiteral (string const &text, bool const with_quotes)
     if (with_quotes)
         retval += '"';
 
+    // a hex escape sequence continues through any following hex digits, so
+    // a hex digit following one must be hex-escaped as well.
+    bool previous_char_was_hex_escaped = false;
     for (string::const_iterator it = text.begin(),
                                      it_end = text.end();
          it != it_end;
@@ -261,11 +264,20 @@ string StringLiteral (string const &text, bool const with_quotes)
     {
         Uint8 c = *it;
         if (StringLiteralCharNeedsNormalEscaping(c))
+        {
             retval += '\\', retval += EscapeCode(c);
-        else if (CharNeedsHexEscaping(c))
+            previous_char_was_hex_escaped = false;
+        }
+        else if (CharNeedsHexEscaping(c) || (previous_char_was_hex_escaped && IsHexDigit(c)))
+        {
             retval += HexCharLiteral(c, false);
+            previous_char_was_hex_escaped = true;
+        }
         else
+        {
             retval += char(c);
+            previous_char_was_hex_escaped = false;
+        }
     }
 
     if (with_quotes)
@@ -10,7 +10,7 @@
 #define REFLEX_CPP_DEBUG_CODE_(spew_code) if (DebugSpewIsEnabled()) { spew_code; }
 
 
-#line 68 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 60 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
 #include "barf_preprocessor_ast.hpp"
 
@@ -84,21 +84,25 @@ Parser::Token Scanner::ParseKeyword (string const &accepted_string)
 
 Scanner::Scanner ()
     :
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_(
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_(
         ms_state_table_,
         ms_state_count_,
         ms_transition_table_,
         ms_transition_count_,
-        ms_accept_handler_count_)
+        ms_atom_class_table_,
+        ms_skip_set_table_,
+        ms_skip_set_count_,
+        ms_accept_handler_count_,
+        1024)
 {
     SetDebugSpewStream(NULL);
 
 
-#line 137 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 129 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
     m_text = NULL;
 
-#line 102 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 106 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
     ResetForNewInput();
 }
@@ -106,12 +110,12 @@ Scanner::Scanner ()
 Scanner::~Scanner ()
 {
 
-#line 140 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 132 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
     delete m_text;
     m_text = NULL;
 
-#line 115 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 119 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 }
 
 Scanner::StateMachine::Name Scanner::CurrentStateMachine () const
@@ -124,9 +128,9 @@ Scanner::StateMachine::Name Scanner::CurrentStateMachine () const
         default: assert(false && "invalid initial node index -- this should never happen"); return StateMachine::START_;
         case 0: return StateMachine::EXPECTING_END_OF_FILE;
         case 4: return StateMachine::READING_BODY;
-        case 14: return StateMachine::READING_CODE;
-        case 28: return StateMachine::READING_CODE_STRING_LITERAL_GUTS;
-        case 38: return StateMachine::TRANSITION_TO_CODE;
+        case 13: return StateMachine::READING_CODE;
+        case 25: return StateMachine::READING_CODE_STRING_LITERAL_GUTS;
+        case 34: return StateMachine::TRANSITION_TO_CODE;
     }
 }
 
@@ -141,16 +145,16 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
         (false && "invalid StateMachine::Name"));
     REFLEX_CPP_DEBUG_CODE_(
         *DebugSpewStream() << 
-#line 171 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 "Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 147 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 151 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
  << " switching to state machine "
                            << ms_state_machine_name_[state_machine];
         if (ms_state_machine_mode_flags_[state_machine] != 0)
         {
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_CASE_INSENSITIVE_) != 0)
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
                 *DebugSpewStream() << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_UNGREEDY_) != 0)
+            if ((ms_state_machine_mode_flags_[state_machine] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_UNGREEDY_) != 0)
                 *DebugSpewStream() << " %ungreedy";
         }
         *DebugSpewStream() << std::endl)
@@ -159,33 +163,62 @@ void Scanner::SwitchToStateMachine (StateMachine::Name state_machine)
     assert(CurrentStateMachine() == state_machine);
 }
 
+Scanner::ScannerCheckpoint Scanner::Checkpoint ()
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+"Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
+#line 172 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+ << " taking checkpoint" << std::endl)
+    ScannerCheckpoint checkpoint;
+    checkpoint.m_input = ReflexCpp_::InputApparatus_Noninteractive_::TakeInputCheckpoint_();
+    checkpoint.m_state_machine = CurrentStateMachine();
+    return checkpoint;
+}
+
+void Scanner::Restore (ScannerCheckpoint const &checkpoint)
+{
+    REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+"Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
+#line 185 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+ << " restoring checkpoint" << std::endl)
+    ReflexCpp_::InputApparatus_Noninteractive_::RestoreInputCheckpoint_(checkpoint.m_input);
+    SwitchToStateMachine(checkpoint.m_state_machine);
+}
+
+void Scanner::ReleaseCheckpoint (ScannerCheckpoint const &checkpoint)
+{
+    ReflexCpp_::InputApparatus_Noninteractive_::ReleaseInputCheckpoint_(checkpoint.m_input);
+}
+
 void Scanner::ResetForNewInput ()
 {
     REFLEX_CPP_DEBUG_CODE_(
         *DebugSpewStream() << 
-#line 171 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 "Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 169 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 202 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
  << " executing reset-for-new-input actions and switching to state machine "
                            << ms_state_machine_name_[StateMachine::START_];
         if (ms_state_machine_mode_flags_[StateMachine::START_] != 0)
         {
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_CASE_INSENSITIVE_) != 0)
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_CASE_INSENSITIVE_) != 0)
                 *DebugSpewStream() << " %case_insensitive";
-            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_::MF_UNGREEDY_) != 0)
+            if ((ms_state_machine_mode_flags_[StateMachine::START_] & AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::MF_UNGREEDY_) != 0)
                 *DebugSpewStream() << " %ungreedy";
         }
         *DebugSpewStream() << std::endl)
-    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
+    ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::ResetForNewInput_(ms_state_table_ + ms_state_machine_start_state_index_[StateMachine::START_], ms_state_machine_mode_flags_[StateMachine::START_]);
     assert(CurrentStateMachine() == StateMachine::START_);
 
 
-#line 161 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 153 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
     delete m_text;
     m_text = NULL;
 
-#line 189 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 222 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 }
 
 Parser::Token Scanner::Scan () throw()
@@ -197,17 +230,16 @@ Parser::Token Scanner::Scan () throw()
     // exist (see comments below).
     while (true)
     {
-        // clear the previous accepted/rejected string.
-        work_string.clear();
         // reset the char buffer and other stuff
         PrepareToScan_();
 
         bool was_at_end_of_input_ = IsAtEndOfInput();
 
-        std::uint32_t accept_handler_index_ = RunDfa_(work_string);
-        // if no valid accept_handler_index_ was returned, then work_string
-        // was filled with everything up to the char after the keep_string
-        // cursor (i.e. the rejected atom).
+        std::uint32_t accept_handler_index_ = RunDfa_();
+        // if no valid accept_handler_index_ was returned, then the work
+        // string is everything up to the char after the keep_string cursor
+        // (i.e. the rejected atom).
+        work_string.assign(AcceptedStringBegin_(), AcceptedStringEnd_());
         if (accept_handler_index_ >= ms_accept_handler_count_)
         {
             // if we were already at the end of input and no
@@ -220,9 +252,9 @@ Parser::Token Scanner::Scan () throw()
 
             REFLEX_CPP_DEBUG_CODE_(
                 *DebugSpewStream() << 
-#line 171 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 "Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 226 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 258 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
  << " rejecting string ";
                 PrintString_(*DebugSpewStream(), rejected_string);
                 *DebugSpewStream() << " (rejected_atom is \'";
@@ -235,11 +267,11 @@ Parser::Token Scanner::Scan () throw()
             do
             {
 
-#line 158 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 150 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
     EmitError("unrecognized character " + CharLiteral(rejected_atom), GetFiLoc());
 
-#line 243 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 275 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
             }
             while (false);
@@ -251,9 +283,9 @@ Parser::Token Scanner::Scan () throw()
 
             REFLEX_CPP_DEBUG_CODE_(
                 *DebugSpewStream() << 
-#line 171 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 "Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 257 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 289 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
  << " accepting string ";
                 PrintString_(*DebugSpewStream(), accepted_string);
                 *DebugSpewStream() << " in state machine " << ms_state_machine_name_[CurrentStateMachine()]
@@ -266,12 +298,12 @@ Parser::Token Scanner::Scan () throw()
                 case 0:
                 {
 
-#line 407 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 399 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         assert(false && "this should never happen");
         return Parser::Token(Parser::Terminal::BAD_TOKEN);
     
-#line 275 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 307 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -279,11 +311,11 @@ Parser::Token Scanner::Scan () throw()
                 case 1:
                 {
 
-#line 413 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 405 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         return Parser::Token(Parser::Terminal::END_);
     
-#line 287 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 319 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -291,7 +323,7 @@ Parser::Token Scanner::Scan () throw()
                 case 2:
                 {
 
-#line 222 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 214 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         IncrementLineNumber(NewlineCount(accepted_string));
 
@@ -314,7 +346,7 @@ Parser::Token Scanner::Scan () throw()
         m_text = NULL;
         return Parser::Token(Parser::Terminal::TEXT, token);
     
-#line 318 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 350 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -322,7 +354,7 @@ Parser::Token Scanner::Scan () throw()
                 case 3:
                 {
 
-#line 246 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 238 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         // if there's already a body text in progress, continue it.
         if (m_text != NULL)
@@ -336,7 +368,7 @@ Parser::Token Scanner::Scan () throw()
         m_text = NULL;
         return Parser::Token(Parser::Terminal::TEXT, token);
     
-#line 340 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 372 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -344,11 +376,11 @@ Parser::Token Scanner::Scan () throw()
                 case 4:
                 {
 
-#line 279 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 271 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         // ignore whitespace
     
-#line 352 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 384 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -356,7 +388,7 @@ Parser::Token Scanner::Scan () throw()
                 case 5:
                 {
 
-#line 284 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 276 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         IncrementLineNumber(1);
         // we only return from the scanner on a newline if we're scanning
@@ -367,7 +399,7 @@ Parser::Token Scanner::Scan () throw()
             return Parser::Token(Parser::Terminal::CODE_NEWLINE);
         }
     
-#line 371 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 403 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -375,7 +407,7 @@ Parser::Token Scanner::Scan () throw()
                 case 6:
                 {
 
-#line 296 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 288 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         SwitchToStateMachine(StateMachine::EXPECTING_END_OF_FILE);
         if (m_is_reading_newline_sensitive_code)
@@ -383,7 +415,7 @@ Parser::Token Scanner::Scan () throw()
         else
             EmitError("unexpected end of file encountered within preprocessor code section", GetFiLoc());
     
-#line 387 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 419 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -391,7 +423,7 @@ Parser::Token Scanner::Scan () throw()
                 case 7:
                 {
 
-#line 305 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 297 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         if (!m_is_reading_newline_sensitive_code)
         {
@@ -404,7 +436,7 @@ Parser::Token Scanner::Scan () throw()
             return Parser::Token(Parser::Terminal::BAD_TOKEN);
         }
     
-#line 408 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 440 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -412,11 +444,11 @@ Parser::Token Scanner::Scan () throw()
                 case 8:
                 {
 
-#line 319 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 311 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         return Parser::Token(Parser::Token::Id(accepted_string[0]));
     
-#line 420 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 452 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -424,11 +456,11 @@ Parser::Token Scanner::Scan () throw()
                 case 9:
                 {
 
-#line 324 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 316 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         return ParseKeyword(accepted_string);
     
-#line 432 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 464 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -436,14 +468,14 @@ Parser::Token Scanner::Scan () throw()
                 case 10:
                 {
 
-#line 329 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 321 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         Sint32 value = 0;
         istringstream in(accepted_string);
         in >> value;
         return Parser::Token(Parser::Terminal::INTEGER_LITERAL, new Integer(value, GetFiLoc()));
     
-#line 447 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 479 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -451,13 +483,13 @@ Parser::Token Scanner::Scan () throw()
                 case 11:
                 {
 
-#line 337 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 329 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         assert(m_text == NULL);
         m_text = new Text("", GetFiLoc());
         SwitchToStateMachine(StateMachine::READING_CODE_STRING_LITERAL_GUTS);
     
-#line 461 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 493 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -465,12 +497,12 @@ Parser::Token Scanner::Scan () throw()
                 case 12:
                 {
 
-#line 344 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 336 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         EmitError("unrecognized character encountered within preprocessor code section", GetFiLoc());
         return Parser::Token(Parser::Terminal::BAD_TOKEN);
     
-#line 474 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 506 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -478,7 +510,7 @@ Parser::Token Scanner::Scan () throw()
                 case 13:
                 {
 
-#line 353 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 345 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         assert(m_text != NULL);
         IncrementLineNumber(NewlineCount(accepted_string));
@@ -518,7 +550,7 @@ Parser::Token Scanner::Scan () throw()
         m_text = NULL;
         return Parser::Token(Parser::Terminal::STRING_LITERAL, token);
     
-#line 522 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 554 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -526,7 +558,7 @@ Parser::Token Scanner::Scan () throw()
                 case 14:
                 {
 
-#line 394 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 386 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         EmitError("unterminated string literal", GetFiLoc());
         IncrementLineNumber(NewlineCount(accepted_string));
@@ -535,7 +567,7 @@ Parser::Token Scanner::Scan () throw()
         m_text = NULL;
         return Parser::Token(Parser::Terminal::END_);
     
-#line 539 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 571 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -543,7 +575,7 @@ Parser::Token Scanner::Scan () throw()
                 case 15:
                 {
 
-#line 266 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 258 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
         assert(m_text == NULL);
         SwitchToStateMachine(StateMachine::READING_CODE);
@@ -552,7 +584,7 @@ Parser::Token Scanner::Scan () throw()
         else
             return Parser::Token(Parser::Terminal::START_CODE);
     
-#line 556 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 588 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 
                 }
                 break;
@@ -563,42 +595,42 @@ Parser::Token Scanner::Scan () throw()
     }
 
 
-#line 144 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 136 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
     assert(false && "you didn't handle EOF properly");
     return Parser::Token(Parser::Terminal::END_);
 
-#line 572 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 604 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
 }
 
 void Scanner::KeepString ()
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
-#line 171 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 "Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 580 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 612 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
  << " keeping string" << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::KeepString();
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::KeepString();
 }
 
 void Scanner::Unaccept (std::uint32_t unaccept_char_count)
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
-#line 171 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 "Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 590 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 622 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
  << " unaccepting " << unaccept_char_count << " char" << (unaccept_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::Unaccept(unaccept_char_count);
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::Unaccept(unaccept_char_count);
 }
 
 void Scanner::Unreject (std::uint32_t unreject_char_count)
 {
     REFLEX_CPP_DEBUG_CODE_(*DebugSpewStream() << 
-#line 171 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 163 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 "Preprocessor::Scanner" << (GetFiLoc().IsValid() ? " ("+GetFiLoc().AsString()+")" : g_empty_string) << ":"
-#line 600 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 632 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
  << " unrejecting " << unreject_char_count << " char" << (unreject_char_count == 1 ? '\0' : 's') << std::endl)
-    AutomatonApparatus_FastAndBig_Noninteractive_::Unreject(unreject_char_count);
+    AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::Unreject(unreject_char_count);
 }
 
 // ///////////////////////////////////////////////////////////////////////
@@ -622,6 +654,11 @@ void Scanner::PrintAtom_ (std::ostream &out, std::uint8_t atom)
 }
 
 void Scanner::PrintString_ (std::ostream &out, std::string const &s)
+{
+    PrintString_(out, s.data(), s.length());
+}
+
+void Scanner::PrintString_ (std::ostream &out, char const *s, std::size_t length)
 {
     // save the existing ostream properties for later restoration
     std::ios_base::fmtflags saved_stream_flags = out.flags();
@@ -641,7 +678,7 @@ void Scanner::PrintString_ (std::ostream &out, std::string const &s)
     out.fill('0');
 
     out << '"';
-    for (std::string::size_type i = 0; i < s.size(); ++i)
+    for (std::size_t i = 0; i < length; ++i)
         PrintAtom_(out, s[i]);
     out << '"';
 
@@ -656,9 +693,9 @@ std::uint32_t const Scanner::ms_state_machine_start_state_index_[] =
 {
     0,
     4,
-    14,
-    28,
-    38,
+    13,
+    25,
+    34,
 };
 std::uint8_t const Scanner::ms_state_machine_mode_flags_[] =
 {
@@ -680,51 +717,47 @@ std::uint32_t const Scanner::ms_state_machine_count_ = sizeof(Scanner::ms_state_
 
 // the order of the states indicates priority (only for accept states).
 // the lower the state's index in this array, the higher its priority.
-ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaState_ const Scanner::ms_state_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaState_ const Scanner::ms_state_table_[] =
 {
-    { 16, 32, 0, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 16, 255, 32, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 0, 255, 287, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 1, 255, 542, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 16, 32, 797, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 16, 255, 829, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 16, 32, 1084, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 3, 255, 1116, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 16, 32, 1371, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 16, 255, 1403, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 2, 32, 1658, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 2, 255, 1690, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 2, 255, 1945, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 3, 255, 2200, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 16, 32, 2455, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 16, 255, 2487, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 12, 0, 2742, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 4, 0, 2742, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 5, 0, 2742, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 8, 0, 2742, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 11, 0, 2742, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 10, 0, 2742, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 10, 10, 2742, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 10, 10, 2752, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 9, 75, 2762, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 9, 75, 2837, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 48 },
-    { 7, 0, 2912, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 },
-    { 6, 255, 2912, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 16, 32, 3167, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 16, 255, 3199, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 16, 32, 3454, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 14, 255, 3486, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 13, 32, 3741, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 13, 255, 3773, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 16, 32, 4028, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::CONDITIONAL, 0 },
-    { 16, 255, 4060, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 14, 255, 4315, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 13, 255, 4570, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 1 },
-    { 15, 0, 4825, ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_::INPUT_ATOM, 0 }
+    { 0, 16, 32, 2, 0 },
+    { 32, 16, 14, 0, 0 },
+    { 46, 0, 14, 0, 1 },
+    { 60, 1, 14, 0, 0 },
+    { 74, 16, 32, 2, 0 },
+    { 106, 16, 14, 0, 0 },
+    { 120, 16, 32, 2, 0 },
+    { 152, 3, 14, 0, 0 },
+    { 166, 16, 32, 2, 0 },
+    { 198, 16, 14, 0, 0 },
+    { 212, 2, 32, 2, 0 },
+    { 244, 2, 14, 0, 0 },
+    { 258, 3, 14, 0, 0 },
+    { 272, 16, 32, 2, 0 },
+    { 304, 16, 14, 0, 0 },
+    { 318, 12, 0, 0, 0 },
+    { 318, 4, 0, 0, 0 },
+    { 318, 5, 0, 0, 0 },
+    { 318, 8, 0, 0, 0 },
+    { 318, 11, 0, 0, 0 },
+    { 318, 10, 0, 0, 0 },
+    { 318, 10, 14, 0, 2 },
+    { 332, 9, 14, 0, 3 },
+    { 346, 7, 0, 0, 0 },
+    { 346, 6, 14, 0, 0 },
+    { 360, 16, 32, 2, 0 },
+    { 392, 16, 14, 0, 0 },
+    { 406, 16, 32, 2, 0 },
+    { 438, 14, 14, 0, 0 },
+    { 452, 13, 32, 2, 0 },
+    { 484, 13, 14, 0, 0 },
+    { 498, 16, 32, 2, 0 },
+    { 530, 16, 14, 0, 0 },
+    { 544, 14, 14, 0, 0 },
+    { 558, 15, 0, 0, 0 }
 };
 std::size_t const Scanner::ms_state_count_ = sizeof(Scanner::ms_state_table_) / sizeof(*Scanner::ms_state_table_);
 
-ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const Scanner::ms_transition_table_[] =
+ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_S8_T16_A8_::DfaTransition_ const Scanner::ms_transition_table_[] =
 {
     { 1 },
     { 1 },
@@ -758,6 +791,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 1 },
     { 3 },
     { 3 },
+    { 35 },
     { 2 },
     { 2 },
     { 2 },
@@ -771,6 +805,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 35 },
     { 2 },
     { 2 },
     { 2 },
@@ -784,6 +819,7 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
+    { 35 },
     { 2 },
     { 2 },
     { 2 },
@@ -797,4727 +833,384 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 2 },
     { 2 },
     { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 2 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 8 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 5 },
-    { 5 },
-    { 7 },
-    { 7 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 8 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 9 },
-    { 9 },
-    { 13 },
-    { 13 },
-    { 9 },
-    { 9 },
-    { 13 },
-    { 13 },
-    { 9 },
-    { 9 },
-    { 13 },
-    { 13 },
-    { 9 },
-    { 9 },
-    { 13 },
-    { 13 },
-    { 9 },
-    { 9 },
-    { 13 },
-    { 13 },
-    { 9 },
-    { 9 },
-    { 13 },
-    { 13 },
-    { 9 },
-    { 9 },
-    { 13 },
-    { 13 },
-    { 9 },
-    { 9 },
-    { 13 },
-    { 13 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 8 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 10 },
-    { 10 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 11 },
-    { 11 },
-    { 12 },
-    { 12 },
-    { 11 },
-    { 11 },
-    { 12 },
-    { 12 },
-    { 11 },
-    { 11 },
-    { 12 },
-    { 12 },
-    { 11 },
-    { 11 },
-    { 12 },
-    { 12 },
-    { 11 },
-    { 11 },
-    { 12 },
-    { 12 },
-    { 11 },
-    { 11 },
-    { 12 },
-    { 12 },
-    { 11 },
-    { 11 },
-    { 12 },
-    { 12 },
-    { 11 },
-    { 11 },
-    { 12 },
-    { 12 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 8 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 8 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 8 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 10 },
-    { 10 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 6 },
-    { 15 },
-    { 15 },
-    { 27 },
-    { 27 },
-    { 15 },
-    { 15 },
-    { 27 },
-    { 27 },
-    { 15 },
-    { 15 },
-    { 27 },
-    { 27 },
-    { 15 },
-    { 15 },
-    { 27 },
-    { 27 },
-    { 15 },
-    { 15 },
-    { 27 },
-    { 27 },
-    { 15 },
-    { 15 },
-    { 27 },
-    { 27 },
-    { 15 },
-    { 15 },
-    { 27 },
-    { 27 },
-    { 15 },
-    { 15 },
-    { 27 },
-    { 27 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 17 },
-    { 18 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 17 },
-    { 19 },
-    { 20 },
-    { 16 },
-    { 16 },
-    { 19 },
-    { 19 },
-    { 16 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 21 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 16 },
-    { 16 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 16 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 16 },
-    { 19 },
-    { 16 },
-    { 24 },
-    { 16 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 16 },
-    { 19 },
-    { 26 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 23 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 25 },
-    { 39 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 39 },
-    { 25 },
-    { 39 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 25 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 17 },
-    { 18 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 17 },
-    { 19 },
-    { 20 },
-    { 16 },
-    { 16 },
-    { 19 },
-    { 19 },
-    { 16 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 21 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 22 },
-    { 16 },
-    { 16 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 19 },
-    { 16 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 19 },
-    { 16 },
-    { 19 },
-    { 16 },
-    { 24 },
-    { 16 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 24 },
-    { 16 },
-    { 19 },
-    { 26 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 16 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 32 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 34 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 29 },
-    { 29 },
-    { 31 },
-    { 31 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 32 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 34 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 33 },
-    { 33 },
-    { 37 },
-    { 37 },
-    { 33 },
-    { 33 },
-    { 37 },
-    { 37 },
-    { 33 },
-    { 33 },
-    { 37 },
-    { 37 },
-    { 33 },
-    { 33 },
-    { 37 },
-    { 37 },
-    { 33 },
-    { 33 },
-    { 37 },
-    { 37 },
-    { 33 },
-    { 33 },
-    { 37 },
-    { 37 },
-    { 33 },
-    { 33 },
-    { 37 },
-    { 37 },
-    { 33 },
-    { 33 },
-    { 37 },
-    { 37 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 32 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 34 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 35 },
-    { 35 },
-    { 36 },
-    { 36 },
-    { 35 },
-    { 35 },
-    { 36 },
-    { 36 },
-    { 35 },
-    { 35 },
-    { 36 },
-    { 36 },
-    { 35 },
-    { 35 },
-    { 36 },
-    { 36 },
-    { 35 },
-    { 35 },
-    { 36 },
-    { 36 },
-    { 35 },
-    { 35 },
-    { 36 },
-    { 36 },
-    { 35 },
-    { 35 },
-    { 36 },
-    { 36 },
-    { 35 },
-    { 35 },
-    { 36 },
-    { 36 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 32 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 34 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
-    { 30 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 35 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 8 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 5 },
+    { 5 },
+    { 7 },
+    { 7 },
+    { 35 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 8 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 9 },
+    { 9 },
+    { 12 },
+    { 12 },
+    { 9 },
+    { 9 },
+    { 12 },
+    { 12 },
+    { 9 },
+    { 9 },
+    { 12 },
+    { 12 },
+    { 9 },
+    { 9 },
+    { 12 },
+    { 12 },
+    { 9 },
+    { 9 },
+    { 12 },
+    { 12 },
+    { 9 },
+    { 9 },
+    { 12 },
+    { 12 },
+    { 9 },
+    { 9 },
+    { 12 },
+    { 12 },
+    { 9 },
+    { 9 },
+    { 12 },
+    { 12 },
+    { 35 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 8 },
+    { 6 },
+    { 6 },
+    { 10 },
+    { 10 },
+    { 6 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 11 },
+    { 35 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 8 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 35 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 6 },
+    { 8 },
+    { 6 },
+    { 6 },
+    { 10 },
+    { 10 },
+    { 6 },
+    { 14 },
+    { 14 },
+    { 24 },
+    { 24 },
+    { 14 },
+    { 14 },
+    { 24 },
+    { 24 },
+    { 14 },
+    { 14 },
+    { 24 },
+    { 24 },
+    { 14 },
+    { 14 },
+    { 24 },
+    { 24 },
+    { 14 },
+    { 14 },
+    { 24 },
+    { 24 },
+    { 14 },
+    { 14 },
+    { 24 },
+    { 24 },
+    { 14 },
+    { 14 },
+    { 24 },
+    { 24 },
+    { 14 },
+    { 14 },
+    { 24 },
+    { 24 },
+    { 35 },
+    { 15 },
+    { 16 },
+    { 17 },
+    { 18 },
+    { 19 },
+    { 20 },
+    { 21 },
+    { 18 },
+    { 22 },
+    { 15 },
+    { 15 },
+    { 18 },
+    { 23 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 21 },
+    { 21 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 22 },
+    { 22 },
+    { 35 },
+    { 22 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 35 },
+    { 15 },
+    { 16 },
+    { 17 },
+    { 18 },
+    { 19 },
+    { 20 },
+    { 21 },
+    { 18 },
+    { 22 },
+    { 15 },
+    { 15 },
+    { 18 },
+    { 23 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 35 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 29 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 31 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 26 },
+    { 26 },
+    { 28 },
+    { 28 },
+    { 35 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 29 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 31 },
+    { 27 },
+    { 27 },
+    { 27 },
     { 30 },
     { 30 },
     { 30 },
@@ -5550,10 +1243,150 @@ ReflexCpp_::AutomatonApparatus_FastAndBig_Noninteractive_::DfaTransition_ const
     { 30 },
     { 30 },
     { 30 },
-    { 30 }
+    { 35 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 29 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 31 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 32 },
+    { 32 },
+    { 33 },
+    { 33 },
+    { 32 },
+    { 32 },
+    { 33 },
+    { 33 },
+    { 32 },
+    { 32 },
+    { 33 },
+    { 33 },
+    { 32 },
+    { 32 },
+    { 33 },
+    { 33 },
+    { 32 },
+    { 32 },
+    { 33 },
+    { 33 },
+    { 32 },
+    { 32 },
+    { 33 },
+    { 33 },
+    { 32 },
+    { 32 },
+    { 33 },
+    { 33 },
+    { 32 },
+    { 32 },
+    { 33 },
+    { 33 },
+    { 35 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 35 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 },
+    { 27 }
 };
 std::size_t const Scanner::ms_transition_count_ = sizeof(Scanner::ms_transition_table_) / sizeof(*Scanner::ms_transition_table_);
 
+// maps each input atom to its atom class, which indexes the transitions of
+// each INPUT_ATOM state in ms_transition_table_.  there are 14 atom classes.
+std::uint8_t const Scanner::ms_atom_class_table_[256] =
+{
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 4, 5, 1, 1, 4, 4, 1, 4, 4, 4, 4, 4, 4, 4, 4,
+    6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 1, 1, 8, 4, 4, 4,
+    1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 4, 10, 4, 1, 9,
+    1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 12, 13, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+// the sets of atoms on which states transition to themselves, so that runs of
+// them can be skipped over at once.  each is { bitmap, range count, whether
+// the ranges are the complement of the set, range lower bounds, range upper
+// bounds }.  element 0 is unused; it indicates that a state has no skip set.
+ReflexCpp_::AtomSkipSet_ const Scanner::ms_skip_set_table_[] =
+{
+    {
+        {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        0, false,
+        { 0, 0, 0, 0 },
+        { 0, 0, 0, 0 }
+    },
+    {
+        {
+            254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+        },
+        1, false,
+        { 1, 0, 0, 0 },
+        { 255, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        1, false,
+        { 48, 0, 0, 0 },
+        { 57, 0, 0, 0 }
+    },
+    {
+        {
+            0, 0, 0, 0, 0, 0, 255, 3, 254, 255, 255, 135, 254, 255, 255, 7,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+        },
+        4, false,
+        { 48, 65, 95, 97 },
+        { 57, 90, 95, 122 }
+    }
+};
+std::size_t const Scanner::ms_skip_set_count_ = sizeof(Scanner::ms_skip_set_table_) / sizeof(*Scanner::ms_skip_set_table_);
+
 char const *const Scanner::ms_accept_handler_regex_[] =
 {
     "{ANY}+",
@@ -5580,9 +1413,9 @@ std::uint32_t const Scanner::ms_accept_handler_count_ = sizeof(Scanner::ms_accep
 // ///////////////////////////////////////////////////////////////////////
 
 
-#line 148 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
+#line 140 "../lib/preprocessor/barf_preprocessor_scanner.reflex"
 
 } // end of namespace Preprocessor
 } // end of namespace Barf
 
-#line 5589 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
+#line 1422 "../lib/preprocessor/generated/barf_preprocessor_scanner.cpp"
@@ -2,8 +2,12 @@
 
 #include "barf_regex_dfa.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <map>
-#include <set>
+#include <thread>
+#include <unordered_map>
 
 #include "barf_graph.hpp"
 #include "barf_regex_graph.hpp"
@@ -13,10 +17,28 @@
 namespace Barf {
 namespace Regex {
 
-// a DFA state is really a set of NFA states
-typedef set<Uint32> DfaState;
+// a DFA state is really a set of NFA states, stored as a sorted vector of NFA
+// state indices (which is far cheaper to hash, compare and copy than a set).
+typedef vector<Uint32> DfaState;
+// sorts and removes duplicates from dfa_state, making it a valid DfaState.
+void NormalizeDfaState (DfaState &dfa_state)
+{
+    sort(dfa_state.begin(), dfa_state.end());
+    dfa_state.erase(unique(dfa_state.begin(), dfa_state.end()), dfa_state.end());
+}
+struct DfaStateHash
+{
+    size_t operator () (DfaState const &dfa_state) const
+    {
+        // FNV-1a over the NFA state indices
+        size_t hash = 2166136261u;
+        for (DfaState::const_iterator it = dfa_state.begin(), it_end = dfa_state.end(); it != it_end; ++it)
+            hash = (hash ^ *it) * 16777619u;
+        return hash;
+    }
+};
 // the DfaStateMap stores the index of already-explored DfaStates
-typedef map<DfaState, Uint32> DfaStateMap;
+typedef unordered_map<DfaState, Uint32, DfaStateHash> DfaStateMap;
 // for ordering Conditional instances
 struct ConditionalOrder
 {
@@ -34,149 +56,220 @@ struct GraphContext
     Uint32 m_nfa_accept_state_count;
     Graph &m_dfa_graph;
     DfaStateMap &m_dfa_state_map;
+    // the epsilon closure of each NFA state, indexed by whether or not
+    // it closes at conditional transitions, computed on demand.
+    vector<DfaState> m_epsilon_closure[2];
+    vector<bool> m_has_epsilon_closure[2];
+    // marks the nfa states visited while computing an epsilon closure, each
+    // computation using a new stamp (so that it need not be cleared).
+    vector<Uint32> m_epsilon_closure_visit_stamp;
+    Uint32 m_epsilon_closure_stamp;
+    // the transition closure of each NFA state, computed on demand.
+    vector<TargetStateMap> m_transition_closure;
+    vector<bool> m_has_transition_closure;
 
     GraphContext (Graph const &nfa_graph, Uint32 nfa_accept_state_count, Graph &dfa_graph, DfaStateMap &dfa_state_map)
         :
         m_nfa_graph(nfa_graph),
         m_nfa_accept_state_count(nfa_accept_state_count),
         m_dfa_graph(dfa_graph),
-        m_dfa_state_map(dfa_state_map)
-    { }
+        m_dfa_state_map(dfa_state_map),
+        m_epsilon_closure_visit_stamp(nfa_graph.NodeCount(), 0),
+        m_epsilon_closure_stamp(0),
+        m_transition_closure(nfa_graph.NodeCount()),
+        m_has_transition_closure(nfa_graph.NodeCount(), false)
+    {
+        for (Uint32 i = 0; i < 2; ++i)
+        {
+            m_epsilon_closure[i].resize(nfa_graph.NodeCount());
+            m_has_epsilon_closure[i].resize(nfa_graph.NodeCount(), false);
+        }
+    }
 }; // end of struct GraphContext
 
-void PerformTransitionClosure (GraphContext const &graph_context, Uint32 nfa_state, Conditional conditional, TargetStateMap &target_state_map, TargetStateMap &visited)
+TargetStateMap const &TransitionClosure (GraphContext &graph_context, Uint32 nfa_state)
 {
-    // early-out if we've already visited this conditional+nfa_state
+    assert(nfa_state < graph_context.m_nfa_graph.NodeCount());
+    TargetStateMap &target_state_map = graph_context.m_transition_closure[nfa_state];
+    if (graph_context.m_has_transition_closure[nfa_state])
+        return target_state_map;
+
+    // visit every nfa state reachable via epsilon and conditional transitions,
+    // along with the composition of the conditionals along the way.  the
+    // visited map records which conditional+nfa_state pairs have been seen.
+    TargetStateMap visited;
+    vector<pair<Conditional, Uint32> > pending;
+    pending.push_back(pair<Conditional, Uint32>(Conditional(0, 0), nfa_state));
+    while (!pending.empty())
     {
-        TargetStateMap::iterator it;
-        if (Contains(visited, conditional, it) && Contains(it->second, nfa_state))
-            return;
-    }
-    // add this conditional+nfa_state to the visited set
-    visited[conditional].insert(nfa_state);
+        Conditional conditional = pending.back().first;
+        Uint32 current_nfa_state = pending.back().second;
+        pending.pop_back();
+
+        // skip this conditional+nfa_state if it's already been visited
+        {
+            TargetStateMap::iterator it;
+            if (Contains(visited, conditional, it) && binary_search(it->second.begin(), it->second.end(), current_nfa_state))
+                continue;
+        }
+        // add this conditional+nfa_state to the visited set
+        {
+            DfaState &visited_nfa_states = visited[conditional];
+            visited_nfa_states.insert(lower_bound(visited_nfa_states.begin(), visited_nfa_states.end(), current_nfa_state), current_nfa_state);
+        }
 
-    Graph::Node const &node = graph_context.m_nfa_graph.GetNode(nfa_state);
+        Graph::Node const &node = graph_context.m_nfa_graph.GetNode(current_nfa_state);
 
-    // if this nfa state is an accept-node, add this nfa state to the target map.
-    assert(GetNodeData(graph_context.m_nfa_graph, nfa_state).m_is_accept_node == (node.TransitionCount() == 0) &&
-           "a node has 0 transitions if and only if it's an accept node");
-    if (GetNodeData(graph_context.m_nfa_graph, nfa_state).m_is_accept_node)
-        target_state_map[conditional].insert(nfa_state);
+        // if this nfa state is an accept-node, add this nfa state to the target map.
+        assert(GetNodeData(graph_context.m_nfa_graph, current_nfa_state).m_is_accept_node == (node.TransitionCount() == 0) &&
+               "a node has 0 transitions if and only if it's an accept node");
+        bool is_target = GetNodeData(graph_context.m_nfa_graph, current_nfa_state).m_is_accept_node;
 
-    // iterate over all transitions
-    for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
-                                              it_end = node.TransitionSetEnd();
-         it != it_end;
-         ++it)
-    {
-        Graph::Transition const &transition = *it;
-        switch (transition.Type())
+        // iterate over all transitions (pushed in reverse, so that they're
+        // visited in order).
+        for (Graph::TransitionSet::const_reverse_iterator it = Graph::TransitionSet::const_reverse_iterator(node.TransitionSetEnd()),
+                                                          it_end = Graph::TransitionSet::const_reverse_iterator(node.TransitionSetBegin());
+             it != it_end;
+             ++it)
         {
-            case TT_INPUT_ATOM:
-            case TT_INPUT_ATOM_RANGE:
-                // if there are input-atom transitions, add this nfa state to the target map.
-                target_state_map[conditional].insert(nfa_state);
-                break;
-
-            case TT_EPSILON:
-                // if it's an epsilon transition, recurse.
-                PerformTransitionClosure(graph_context, transition.TargetIndex(), conditional, target_state_map, visited);
-                break;
-
-            case TT_CONDITIONAL:
+            Graph::Transition const &transition = *it;
+            switch (transition.Type())
             {
-                // get the Conditional value from transition.Type()
-                Conditional transition_conditional(GetConditionalFromConditionalType(transition.Data(0)));
-                // check if it conflicts with the passed-in conditional
-                if (conditional.ConflictsWith(transition_conditional))
-                    // TODO: improve this error to include a FiLoc
-                    throw string("conditional ") + ConditionalTypeString(transition.Data(0)) + " conflicts with previous adjacent conditionals";
-                // compose this transition's conditional with the one passed-in.
-                Conditional transitioned_conditional(
-                    conditional.m_mask|transition_conditional.m_mask,
-                    conditional.m_flags|transition_conditional.m_flags);
-                // recurse to the state indicated by this transition, composing
-                // this transition's conditional with the current.
-                PerformTransitionClosure(graph_context, transition.TargetIndex(), transitioned_conditional, target_state_map, visited);
-                break;
+                case TT_INPUT_ATOM:
+                case TT_INPUT_ATOM_RANGE:
+                    // if there are input-atom transitions, add this nfa state to the target map.
+                    is_target = true;
+                    break;
+
+                case TT_EPSILON:
+                    // if it's an epsilon transition, visit its target.
+                    pending.push_back(pair<Conditional, Uint32>(conditional, transition.TargetIndex()));
+                    break;
+
+                case TT_CONDITIONAL:
+                {
+                    // get the Conditional value from transition.Type()
+                    Conditional transition_conditional(GetConditionalFromConditionalType(transition.Data(0)));
+                    // check if it conflicts with the current conditional
+                    if (conditional.ConflictsWith(transition_conditional))
+                        // TODO: improve this error to include a FiLoc
+                        throw string("conditional ") + ConditionalTypeString(transition.Data(0)) + " conflicts with previous adjacent conditionals";
+                    // visit the state indicated by this transition, composing
+                    // this transition's conditional with the current.
+                    pending.push_back(
+                        pair<Conditional, Uint32>(
+                            Conditional(
+                                conditional.m_mask|transition_conditional.m_mask,
+                                conditional.m_flags|transition_conditional.m_flags),
+                            transition.TargetIndex()));
+                    break;
+                }
             }
         }
+
+        if (is_target)
+            target_state_map[conditional].push_back(current_nfa_state);
     }
-}
 
-void PerformTransitionClosure (GraphContext const &graph_context, Uint32 nfa_state, TargetStateMap &target_state_map)
-{
-    TargetStateMap visited;
-    PerformTransitionClosure(graph_context, nfa_state, Conditional(0, 0), target_state_map, visited);
+    for (TargetStateMap::iterator it = target_state_map.begin(), it_end = target_state_map.end(); it != it_end; ++it)
+        NormalizeDfaState(it->second);
+    graph_context.m_has_transition_closure[nfa_state] = true;
+    return target_state_map;
 }
 
-void PerformEpsilonClosure (GraphContext const &graph_context, Uint32 nfa_state, DfaState &dfa_state, DfaState &visited, bool close_at_conditional_transitions)
+DfaState const &EpsilonClosure (GraphContext &graph_context, Uint32 nfa_state, bool close_at_conditional_transitions)
 {
-    // early-out if we've already visited this nfa_state
-    if (Contains(visited, nfa_state))
-        return;
-    // add this nfa_state to the visited set
-    visited.insert(nfa_state);
-
-    Graph::Node const &node = graph_context.m_nfa_graph.GetNode(nfa_state);
-
-    // if this nfa state is an accept-node, a start-node, or if
-    // it has no transitions, add this nfa state to the target map.
-    if (node.TransitionCount() == 0 ||
-        GetNodeData(graph_context.m_nfa_graph, nfa_state).m_is_start_node ||
-        GetNodeData(graph_context.m_nfa_graph, nfa_state).m_is_accept_node)
+    assert(nfa_state < graph_context.m_nfa_graph.NodeCount());
+    DfaState &dfa_state = graph_context.m_epsilon_closure[close_at_conditional_transitions][nfa_state];
+    if (graph_context.m_has_epsilon_closure[close_at_conditional_transitions][nfa_state])
+        return dfa_state;
+
+    // visit every nfa state reachable via epsilon transitions
+    vector<Uint32> &visit_stamp = graph_context.m_epsilon_closure_visit_stamp;
+    Uint32 stamp = ++graph_context.m_epsilon_closure_stamp;
+    vector<Uint32> pending(1, nfa_state);
+    while (!pending.empty())
     {
-        dfa_state.insert(nfa_state);
-    }
-
-    // iterate over all transitions
-    for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
-                                              it_end = node.TransitionSetEnd();
-         it != it_end;
-         ++it)
-    {
-        Graph::Transition const &transition = *it;
-        // if it's an epsilon transition, recurse.
-        if (transition.Type() == TT_EPSILON)
-            PerformEpsilonClosure(graph_context, transition.TargetIndex(), dfa_state, visited, close_at_conditional_transitions);
-        // if it's a conditional transition, check the close_at_conditional_transitions
-        // flag.  if it's set, then we can add it to the closed dfa state.
-        else if (transition.Type() == TT_CONDITIONAL)
+        Uint32 current_nfa_state = pending.back();
+        pending.pop_back();
+
+        // skip this nfa_state if it's already been visited
+        if (visit_stamp[current_nfa_state] == stamp)
+            continue;
+        visit_stamp[current_nfa_state] = stamp;
+
+        Graph::Node const &node = graph_context.m_nfa_graph.GetNode(current_nfa_state);
+
+        // if this nfa state is an accept-node, a start-node, or if
+        // it has no transitions, add this nfa state to the closed dfa state.
+        bool is_in_closure =
+            node.TransitionCount() == 0 ||
+            GetNodeData(graph_context.m_nfa_graph, current_nfa_state).m_is_start_node ||
+            GetNodeData(graph_context.m_nfa_graph, current_nfa_state).m_is_accept_node;
+
+        // iterate over all transitions
+        for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                  it_end = node.TransitionSetEnd();
+             it != it_end;
+             ++it)
         {
-            if (close_at_conditional_transitions)
-                dfa_state.insert(nfa_state);
+            Graph::Transition const &transition = *it;
+            // if it's an epsilon transition, visit its target.
+            if (transition.Type() == TT_EPSILON)
+                pending.push_back(transition.TargetIndex());
+            // if it's a conditional transition, check the close_at_conditional_transitions
+            // flag.  if it's set, then we can add it to the closed dfa state.
+            else if (transition.Type() == TT_CONDITIONAL)
+            {
+                if (close_at_conditional_transitions)
+                    is_in_closure = true;
+            }
+            // otherwise add it to the closed dfa state
+            else
+                is_in_closure = true;
         }
-        // otherwise add it to the closed dfa state
-        else
-            dfa_state.insert(nfa_state);
+
+        if (is_in_closure)
+            dfa_state.push_back(current_nfa_state);
     }
+
+    NormalizeDfaState(dfa_state);
+    graph_context.m_has_epsilon_closure[close_at_conditional_transitions][nfa_state] = true;
+    return dfa_state;
 }
 
-void PerformEpsilonClosure (GraphContext const &graph_context, DfaState &dfa_state, bool close_at_conditional_transitions)
+void PerformEpsilonClosure (GraphContext &graph_context, DfaState &dfa_state, bool close_at_conditional_transitions)
 {
     if (dfa_state.empty())
         return;
 
     DfaState new_dfa_state;
-    DfaState visited;
     for (DfaState::const_iterator it = dfa_state.begin(), it_end = dfa_state.end();
          it != it_end;
          ++it)
     {
-        PerformEpsilonClosure(graph_context, *it, new_dfa_state, visited, close_at_conditional_transitions);
+        DfaState const &closure = EpsilonClosure(graph_context, *it, close_at_conditional_transitions);
+        new_dfa_state.insert(new_dfa_state.end(), closure.begin(), closure.end());
     }
-    dfa_state = new_dfa_state;
+    NormalizeDfaState(new_dfa_state);
+    dfa_state.swap(new_dfa_state);
 }
 
 NodeData *CreateNodeDataFromDfaState (GraphContext const &graph_context, DfaState const &dfa_state)
 {
-    string node_label(" : DFA\n");
+    // this is equivalent to joining each NFA state's NodeData::AsText, but
+    // uses a single stream, since there can be very many NFA states.
+    ostringstream node_label;
+    node_label << " : DFA\n";
     DfaState::const_iterator it = dfa_state.begin(), it_end = dfa_state.end();
     while (it != it_end)
     {
-        node_label += GetNodeData(graph_context.m_nfa_graph, *it).AsText(*it);
+        node_label << *it;
+        string const &nfa_node_label = GetNodeData(graph_context.m_nfa_graph, *it).m_node_label;
+        if (!nfa_node_label.empty())
+            node_label << ':' << nfa_node_label;
         if (++it != it_end)
-            node_label += ", "; // use newline instead?
+            node_label << ", "; // use newline instead?
     }
 
     Uint32 accept_handler_index = graph_context.m_nfa_accept_state_count;
@@ -198,10 +291,186 @@ NodeData *CreateNodeDataFromDfaState (GraphContext const &graph_context, DfaStat
         }
     }
 
-    return new NodeData(is_start_node ? IS_START_NODE : NOT_START_NODE, is_accept_node ? IS_ACCEPT_NODE : NOT_ACCEPT_NODE, node_label, accept_handler_index);
+    return new NodeData(is_start_node ? IS_START_NODE : NOT_START_NODE, is_accept_node ? IS_ACCEPT_NODE : NOT_ACCEPT_NODE, node_label.str(), accept_handler_index);
 }
 
-Uint32 DfaStateIndex (GraphContext &graph_context, DfaState const &dfa_state, bool disallow_transition_closure)
+// a transition from a DFA state which can't be made until the DFA state it
+// goes to (the closure of m_target_dfa_state) has been assigned an index.
+struct PendingTransition
+{
+    TransitionType m_transition_type;
+    Uint8 m_data_0;
+    Uint8 m_data_1;
+    DfaState m_target_dfa_state;
+    bool m_disallow_transition_closure;
+
+    PendingTransition (TransitionType transition_type, Uint8 data_0, Uint8 data_1, bool disallow_transition_closure)
+        :
+        m_transition_type(transition_type),
+        m_data_0(data_0),
+        m_data_1(data_1),
+        m_disallow_transition_closure(disallow_transition_closure)
+    { }
+
+    Graph::Transition MakeTransition (Uint32 target_index) const
+    {
+        switch (m_transition_type)
+        {
+            case TT_INPUT_ATOM:       return InputAtomTransition(m_data_0, target_index);
+            case TT_INPUT_ATOM_RANGE: return InputAtomRangeTransition(m_data_0, m_data_1, target_index);
+            default:
+                assert(m_transition_type == TT_CONDITIONAL);
+                return DfaConditionalTransition(m_data_0, m_data_1, target_index);
+        }
+    }
+}; // end of struct PendingTransition
+
+// a DFA state whose transitions are still being made
+struct DfaStateUnderConstruction
+{
+    Uint32 m_dfa_state_index;
+    vector<PendingTransition> m_pending_transition;
+    Uint32 m_next_pending_transition;
+}; // end of struct DfaStateUnderConstruction
+
+typedef vector<DfaStateUnderConstruction> ConstructionStack;
+
+void GeneratePendingTransitions (GraphContext &graph_context, DfaState const &closed_dfa_state, bool disallow_transition_closure, vector<PendingTransition> &pending_transition)
+{
+    // perform closure on current state, OR'ing a bitmask of conditionals
+    // encountered and keeping a bitset of chars encountered.
+    TargetStateMap target_state_map;
+    for (DfaState::const_iterator it = closed_dfa_state.begin(), it_end = closed_dfa_state.end();
+         it != it_end;
+         ++it)
+    {
+        TargetStateMap const &transition_closure = TransitionClosure(graph_context, *it);
+        for (TargetStateMap::const_iterator closure_it = transition_closure.begin(),
+                                            closure_it_end = transition_closure.end();
+             closure_it != closure_it_end;
+             ++closure_it)
+        {
+            DfaState &target_dfa_state = target_state_map[closure_it->first];
+            target_dfa_state.insert(target_dfa_state.end(), closure_it->second.begin(), closure_it->second.end());
+        }
+    }
+    for (TargetStateMap::iterator it = target_state_map.begin(), it_end = target_state_map.end(); it != it_end; ++it)
+        NormalizeDfaState(it->second);
+
+    // if no conditionals were hit, target_state_map should have a single element
+    // mapped to key Conditional(0, 0).  in this case, no conditional
+    // transitions have to be made from this state -- we can proceed directly
+    // with input-atom transitions.
+    TargetStateMap::const_iterator target_it;
+    if (Contains(target_state_map, Conditional(0, 0), target_it)
+        &&
+        (target_state_map.size() == 1 || disallow_transition_closure))
+    {
+        DfaState const &closed_dfa_state = target_it->second;
+        // transitioned-to DFA states, indexed by transition atom
+        vector<DfaState> transition_map(256);
+        for (DfaState::const_iterator it = closed_dfa_state.begin(), it_end = closed_dfa_state.end();
+             it != it_end;
+             ++it)
+        {
+            Graph::Node const &from_nfa_node = graph_context.m_nfa_graph.GetNode(*it);
+            for (Graph::TransitionSet::const_iterator trans_it = from_nfa_node.TransitionSetBegin(),
+                                                      trans_it_end = from_nfa_node.TransitionSetEnd();
+                 trans_it != trans_it_end;
+                 ++trans_it)
+            {
+                Graph::Transition const &transition = *trans_it;
+                if (transition.Type() == TT_INPUT_ATOM)
+                    transition_map[transition.Data(0)].push_back(transition.TargetIndex());
+                else if (transition.Type() == TT_INPUT_ATOM_RANGE)
+                    for (Uint32 atom = transition.Data(0); atom <= transition.Data(1); ++atom)
+                        transition_map[atom].push_back(transition.TargetIndex());
+            }
+        }
+        for (Uint32 atom = 0; atom < 256; ++atom)
+            NormalizeDfaState(transition_map[atom]);
+        // add the transitions from the above-made map
+        Uint32 atom = 0;
+        while (atom < 256)
+        {
+            if (transition_map[atom].empty())
+            {
+                ++atom;
+                continue;
+            }
+            Uint32 starting_atom = atom;
+            while (atom < 256 && transition_map[atom] == transition_map[starting_atom])
+                ++atom;
+            Uint32 most_recent_atom = atom - 1;
+            // if the atom range was a single value, use TT_INPUT_ATOM
+            // otherwise they spanned a range, so use TT_INPUT_ATOM_RANGE
+            pending_transition.push_back(
+                PendingTransition(
+                    most_recent_atom == starting_atom ? TT_INPUT_ATOM : TT_INPUT_ATOM_RANGE,
+                    starting_atom,
+                    most_recent_atom,
+                    false));
+            pending_transition.back().m_target_dfa_state.swap(transition_map[starting_atom]);
+        }
+    }
+    // otherwise we have to make conditional transitions.  all transitions
+    // from the nodes being transitioned to here will have only input-atom
+    // transitions.
+    else
+    {
+        // calculate a comprehensive mask which include all target
+        // conditionals' masks.
+        Conditional current_condition(0, 0);
+        for (TargetStateMap::const_iterator it = target_state_map.begin(),
+                                            it_end = target_state_map.end();
+             it != it_end;
+             ++it)
+        {
+            Conditional const &target_condition = it->first;
+            current_condition.m_mask |= target_condition.m_mask;
+        }
+
+        // for every possible combination recorded in target_state_map, make a
+        // transition to the set of DFA states (each being a set of NFA states)
+        // which are accepted by the calculated conditional.
+        current_condition.m_flags = 0;
+        do
+        {
+            DfaState cumulative_target_dfa_state;
+            for (TargetStateMap::const_iterator it = target_state_map.begin(),
+                                                it_end = target_state_map.end();
+                it != it_end;
+                ++it)
+            {
+                Conditional const &target_condition = it->first;
+                if (!current_condition.ConflictsWith(target_condition))
+                {
+                    DfaState const &target_dfa_state = it->second;
+                    cumulative_target_dfa_state.insert(cumulative_target_dfa_state.end(), target_dfa_state.begin(), target_dfa_state.end());
+                }
+            }
+            if (!cumulative_target_dfa_state.empty())
+            {
+                NormalizeDfaState(cumulative_target_dfa_state);
+                pending_transition.push_back(
+                    PendingTransition(
+                        TT_CONDITIONAL,
+                        current_condition.m_mask,
+                        current_condition.m_flags,
+                        true));
+                pending_transition.back().m_target_dfa_state.swap(cumulative_target_dfa_state);
+            }
+
+            ++current_condition;
+        }
+        while (current_condition.m_flags != 0);
+    }
+}
+
+// returns the index of the DFA state which is the closure of dfa_state,
+// creating it if necessary, in which case it's pushed onto construction_stack
+// so that its transitions are made.
+Uint32 ClosedDfaStateIndex (GraphContext &graph_context, DfaState const &dfa_state, bool disallow_transition_closure, ConstructionStack &construction_stack)
 {
     assert(graph_context.m_dfa_graph.NodeCount() == graph_context.m_dfa_state_map.size());
     assert(!dfa_state.empty());
@@ -215,160 +484,531 @@ Uint32 DfaStateIndex (GraphContext &graph_context, DfaState const &dfa_state, bo
         return it->second;
 
     // add the requested state to the state map so that any requests for it
-    // which happen before the end of this call don't cause infinite recursion
+    // which happen before it's finished don't create it again
     Uint32 dfa_state_index = graph_context.m_dfa_state_map.size();
     graph_context.m_dfa_state_map[closed_dfa_state] = dfa_state_index;
-    Uint32 current_state_index = graph_context.m_dfa_graph.AddNode(CreateNodeDataFromDfaState(graph_context, closed_dfa_state));
-    assert(current_state_index == dfa_state_index);
+    graph_context.m_dfa_graph.AddNode(CreateNodeDataFromDfaState(graph_context, closed_dfa_state));
+    assert(graph_context.m_dfa_graph.NodeCount() == dfa_state_index+1);
+
+    construction_stack.resize(construction_stack.size()+1);
+    DfaStateUnderConstruction &dfa_state_under_construction = construction_stack.back();
+    dfa_state_under_construction.m_dfa_state_index = dfa_state_index;
+    dfa_state_under_construction.m_next_pending_transition = 0;
+    GeneratePendingTransitions(graph_context, closed_dfa_state, disallow_transition_closure, dfa_state_under_construction.m_pending_transition);
 
-    // generate the requested state
+    return dfa_state_index;
+}
+
+Uint32 DfaStateIndex (GraphContext &graph_context, DfaState const &dfa_state, bool disallow_transition_closure)
+{
+    ConstructionStack construction_stack;
+    Uint32 dfa_state_index = ClosedDfaStateIndex(graph_context, dfa_state, disallow_transition_closure, construction_stack);
+
+    // make the transitions of each new DFA state depth-first, using an
+    // explicit stack instead of recursion (which would be as deep as the
+    // longest chain of new states, and could overflow the call stack).
+    // the states are created in the same order as a recursive construction.
+    while (!construction_stack.empty())
     {
-        // perform closure on current state, OR'ing a bitmask of conditionals
-        // encountered and keeping a bitset of chars encountered.
-        TargetStateMap target_state_map;
-        for (DfaState::const_iterator it = closed_dfa_state.begin(), it_end = closed_dfa_state.end();
-             it != it_end;
-             ++it)
+        DfaStateUnderConstruction &top = construction_stack.back();
+        if (top.m_next_pending_transition == top.m_pending_transition.size())
+        {
+            construction_stack.pop_back();
+            continue;
+        }
+
+        Uint32 source_index = top.m_dfa_state_index;
+        PendingTransition &next_pending_transition = top.m_pending_transition[top.m_next_pending_transition++];
+        PendingTransition pending_transition(
+            next_pending_transition.m_transition_type,
+            next_pending_transition.m_data_0,
+            next_pending_transition.m_data_1,
+            next_pending_transition.m_disallow_transition_closure);
+        pending_transition.m_target_dfa_state.swap(next_pending_transition.m_target_dfa_state);
+        // this may push onto construction_stack, invalidating top.
+        Uint32 target_index = ClosedDfaStateIndex(graph_context, pending_transition.m_target_dfa_state, pending_transition.m_disallow_transition_closure, construction_stack);
+        graph_context.m_dfa_graph.AddTransition(source_index, pending_transition.MakeTransition(target_index));
+    }
+
+    return dfa_state_index;
+}
+
+// generates the DFA for the state machine whose NFA start state is
+// nfa.m_start_state_index[state_machine_index], with its states numbered
+// from 0.  each state machine's DFA is disjoint from the others' (no DFA
+// state is reachable from more than one state machine's initial state), so
+// these can be generated independently.
+void GenerateStateMachineDfa (Automaton const &nfa, Uint32 nfa_accept_state_count, Uint32 state_machine_index, Automaton &dfa)
+{
+    assert(state_machine_index < nfa.m_start_state_index.size());
+    assert(nfa.m_start_state_index[state_machine_index] < nfa.m_graph.NodeCount());
+    assert(dfa.m_start_state_index.empty());
+    assert(dfa.m_graph.NodeCount() == 0);
+
+    DfaStateMap dfa_state_map;
+    GraphContext graph_context(nfa.m_graph, nfa_accept_state_count, dfa.m_graph, dfa_state_map);
+
+    DfaState dfa_state;
+    dfa_state.push_back(nfa.m_start_state_index[state_machine_index]);
+    dfa.m_start_state_index.push_back(DfaStateIndex(graph_context, dfa_state, false));
+}
+
+void GenerateDfa (Automaton const &nfa, Uint32 nfa_accept_state_count, Automaton &dfa, Uint32 thread_count)
+{
+    assert(nfa.m_graph.NodeCount() >= nfa_accept_state_count);
+    assert(nfa.m_graph.NodeCount() >= nfa.m_start_state_index.size());
+    assert(dfa.m_start_state_index.empty());
+    assert(dfa.m_graph.NodeCount() == 0);
+
+    Uint32 const state_machine_count = nfa.m_start_state_index.size();
+    vector<Automaton> state_machine_dfa(state_machine_count);
+    vector<exception_ptr> state_machine_exception(state_machine_count);
+
+    // each thread generates the DFA of the next state machine not yet taken
+    // by any thread, until there are none left.
+    atomic<Uint32> next_state_machine_index(0);
+    auto generate_state_machine_dfas = [&] ()
+    {
+        Uint32 i;
+        while ((i = next_state_machine_index++) < state_machine_count)
+        {
+            try {
+                GenerateStateMachineDfa(nfa, nfa_accept_state_count, i, state_machine_dfa[i]);
+            } catch (...) {
+                state_machine_exception[i] = current_exception();
+            }
+        }
+    };
+    thread_count = min(max(thread_count, Uint32(1)), max(state_machine_count, Uint32(1)));
+    vector<thread> threads;
+    for (Uint32 t = 1; t < thread_count; ++t)
+        threads.push_back(thread(generate_state_machine_dfas));
+    generate_state_machine_dfas();
+    for (vector<thread>::iterator it = threads.begin(), it_end = threads.end(); it != it_end; ++it)
+        it->join();
+
+    // rethrow the first state machine's exception, so that the error doesn't
+    // depend on the thread count.
+    for (Uint32 i = 0; i < state_machine_count; ++i)
+        if (state_machine_exception[i])
+            rethrow_exception(state_machine_exception[i]);
+
+    // merge the state machines' DFAs in order, so that the numbering of the
+    // states doesn't depend on the thread count either.
+    for (Uint32 i = 0; i < state_machine_count; ++i)
+    {
+        Graph const &state_machine_graph = state_machine_dfa[i].m_graph;
+        Uint32 const offset = dfa.m_graph.NodeCount();
+        for (Uint32 node_index = 0; node_index < state_machine_graph.NodeCount(); ++node_index)
+            dfa.m_graph.AddNode(&state_machine_graph.GetNode(node_index).GetData());
+        for (Uint32 node_index = 0; node_index < state_machine_graph.NodeCount(); ++node_index)
         {
-            PerformTransitionClosure(graph_context, *it, target_state_map);
+            Graph::Node const &node = state_machine_graph.GetNode(node_index);
+            for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                      it_end = node.TransitionSetEnd();
+                 it != it_end;
+                 ++it)
+            {
+                Graph::Transition::DataArray data_array(it->DataCount());
+                for (Uint32 d = 0; d < it->DataCount(); ++d)
+                    data_array[d] = it->Data(d);
+                dfa.m_graph.AddTransition(
+                    offset + node_index,
+                    Graph::Transition(it->Type(), data_array, offset + it->TargetIndex(), it->Label(), it->DotGraphColor()));
+            }
         }
+        assert(state_machine_dfa[i].m_start_state_index.size() == 1);
+        dfa.m_start_state_index.push_back(offset + state_machine_dfa[i].m_start_state_index[0]);
+    }
+
+    assert(dfa.m_start_state_index.size() == nfa.m_start_state_index.size());
+}
+
+// a partition of the elements [0, n) into sets, which is refined by marking
+// some elements and then splitting each set into its marked and unmarked
+// elements, in time proportional to the number of elements marked.  this
+// is the refinable partition from Valmari and Lehtinen's DFA minimization
+// algorithm.  the elements of each set are contiguous in m_element, with the
+// marked elements of a set preceding its unmarked elements.
+class RefinablePartition
+{
+public:
+
+    // starts with a single set containing every element.
+    RefinablePartition (Uint32 element_count)
+        :
+        m_set_count(element_count > 0 ? 1 : 0),
+        m_element(element_count),
+        m_location(element_count),
+        m_set_of(element_count, 0),
+        m_first(max(element_count, Uint32(1)), 0),
+        m_past(max(element_count, Uint32(1)), 0),
+        m_marked_count(max(element_count, Uint32(1)), 0)
+    {
+        for (Uint32 e = 0; e < element_count; ++e)
+            m_element[e] = m_location[e] = e;
+        m_past[0] = element_count;
+    }
 
-        // if no conditionals were hit, target_state_map should have a single element
-        // mapped to key Conditional(0, 0).  in this case, no conditional
-        // transitions have to be made from this state -- we can proceed directly
-        // with input-atom transitions.
-        TargetStateMap::const_iterator target_it;
-        if (Contains(target_state_map, Conditional(0, 0), target_it)
-            &&
-            (target_state_map.size() == 1 || disallow_transition_closure))
+    Uint32 SetCount () const { return m_set_count; }
+    Uint32 SetOf (Uint32 element) const { return m_set_of[element]; }
+    // the elements of each set are Element(First(set)) through Element(Past(set)-1).
+    Uint32 First (Uint32 set) const { return m_first[set]; }
+    Uint32 Past (Uint32 set) const { return m_past[set]; }
+    Uint32 Element (Uint32 location) const { return m_element[location]; }
+
+    void Mark (Uint32 element)
+    {
+        Uint32 set = m_set_of[element];
+        Uint32 location = m_location[element];
+        Uint32 first_unmarked = m_first[set] + m_marked_count[set];
+        assert(location >= first_unmarked && "you can't mark an element twice");
+        // swap element with the first unmarked element of its set.
+        m_element[location] = m_element[first_unmarked];
+        m_location[m_element[location]] = location;
+        m_element[first_unmarked] = element;
+        m_location[element] = first_unmarked;
+        if (m_marked_count[set]++ == 0)
+            m_touched_set.push_back(set);
+    }
+    // splits each set into its marked and unmarked elements (the smaller of
+    // the two becoming a new set), and unmarks everything.
+    void Split ()
+    {
+        while (!m_touched_set.empty())
         {
-            DfaState const &closed_dfa_state = target_it->second;
-            // map of transition atoms onto transitioned-to DFA states
-            map<Uint8, DfaState> transition_map;
-            for (DfaState::const_iterator it = closed_dfa_state.begin(), it_end = closed_dfa_state.end();
+            Uint32 set = m_touched_set.back();
+            m_touched_set.pop_back();
+            Uint32 first_unmarked = m_first[set] + m_marked_count[set];
+            m_marked_count[set] = 0;
+            // if every element was marked, there's nothing to split.
+            if (first_unmarked == m_past[set])
+                continue;
+
+            Uint32 new_set = m_set_count++;
+            if (first_unmarked - m_first[set] <= m_past[set] - first_unmarked)
+            {
+                m_first[new_set] = m_first[set];
+                m_past[new_set] = m_first[set] = first_unmarked;
+            }
+            else
+            {
+                m_past[new_set] = m_past[set];
+                m_first[new_set] = m_past[set] = first_unmarked;
+            }
+            for (Uint32 location = m_first[new_set]; location < m_past[new_set]; ++location)
+                m_set_of[m_element[location]] = new_set;
+        }
+    }
+
+private:
+
+    Uint32 m_set_count;
+    vector<Uint32> m_element;
+    vector<Uint32> m_location;
+    vector<Uint32> m_set_of;
+    vector<Uint32> m_first;
+    vector<Uint32> m_past;
+    vector<Uint32> m_marked_count;
+    vector<Uint32> m_touched_set;
+}; // end of class RefinablePartition
+
+// a DFA transition, where each atom class and each conditional (mask and
+// flags) is a distinct label.  a DFA state has at most one transition per label.
+struct LabeledTransition
+{
+    Uint32 m_source_index;
+    Uint32 m_label;
+    Uint32 m_target_index;
+
+    LabeledTransition (Uint32 source_index, Uint32 label, Uint32 target_index)
+        :
+        m_source_index(source_index),
+        m_label(label),
+        m_target_index(target_index)
+    { }
+
+    bool operator < (LabeledTransition const &other) const
+    {
+        return m_label < other.m_label;
+    }
+}; // end of struct LabeledTransition
+
+// the properties which DFA states must share in order to be equivalent,
+// aside from their transitions.  states of different state machines are
+// never merged (preserving the invariant that no DFA state is reachable from
+// more than one state machine's initial state), nor are distinct initial
+// states, and accepting states must have the same accept handler.
+struct StateClass
+{
+    Uint32 m_state_machine_index;
+    Uint32 m_initial_state_index;
+    Uint32 m_accept_handler_index;
+
+    bool operator < (StateClass const &other) const
+    {
+        if (m_state_machine_index != other.m_state_machine_index)
+            return m_state_machine_index < other.m_state_machine_index;
+        if (m_initial_state_index != other.m_initial_state_index)
+            return m_initial_state_index < other.m_initial_state_index;
+        return m_accept_handler_index < other.m_accept_handler_index;
+    }
+}; // end of struct StateClass
+
+void MinimizeDfa (Automaton const &dfa, Automaton &minimized_dfa)
+{
+    assert(minimized_dfa.m_start_state_index.empty());
+    assert(minimized_dfa.m_graph.NodeCount() == 0);
+
+    static Uint32 const NO_INDEX = UINT32_UPPER_BOUND;
+    Graph const &graph = dfa.m_graph;
+    Uint32 const state_count = graph.NodeCount();
+
+    // determine which state machine each state belongs to.
+    vector<Uint32> state_machine_index(state_count, NO_INDEX);
+    for (Uint32 i = 0; i < dfa.m_start_state_index.size(); ++i)
+    {
+        vector<Uint32> state_stack(1, dfa.m_start_state_index[i]);
+        state_machine_index[dfa.m_start_state_index[i]] = i;
+        while (!state_stack.empty())
+        {
+            Graph::Node const &node = graph.GetNode(state_stack.back());
+            state_stack.pop_back();
+            for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                      it_end = node.TransitionSetEnd();
                  it != it_end;
                  ++it)
             {
-                Graph::Node const &from_nfa_node = graph_context.m_nfa_graph.GetNode(*it);
-                for (Graph::TransitionSet::const_iterator trans_it = from_nfa_node.TransitionSetBegin(),
-                                                          trans_it_end = from_nfa_node.TransitionSetEnd();
-                     trans_it != trans_it_end;
-                     ++trans_it)
+                assert(state_machine_index[it->TargetIndex()] == NO_INDEX || state_machine_index[it->TargetIndex()] == i);
+                if (state_machine_index[it->TargetIndex()] == NO_INDEX)
                 {
-                    Graph::Transition const &transition = *trans_it;
-                    if (transition.Type() == TT_INPUT_ATOM)
-                        transition_map[transition.Data(0)].insert(transition.TargetIndex());
-                    else if (transition.Type() == TT_INPUT_ATOM_RANGE)
-                        for (Uint32 atom = transition.Data(0); atom <= transition.Data(1); ++atom)
-                            transition_map[atom].insert(transition.TargetIndex());
+                    state_machine_index[it->TargetIndex()] = i;
+                    state_stack.push_back(it->TargetIndex());
                 }
             }
-            // add the transitions from the above-made map
-            map<Uint8, DfaState>::const_iterator it = transition_map.begin(), it_end = transition_map.end();
-            while (it != it_end)
+        }
+    }
+
+    // partition the input atoms into classes, delimited by the bounds of
+    // every input-atom(-range) transition, so that each transition spans a
+    // contiguous sequence of atom classes.
+    vector<Uint32> atom_class(256, 0);
+    Uint32 atom_class_count = 0;
+    {
+        vector<bool> begins_atom_class(257, false);
+        for (Uint32 state = 0; state < state_count; ++state)
+        {
+            Graph::Node const &node = graph.GetNode(state);
+            for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                      it_end = node.TransitionSetEnd();
+                 it != it_end;
+                 ++it)
             {
-                map<Uint8, DfaState>::const_iterator section_it_end = it;
-                Uint8 starting_atom = it->first;
-                Uint8 most_recent_atom = it->first;
-                DfaState const &target_dfa_state = it->second;
-                while (section_it_end != it_end && section_it_end->first - most_recent_atom <= 1 && section_it_end->second == target_dfa_state)
+                if (it->Type() == TT_INPUT_ATOM)
                 {
-                    most_recent_atom = section_it_end->first;
-                    ++section_it_end;
+                    begins_atom_class[it->Data(0)] = true;
+                    begins_atom_class[it->Data(0)+1] = true;
+                }
+                else if (it->Type() == TT_INPUT_ATOM_RANGE)
+                {
+                    begins_atom_class[it->Data(0)] = true;
+                    begins_atom_class[it->Data(1)+1] = true;
                 }
-                assert(it != section_it_end);
-                // if the atom range was a single value, use TT_INPUT_ATOM
-                if (most_recent_atom == starting_atom)
-                    graph_context.m_dfa_graph.AddTransition(
-                        current_state_index,
-                        InputAtomTransition(
-                            starting_atom,
-                            DfaStateIndex(graph_context, target_dfa_state, false)));
-                // otherwise they spanned a range, so use TT_INPUT_ATOM_RANGE
-                else
-                    graph_context.m_dfa_graph.AddTransition(
-                        current_state_index,
-                        InputAtomRangeTransition(
-                            starting_atom,
-                            most_recent_atom,
-                            DfaStateIndex(graph_context, target_dfa_state, false)));
-                it = section_it_end;
             }
         }
-        // otherwise we have to make conditional transitions.  all transitions
-        // from the nodes being transitioned to here will have only input-atom
-        // transitions.
-        else
+        for (Uint32 atom = 0; atom < 256; ++atom)
         {
-            // calculate a comprehensive mask which include all target
-            // conditionals' masks.
-            Conditional current_condition(0, 0);
-            for (TargetStateMap::const_iterator it = target_state_map.begin(),
-                                                it_end = target_state_map.end();
-                 it != it_end;
-                 ++it)
+            if (begins_atom_class[atom])
+                ++atom_class_count;
+            atom_class[atom] = atom_class_count;
+        }
+        ++atom_class_count;
+    }
+
+    // make the labeled transitions, sorted by label.
+    vector<LabeledTransition> transition_array;
+    for (Uint32 state = 0; state < state_count; ++state)
+    {
+        Graph::Node const &node = graph.GetNode(state);
+        for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                  it_end = node.TransitionSetEnd();
+             it != it_end;
+             ++it)
+        {
+            Graph::Transition const &transition = *it;
+            switch (transition.Type())
             {
-                Conditional const &target_condition = it->first;
-                current_condition.m_mask |= target_condition.m_mask;
+                case TT_INPUT_ATOM:
+                    transition_array.push_back(LabeledTransition(state, atom_class[transition.Data(0)], transition.TargetIndex()));
+                    break;
+
+                case TT_INPUT_ATOM_RANGE:
+                    for (Uint32 label = atom_class[transition.Data(0)]; label <= atom_class[transition.Data(1)]; ++label)
+                        transition_array.push_back(LabeledTransition(state, label, transition.TargetIndex()));
+                    break;
+
+                case TT_CONDITIONAL:
+                    transition_array.push_back(LabeledTransition(state, atom_class_count + ((transition.Data(0) << 8) | transition.Data(1)), transition.TargetIndex()));
+                    break;
+
+                default:
+                    assert(false && "invalid DFA transition type");
+                    break;
             }
+        }
+    }
+    stable_sort(transition_array.begin(), transition_array.end());
+    Uint32 const transition_count = transition_array.size();
+
+    // the initial partition of the states, by StateClass.
+    RefinablePartition state_partition(state_count);
+    {
+        vector<bool> is_initial_state(state_count, false);
+        for (Uint32 i = 0; i < dfa.m_start_state_index.size(); ++i)
+            is_initial_state[dfa.m_start_state_index[i]] = true;
 
-            // for every possible combination recorded in target_state_map, make a
-            // transition to the set of DFA states (each being a set of NFA states)
-            // which are accepted by the calculated conditional.
-            current_condition.m_flags = 0;
-            do
+        typedef map<StateClass, vector<Uint32> > StateClassMap;
+        StateClassMap state_class_map;
+        for (Uint32 state = 0; state < state_count; ++state)
+        {
+            NodeData const &node_data = GetNodeData(graph, state);
+            StateClass state_class;
+            state_class.m_state_machine_index = state_machine_index[state];
+            state_class.m_initial_state_index = is_initial_state[state] ? state : NO_INDEX;
+            state_class.m_accept_handler_index = node_data.m_is_accept_node ? node_data.m_dfa_accept_handler_index : NO_INDEX;
+            state_class_map[state_class].push_back(state);
+        }
+        // split off every class, except for one which is what's left over.
+        for (StateClassMap::const_iterator it = state_class_map.begin(),
+                                           it_end = state_class_map.end();
+             it != it_end && state_partition.SetCount() < state_class_map.size();
+             ++it)
+        {
+            for (vector<Uint32>::const_iterator state_it = it->second.begin(),
+                                                state_it_end = it->second.end();
+                 state_it != state_it_end;
+                 ++state_it)
             {
-                DfaState cumulative_target_dfa_state;
-                for (TargetStateMap::const_iterator it = target_state_map.begin(),
-                                                    it_end = target_state_map.end();
-                    it != it_end;
-                    ++it)
-                {
-                    Conditional const &target_condition = it->first;
-                    if (!current_condition.ConflictsWith(target_condition))
-                    {
-                        DfaState const &target_dfa_state = it->second;
-                        cumulative_target_dfa_state.insert(target_dfa_state.begin(), target_dfa_state.end());
-                    }
-                }
-                if (!cumulative_target_dfa_state.empty())
-                    graph_context.m_dfa_graph.AddTransition(
-                        current_state_index,
-                        DfaConditionalTransition(
-                            current_condition.m_mask,
-                            current_condition.m_flags,
-                            DfaStateIndex(graph_context, cumulative_target_dfa_state, true)));
-
-                ++current_condition;
+                state_partition.Mark(*state_it);
             }
-            while (current_condition.m_flags != 0);
+            state_partition.Split();
         }
     }
 
-    // return the generated state's index
-    return dfa_state_index;
-}
+    // the initial partition of the transitions, by label.
+    RefinablePartition transition_partition(transition_count);
+    for (Uint32 t = 0; t < transition_count; )
+    {
+        Uint32 label_past = t;
+        while (label_past < transition_count && transition_array[label_past].m_label == transition_array[t].m_label)
+            ++label_past;
+        // the last label is what's left over.
+        if (label_past < transition_count)
+        {
+            for ( ; t < label_past; ++t)
+                transition_partition.Mark(t);
+            transition_partition.Split();
+        }
+        t = label_past;
+    }
 
-void GenerateDfa (Automaton const &nfa, Uint32 nfa_accept_state_count, Automaton &dfa)
-{
-    assert(nfa.m_graph.NodeCount() >= nfa_accept_state_count);
-    assert(nfa.m_graph.NodeCount() >= nfa.m_start_state_index.size());
-    assert(dfa.m_start_state_index.empty());
-    assert(dfa.m_graph.NodeCount() == 0);
+    // index the transitions going into each state.
+    vector<Uint32> incoming_transition_offset(state_count+1, 0);
+    vector<Uint32> incoming_transition(transition_count);
+    for (Uint32 t = 0; t < transition_count; ++t)
+        ++incoming_transition_offset[transition_array[t].m_target_index+1];
+    for (Uint32 state = 0; state < state_count; ++state)
+        incoming_transition_offset[state+1] += incoming_transition_offset[state];
+    {
+        vector<Uint32> next_incoming_transition(incoming_transition_offset.begin(), incoming_transition_offset.end()-1);
+        for (Uint32 t = 0; t < transition_count; ++t)
+            incoming_transition[next_incoming_transition[transition_array[t].m_target_index]++] = t;
+    }
 
-    DfaStateMap dfa_state_map;
-    GraphContext graph_context(nfa.m_graph, nfa_accept_state_count, dfa.m_graph, dfa_state_map);
+    // each set of transitions (having the same label and going into the same
+    // set of states) splits the sets of states by which states have a
+    // transition in it, and each new set of states in turn splits the sets of
+    // transitions by which go into it.  the first set of states is never
+    // needed for splitting, because the transitions start out partitioned by
+    // label alone, i.e. going into the set of all states.
+    for (Uint32 transition_set = 0, state_set = 1; transition_set < transition_partition.SetCount(); ++transition_set)
+    {
+        for (Uint32 location = transition_partition.First(transition_set); location < transition_partition.Past(transition_set); ++location)
+            state_partition.Mark(transition_array[transition_partition.Element(location)].m_source_index);
+        state_partition.Split();
+
+        for ( ; state_set < state_partition.SetCount(); ++state_set)
+        {
+            for (Uint32 location = state_partition.First(state_set); location < state_partition.Past(state_set); ++location)
+            {
+                Uint32 state = state_partition.Element(location);
+                for (Uint32 i = incoming_transition_offset[state]; i < incoming_transition_offset[state+1]; ++i)
+                    transition_partition.Mark(incoming_transition[i]);
+            }
+            transition_partition.Split();
+        }
+    }
 
-    for (Uint32 i = 0; i < nfa.m_start_state_index.size(); ++i)
+    // each set of equivalent states becomes a single state, numbered in order
+    // of its lowest-indexed state, which also serves as its representative.
+    vector<Uint32> minimized_state_index(state_partition.SetCount(), NO_INDEX);
+    vector<Uint32> representative_state;
+    for (Uint32 state = 0; state < state_count; ++state)
     {
-        assert(nfa.m_start_state_index[i] < nfa.m_graph.NodeCount());
+        Uint32 set = state_partition.SetOf(state);
+        if (minimized_state_index[set] == NO_INDEX)
+        {
+            minimized_state_index[set] = representative_state.size();
+            representative_state.push_back(state);
+            minimized_dfa.m_graph.AddNode(&GetNodeData(graph, state));
+        }
+    }
+    assert(representative_state.size() == state_partition.SetCount());
 
-        DfaState dfa_state;
-        dfa_state.insert(nfa.m_start_state_index[i]);
-        dfa.m_start_state_index.push_back(DfaStateIndex(graph_context, dfa_state, false));
+    for (Uint32 i = 0; i < representative_state.size(); ++i)
+    {
+        Graph::Node const &node = graph.GetNode(representative_state[i]);
+        // collect the input-atom transitions' targets per atom, so that
+        // adjacent ranges whose targets were merged can be coalesced.
+        vector<Uint32> atom_target(256, NO_INDEX);
+        for (Graph::TransitionSet::const_iterator it = node.TransitionSetBegin(),
+                                                  it_end = node.TransitionSetEnd();
+             it != it_end;
+             ++it)
+        {
+            Graph::Transition const &transition = *it;
+            Uint32 target_index = minimized_state_index[state_partition.SetOf(transition.TargetIndex())];
+            if (transition.Type() == TT_INPUT_ATOM)
+                atom_target[transition.Data(0)] = target_index;
+            else if (transition.Type() == TT_INPUT_ATOM_RANGE)
+                for (Uint32 atom = transition.Data(0); atom <= transition.Data(1); ++atom)
+                    atom_target[atom] = target_index;
+            else
+            {
+                assert(transition.Type() == TT_CONDITIONAL);
+                minimized_dfa.m_graph.AddTransition(i, DfaConditionalTransition(transition.Data(0), transition.Data(1), target_index));
+            }
+        }
+        for (Uint32 atom = 0; atom < 256; )
+        {
+            Uint32 range_past = atom + 1;
+            while (range_past < 256 && atom_target[range_past] == atom_target[atom])
+                ++range_past;
+            if (atom_target[atom] != NO_INDEX)
+            {
+                // if the atom range was a single value, use TT_INPUT_ATOM
+                if (range_past == atom + 1)
+                    minimized_dfa.m_graph.AddTransition(i, InputAtomTransition(atom, atom_target[atom]));
+                // otherwise they spanned a range, so use TT_INPUT_ATOM_RANGE
+                else
+                    minimized_dfa.m_graph.AddTransition(i, InputAtomRangeTransition(atom, range_past - 1, atom_target[atom]));
+            }
+            atom = range_past;
+        }
     }
 
-    assert(dfa.m_start_state_index.size() == nfa.m_start_state_index.size());
+    for (Uint32 i = 0; i < dfa.m_start_state_index.size(); ++i)
+        minimized_dfa.m_start_state_index.push_back(minimized_state_index[state_partition.SetOf(dfa.m_start_state_index[i])]);
 }
 
 } // end of namespace Regex
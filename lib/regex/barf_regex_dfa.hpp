@@ -13,7 +13,14 @@ class Graph;
 
 namespace Regex {
 
-void GenerateDfa (Automaton const &nfa, Uint32 nfa_accept_state_count, Automaton &dfa);
+// generates the DFA of each state machine (one per nfa start state) using up
+// to thread_count threads.  the result doesn't depend on thread_count.
+void GenerateDfa (Automaton const &nfa, Uint32 nfa_accept_state_count, Automaton &dfa, Uint32 thread_count = 1);
+// merges equivalent states of dfa (produced by GenerateDfa) into minimized_dfa.
+// states are only equivalent if they belong to the same state machine, have
+// the same accept handler (if any), and have equivalent transitions on each
+// input atom and conditional; initial states are never merged together.
+void MinimizeDfa (Automaton const &dfa, Automaton &minimized_dfa);
 
 } // end of namespace Regex
 } // end of namespace Barf